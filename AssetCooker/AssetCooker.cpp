@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "ContentHash.h"
+#include "CookedAssets.h"
+#include "MappedFile.h"
+#include "MeshAttributes.h"
+#include "MeshImport.h"
+#include "MeshLod.h"
+#include "MeshWeld.h"
+#include "PngDecoder.h"
+#include "VertexCache.h"
+
+/* Offline conversion of source assets into the runtime formats of
+CookedAssets.h: meshes are welded, simplified into LODs, reordered for the
+vertex cache and fetch, and quantized; textures get their mip chain. A source
+whose hash matches the one stored in its cooked file is skipped, so only the
+files that changed are cooked again */
+
+namespace {
+
+//Part of every hash, bump it when a cooking step changes so everything is cooked again
+const unsigned long long PIPELINE_VERSION = 1;
+
+enum AssetKind {
+	MESH_ASSET,
+	TEXTURE_ASSET,
+};
+
+struct CookJob {
+	std::string source;
+	std::string output;
+	AssetKind kind;
+};
+
+enum CookResult {
+	COOKED,
+	UP_TO_DATE,
+	FAILED,
+};
+
+std::string lower_extension(const std::string& path) {
+	size_t dot = path.find_last_of('.');
+	size_t slash = path.find_last_of("/\\");
+	if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+		return std::string();
+	}
+	std::string extension = path.substr(dot + 1);
+	for (size_t i = 0; i < extension.size(); ++i) {
+		extension[i] = char(std::tolower(static_cast<unsigned char>(extension[i])));
+	}
+	return extension;
+}
+
+//File name without directory and extension
+std::string stem(const std::string& path) {
+	size_t slash = path.find_last_of("/\\");
+	std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+	return name.substr(0, name.find_last_of('.'));
+}
+
+//Write next to the output and rename, a failed or interrupted cook never leaves a half written file
+bool replace_file(const std::string& temporary, const std::string& output) {
+	std::remove(output.c_str());
+	if (std::rename(temporary.c_str(), output.c_str()) != 0) {
+		std::remove(temporary.c_str());
+		return false;
+	}
+	return true;
+}
+
+bool cook_mesh(const CookJob& job, const MappedFile& source, unsigned long long hash, std::ostream& log) {
+	//The source is already mapped for the hash, parse it from there
+	Mesh mesh;
+	ImportInfo info;
+	bool imported = lower_extension(job.source) == "obj" ? import_obj(source.data(), source.size(), mesh, info) : import_ply(source.data(), source.size(), mesh, info);
+	if (!imported || mesh.indices.empty()) {
+		log << "can not import the mesh; ";
+		return false;
+	}
+	mesh = weld_vertices(unweld_mesh(mesh), DEFAULT_WELD_SETTINGS);
+	//Same rule as the viewer: files without colors are colored by their normals
+	if (!info.has_colors) {
+		std::vector<glm::vec3> normals = compute_normals(mesh.vertices, mesh.indices);
+		for (size_t i = 0; i < normals.size(); ++i) {
+			mesh.vertices[i].color = 0.5f * normals[i] + 0.5f;
+		}
+	}
+	const float acmr_before = average_cache_miss_ratio(mesh.indices, mesh.vertices.size());
+
+	/************************************************************************/
+	/* LODs, each level reordered for the cache, then the shared vertices   */
+	/************************************************************************/
+	std::vector<LodSettings> lod_settings = {
+		{ 0.5f, 0.0f },
+		{ 0.25f, 0.0f },
+		{ 0.1f, 0.0f },
+		{ 0.03f, 0.0f },
+		{ 0.01f, 0.0f },
+	};
+	LodChain chain = build_lod_chain(mesh, lod_settings);
+	for (size_t i = 0; i < chain.levels.size(); ++i) {
+		std::vector<unsigned int>::iterator first = chain.indices.begin() + chain.levels[i].first_index;
+		std::vector<unsigned int> level(first, first + chain.levels[i].index_count);
+		level = optimize_vertex_cache(level, mesh.vertices.size());
+		std::copy(level.begin(), level.end(), first);
+	}
+	const float acmr_after = average_cache_miss_ratio(
+		std::vector<unsigned int>(chain.indices.begin(), chain.indices.begin() + chain.levels[0].index_count), mesh.vertices.size());
+	//Vertices in the order the finest level uses them, the coarser ones only use a subset
+	optimize_vertex_fetch(mesh.vertices, chain.indices);
+
+	const std::string temporary = job.output + ".tmp";
+	if (!write_cooked_mesh(temporary, hash, mesh, chain) || !replace_file(temporary, job.output)) {
+		log << "can not write " << job.output << "; ";
+		return false;
+	}
+	log << mesh.vertices.size() << " vertices, " << chain.levels.size() << " LODs, ACMR " << acmr_before << " -> " << acmr_after << "; ";
+	return true;
+}
+
+bool cook_texture(const CookJob& job, const MappedFile& source, unsigned long long hash, std::ostream& log) {
+	Image image;
+	if (!decode_png(reinterpret_cast<const unsigned char*>(source.data()), source.size(), image)) {
+		log << "not a supported PNG; ";
+		return false;
+	}
+	const std::string temporary = job.output + ".tmp";
+	if (!write_cooked_texture(temporary, hash, image) || !replace_file(temporary, job.output)) {
+		log << "can not write " << job.output << "; ";
+		return false;
+	}
+	log << image.width << "x" << image.height << "; ";
+	return true;
+}
+
+CookResult cook(const CookJob& job, bool force, std::ostream& log) {
+	MappedFile source;
+	if (!source.open(job.source)) {
+		log << "can not open the source; ";
+		return FAILED;
+	}
+	const unsigned long long hash = hash_content(source.data(), source.size(), PIPELINE_VERSION);
+	unsigned long long cooked_hash;
+	const unsigned int magic = job.kind == MESH_ASSET ? COOKED_MESH_MAGIC : COOKED_TEXTURE_MAGIC;
+	if (!force && read_cooked_source_hash(job.output, magic, cooked_hash) && cooked_hash == hash) {
+		return UP_TO_DATE;
+	}
+	bool cooked = job.kind == MESH_ASSET ? cook_mesh(job, source, hash, log) : cook_texture(job, source, hash, log);
+	return cooked ? COOKED : FAILED;
+}
+
+}//namespace
+
+int main(int argc, char* argv[]) {
+	using std::cout;
+	using std::cerr;
+	using std::endl;
+
+	unsigned int jobs_threads = 0;
+	bool force = false;
+	std::string output_directory;
+	std::vector<std::string> sources;
+	for (int i = 1; i < argc; ++i) {
+		std::string option = argv[i];
+		if (option == "-j" && i + 1 < argc) {
+			int count = std::atoi(argv[++i]);
+			jobs_threads = count > 0 ? static_cast<unsigned int>(count) : 0;
+		} else if (option == "--force") {
+			force = true;
+		} else if (output_directory.empty()) {
+			output_directory = option;
+		} else {
+			sources.push_back(option);
+		}
+	}
+	if (output_directory.empty() || sources.empty()) {
+		cerr << "Usage: " << argv[0] << " [-j jobs] [--force] output_directory source.obj|.ply|.png..." << endl;
+		return EXIT_FAILURE;
+	}
+
+	/************************************************************************/
+	/* One job per source, every output named after its source              */
+	/************************************************************************/
+	std::vector<CookJob> jobs;
+	std::set<std::string> outputs;
+	bool failed = false;
+	for (size_t i = 0; i < sources.size(); ++i) {
+		CookJob job;
+		job.source = sources[i];
+		std::string extension = lower_extension(job.source);
+		if (extension == "obj" || extension == "ply") {
+			job.kind = MESH_ASSET;
+			job.output = output_directory + "/" + stem(job.source) + ".sbm";
+		} else if (extension == "png") {
+			job.kind = TEXTURE_ASSET;
+			job.output = output_directory + "/" + stem(job.source) + ".sbt";
+		} else {
+			cerr << job.source << ": unknown asset type" << endl;
+			failed = true;
+			continue;
+		}
+		if (!outputs.insert(job.output).second) {
+			cerr << job.source << ": another source already cooks into " << job.output << endl;
+			failed = true;
+			continue;
+		}
+		jobs.push_back(job);
+	}
+
+	/* Files are cooked in parallel, each thread takes the next one left. The
+	steps inside share the thread pool, whose loops run one at a time, so
+	big files still spread over every core while small ones overlap */
+	unsigned int thread_count = jobs_threads > 0 ? jobs_threads : glm::max(1u, std::thread::hardware_concurrency());
+	thread_count = glm::min(thread_count, static_cast<unsigned int>(jobs.size()));
+	std::atomic<size_t> next_job(0);
+	std::atomic<unsigned int> cooked_count(0);
+	std::atomic<unsigned int> skipped_count(0);
+	std::atomic<unsigned int> failed_count(0);
+	std::mutex output_mutex;
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	auto worker = [&]() {
+		for (size_t i = next_job++; i < jobs.size(); i = next_job++) {
+			std::chrono::high_resolution_clock::time_point job_start = std::chrono::high_resolution_clock::now();
+			std::ostringstream log;
+			CookResult result = cook(jobs[i], force, log);
+			std::chrono::high_resolution_clock::time_point job_end = std::chrono::high_resolution_clock::now();
+			std::lock_guard<std::mutex> lock(output_mutex);
+			if (result == COOKED) {
+				++cooked_count;
+				cout << "Cooked " << jobs[i].source << ": " << log.str() << std::chrono::duration<double, std::milli>(job_end - job_start).count() << " ms" << endl;
+			} else if (result == UP_TO_DATE) {
+				++skipped_count;
+				cout << "Up to date " << jobs[i].source << endl;
+			} else {
+				++failed_count;
+				cerr << "Failed " << jobs[i].source << ": " << log.str() << endl;
+			}
+		}
+	};
+	std::vector<std::thread> threads;
+	for (unsigned int i = 1; i < thread_count; ++i) {
+		threads.push_back(std::thread(worker));
+	}
+	worker();
+	for (size_t i = 0; i < threads.size(); ++i) {
+		threads[i].join();
+	}
+	std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+	cout << cooked_count << " cooked, " << skipped_count << " up to date, " << failed_count << " failed in "
+		<< std::chrono::duration<double, std::milli>(end - start).count() << " ms" << endl;
+	return failed || failed_count > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
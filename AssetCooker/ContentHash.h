@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+/* 64 bits content hash of a whole file (XXH64 by Yann Collet). Fast enough
+that hashing a source costs much less than reading it, and the same on every
+platform so the cooked files can be shared */
+namespace content_hash {
+
+const unsigned long long PRIME1 = 0x9E3779B185EBCA87ull;
+const unsigned long long PRIME2 = 0xC2B2AE3D27D4EB4Full;
+const unsigned long long PRIME3 = 0x165667B19E3779F9ull;
+const unsigned long long PRIME4 = 0x85EBCA77C2B2AE63ull;
+const unsigned long long PRIME5 = 0x27D4EB2F165667C5ull;
+
+inline unsigned long long rotate_left(unsigned long long x, int bits) {
+	return (x << bits) | (x >> (64 - bits));
+}
+
+//Unaligned little endian reads
+inline unsigned long long read64(const unsigned char* p) {
+	unsigned long long value;
+	std::memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+inline unsigned long long read32(const unsigned char* p) {
+	unsigned int value;
+	std::memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+inline unsigned long long lane_round(unsigned long long accumulator, unsigned long long input) {
+	accumulator += input * PRIME2;
+	accumulator = rotate_left(accumulator, 31);
+	return accumulator * PRIME1;
+}
+
+inline unsigned long long merge_round(unsigned long long hash, unsigned long long accumulator) {
+	hash ^= lane_round(0, accumulator);
+	return hash * PRIME1 + PRIME4;
+}
+
+}//namespace content_hash
+
+inline unsigned long long hash_content(const void* data, size_t size, unsigned long long seed) {
+	using namespace content_hash;
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	const unsigned char* end = p + size;
+	unsigned long long hash;
+
+	/************************************************************************/
+	/* Four independent lanes over 32 bytes stripes                         */
+	/************************************************************************/
+	if (size >= 32) {
+		unsigned long long v1 = seed + PRIME1 + PRIME2;
+		unsigned long long v2 = seed + PRIME2;
+		unsigned long long v3 = seed;
+		unsigned long long v4 = seed - PRIME1;
+		const unsigned char* limit = end - 32;
+		do {
+			v1 = lane_round(v1, read64(p));
+			v2 = lane_round(v2, read64(p + 8));
+			v3 = lane_round(v3, read64(p + 16));
+			v4 = lane_round(v4, read64(p + 24));
+			p += 32;
+		} while (p <= limit);
+		hash = rotate_left(v1, 1) + rotate_left(v2, 7) + rotate_left(v3, 12) + rotate_left(v4, 18);
+		hash = merge_round(hash, v1);
+		hash = merge_round(hash, v2);
+		hash = merge_round(hash, v3);
+		hash = merge_round(hash, v4);
+	} else {
+		hash = seed + PRIME5;
+	}
+	hash += static_cast<unsigned long long>(size);
+
+	/************************************************************************/
+	/* The tail, then the final mix                                         */
+	/************************************************************************/
+	while (p + 8 <= end) {
+		hash ^= lane_round(0, read64(p));
+		hash = rotate_left(hash, 27) * PRIME1 + PRIME4;
+		p += 8;
+	}
+	if (p + 4 <= end) {
+		hash ^= read32(p) * PRIME1;
+		hash = rotate_left(hash, 23) * PRIME2 + PRIME3;
+		p += 4;
+	}
+	while (p < end) {
+		hash ^= (*p) * PRIME5;
+		hash = rotate_left(hash, 11) * PRIME1;
+		++p;
+	}
+	hash ^= hash >> 33;
+	hash *= PRIME2;
+	hash ^= hash >> 29;
+	hash *= PRIME3;
+	hash ^= hash >> 32;
+	return hash;
+}
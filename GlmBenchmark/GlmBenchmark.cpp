@@ -0,0 +1,260 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/simd_mat4.hpp>
+#include <glm/gtx/simd_vec4.hpp>
+
+/* Times glm::mat4 against fmat4x4SIMD on arrays of matrices, the way the
+samples keep them: both read and write glm::mat4, so the SIMD times include
+the conversions. Every SIMD result is checked against the plain one and the
+program fails when they disagree, which is what makes it safe to build
+without GLM_FORCE_PURE. The highp glm::mat4 code does not use intrinsics, it
+is the GLM_FORCE_PURE path with or without the define */
+
+namespace {
+
+typedef glm::detail::fmat4x4SIMD simd_mat4;
+typedef glm::detail::fvec4SIMD simd_vec4;
+
+//Matrices processed per timing, whatever the batch size
+const size_t WORK_PER_RUN = 1 << 22;
+//Best of these many runs is reported
+const int RUN_COUNT = 5;
+
+//Relative to the largest element of the expected matrix
+const float PRODUCT_TOLERANCE = 1e-5f;
+const float INVERSE_TOLERANCE = 1e-4f;
+
+struct Batch {
+	std::vector<glm::mat4> a;
+	std::vector<glm::mat4> b;
+	std::vector<glm::vec4> v;
+	std::vector<glm::mat4> pure_matrices;
+	std::vector<glm::mat4> simd_matrices;
+	std::vector<glm::vec4> pure_vectors;
+	std::vector<glm::vec4> simd_vectors;
+};
+
+enum Workload {
+	MATRIX_PRODUCT,
+	MATRIX_INVERSE,
+	MATRIX_TRANSPOSE,
+	MATRIX_VECTOR,
+};
+
+const char* workload_name(Workload workload) {
+	switch (workload) {
+	case MATRIX_PRODUCT:
+		return "mat * mat";
+	case MATRIX_INVERSE:
+		return "inverse";
+	case MATRIX_TRANSPOSE:
+		return "transpose";
+	default:
+		return "mat * vec";
+	}
+}
+
+//Diagonally dominant, so every matrix has a well conditioned inverse
+glm::mat4 random_matrix(std::mt19937& random) {
+	std::uniform_real_distribution<float> element(-1.0f, 1.0f);
+	glm::mat4 m;
+	for (int c = 0; c < 4; ++c) {
+		for (int r = 0; r < 4; ++r) {
+			m[c][r] = element(random) + (c == r ? 4.0f : 0.0f);
+		}
+	}
+	return m;
+}
+
+void make_batch(size_t count, Batch& batch) {
+	std::mt19937 random(static_cast<unsigned int>(count));
+	std::uniform_real_distribution<float> element(-1.0f, 1.0f);
+	batch.a.resize(count);
+	batch.b.resize(count);
+	batch.v.resize(count);
+	for (size_t i = 0; i < count; ++i) {
+		batch.a[i] = random_matrix(random);
+		batch.b[i] = random_matrix(random);
+		batch.v[i] = glm::vec4(element(random), element(random), element(random), 1.0f);
+	}
+	batch.pure_matrices.assign(count, glm::mat4());
+	batch.simd_matrices.assign(count, glm::mat4());
+	batch.pure_vectors.assign(count, glm::vec4());
+	batch.simd_vectors.assign(count, glm::vec4());
+}
+
+void run_pure(Workload workload, Batch& batch) {
+	const size_t count = batch.a.size();
+	switch (workload) {
+	case MATRIX_PRODUCT:
+		for (size_t i = 0; i < count; ++i) {
+			batch.pure_matrices[i] = batch.a[i] * batch.b[i];
+		}
+		break;
+	case MATRIX_INVERSE:
+		for (size_t i = 0; i < count; ++i) {
+			batch.pure_matrices[i] = glm::inverse(batch.a[i]);
+		}
+		break;
+	case MATRIX_TRANSPOSE:
+		for (size_t i = 0; i < count; ++i) {
+			batch.pure_matrices[i] = glm::transpose(batch.a[i]);
+		}
+		break;
+	default:
+		for (size_t i = 0; i < count; ++i) {
+			batch.pure_vectors[i] = batch.a[i] * batch.v[i];
+		}
+		break;
+	}
+}
+
+void run_simd(Workload workload, Batch& batch) {
+	const size_t count = batch.a.size();
+	switch (workload) {
+	case MATRIX_PRODUCT:
+		for (size_t i = 0; i < count; ++i) {
+			simd_mat4 a(batch.a[i]);
+			simd_mat4 b(batch.b[i]);
+			batch.simd_matrices[i] = glm::mat4_cast(a * b);
+		}
+		break;
+	case MATRIX_INVERSE:
+		for (size_t i = 0; i < count; ++i) {
+			batch.simd_matrices[i] = glm::mat4_cast(glm::inverse(simd_mat4(batch.a[i])));
+		}
+		break;
+	case MATRIX_TRANSPOSE:
+		for (size_t i = 0; i < count; ++i) {
+			batch.simd_matrices[i] = glm::mat4_cast(glm::transpose(simd_mat4(batch.a[i])));
+		}
+		break;
+	default:
+		for (size_t i = 0; i < count; ++i) {
+			simd_mat4 a(batch.a[i]);
+			batch.simd_vectors[i] = glm::vec4_cast(a * simd_vec4(batch.v[i]));
+		}
+		break;
+	}
+}
+
+//Best time of RUN_COUNT, in nanoseconds per matrix
+double time_run(void (*run)(Workload, Batch&), Workload workload, Batch& batch) {
+	const size_t repeats = std::max<size_t>(1, WORK_PER_RUN / batch.a.size());
+	double best = 0.0;
+	for (int r = 0; r < RUN_COUNT; ++r) {
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		for (size_t i = 0; i < repeats; ++i) {
+			run(workload, batch);
+		}
+		std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+		double per_matrix = elapsed.count() / static_cast<double>(repeats * batch.a.size());
+		best = r == 0 ? per_matrix : std::min(best, per_matrix);
+	}
+	return best;
+}
+
+//Largest difference over the batch, relative to the size of the expected values
+float relative_error(Workload workload, const Batch& batch) {
+	float worst = 0.0f;
+	for (size_t i = 0; i < batch.a.size(); ++i) {
+		float scale = 0.0f;
+		float difference = 0.0f;
+		if (workload == MATRIX_VECTOR) {
+			for (int r = 0; r < 4; ++r) {
+				scale = glm::max(scale, glm::abs(batch.pure_vectors[i][r]));
+				difference = glm::max(difference, glm::abs(batch.pure_vectors[i][r] - batch.simd_vectors[i][r]));
+			}
+		} else {
+			for (int c = 0; c < 4; ++c) {
+				for (int r = 0; r < 4; ++r) {
+					scale = glm::max(scale, glm::abs(batch.pure_matrices[i][c][r]));
+					difference = glm::max(difference, glm::abs(batch.pure_matrices[i][c][r] - batch.simd_matrices[i][c][r]));
+				}
+			}
+		}
+		//NaN fails too
+		float error = scale > 0.0f ? difference / scale : difference;
+		if (!(error <= worst)) {
+			worst = error;
+		}
+	}
+	return worst;
+}
+
+//fmat4x4SIMD operations that are not timed but must agree with glm::mat4 as well
+bool check_operators() {
+	std::mt19937 random(1);
+	glm::mat4 a = random_matrix(random);
+	glm::mat4 b = random_matrix(random);
+	simd_mat4 product(a);
+	product *= simd_mat4(b);
+	simd_mat4 quotient(a);
+	quotient /= simd_mat4(b);
+	glm::mat4 expected_product = a * b;
+	glm::mat4 expected_quotient = a * glm::inverse(b);
+	glm::mat4 got_product = glm::mat4_cast(product);
+	glm::mat4 got_quotient = glm::mat4_cast(quotient);
+	for (int c = 0; c < 4; ++c) {
+		for (int r = 0; r < 4; ++r) {
+			if (!(glm::abs(got_product[c][r] - expected_product[c][r]) <= PRODUCT_TOLERANCE * 32.0f) ||
+				!(glm::abs(got_quotient[c][r] - expected_quotient[c][r]) <= INVERSE_TOLERANCE * 4.0f)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+}//namespace
+
+int main() {
+	using std::cout;
+	using std::cerr;
+	using std::endl;
+
+#if GLM_ARCH & GLM_ARCH_AVX2
+	const char* arch = GLM_HAS_FMA ? "AVX2+FMA" : "AVX2";
+#elif GLM_ARCH & GLM_ARCH_AVX
+	const char* arch = "AVX";
+#else
+	const char* arch = "SSE2";
+#endif
+	cout << "fmat4x4SIMD built for " << arch << ", times in ns per matrix" << endl;
+
+	bool failed = false;
+	if (!check_operators()) {
+		cerr << "fmat4x4SIMD *= or /= disagrees with glm::mat4" << endl;
+		failed = true;
+	}
+
+	const size_t batch_sizes[] = { 64, 1024, 16 * 1024, 256 * 1024 };
+	const Workload workloads[] = { MATRIX_PRODUCT, MATRIX_INVERSE, MATRIX_TRANSPOSE, MATRIX_VECTOR };
+	std::printf("%-10s %8s %10s %10s %8s %10s\n", "workload", "batch", "pure", "simd", "speedup", "error");
+	for (size_t s = 0; s < sizeof(batch_sizes) / sizeof(batch_sizes[0]); ++s) {
+		Batch batch;
+		make_batch(batch_sizes[s], batch);
+		for (size_t w = 0; w < sizeof(workloads) / sizeof(workloads[0]); ++w) {
+			Workload workload = workloads[w];
+			double pure_time = time_run(run_pure, workload, batch);
+			double simd_time = time_run(run_simd, workload, batch);
+			float error = relative_error(workload, batch);
+			float tolerance = workload == MATRIX_INVERSE ? INVERSE_TOLERANCE : PRODUCT_TOLERANCE;
+			std::printf("%-10s %8u %10.2f %10.2f %7.2fx %10.2e\n", workload_name(workload), static_cast<unsigned int>(batch_sizes[s]),
+				pure_time, simd_time, pure_time / simd_time, error);
+			if (!(error <= tolerance)) {
+				cerr << workload_name(workload) << ": SIMD result differs from glm::mat4 by " << error << endl;
+				failed = true;
+			}
+		}
+	}
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
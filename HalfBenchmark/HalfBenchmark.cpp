@@ -0,0 +1,206 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include "Benchmark.h"
+#include "HalfFloat.h"
+#include "MathDispatch.h"
+#include "Parallel.h"
+
+/* Times float to half conversions and back through every path of
+HalfFloat.h: glm::packHalf1x16 and unpackHalf1x16 one value at a time, the
+kernels of each level this CPU has on one thread, then the shared thread
+pool. Every path must give the same bits as the table kernels, and those
+must match glm: the halves may only differ from packHalf1x16 on ties, which
+glm rounds away from zero, and the floats only by the quiet bit of NaNs.
+The program fails otherwise */
+
+namespace {
+
+//Values converted per timing, whatever the array size
+const size_t WORK_PER_RUN = 1 << 24;
+//Best of these many runs is reported
+const int RUN_COUNT = 5;
+//Quiet bit of a float NaN
+const glm::uint32 QUIET_NAN = 0x00400000;
+
+enum Direction {
+	TO_HALF,
+	TO_FLOAT,
+};
+
+const char* direction_name(Direction direction) {
+	return direction == TO_HALF ? "to half" : "to float";
+}
+
+glm::uint32 float_bits(float value) {
+	glm::uint32 bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+/* Pixels of an HDR image: magnitudes spread evenly in log scale from 2^-26
+to 2^17, under the smallest half denormal and over the largest half, some
+negative. Every kind of half comes out */
+std::vector<float> hdr_values(size_t count) {
+	std::mt19937 random(static_cast<unsigned int>(count));
+	std::uniform_real_distribution<float> exponent(-26.0f, 17.0f);
+	std::vector<float> values(count);
+	for (size_t i = 0; i < count; ++i) {
+		float value = std::exp2(exponent(random));
+		values[i] = random() % 8 == 0 ? -value : value;
+	}
+	return values;
+}
+
+struct Arrays {
+	std::vector<float> floats;
+	std::vector<glm::uint16> halfs;
+	std::vector<float> floats_out;
+	std::vector<glm::uint16> halfs_out;
+};
+
+void convert_glm(Direction direction, Arrays& arrays) {
+	if (direction == TO_HALF) {
+		for (size_t i = 0; i < arrays.floats.size(); ++i) {
+			arrays.halfs_out[i] = glm::packHalf1x16(arrays.floats[i]);
+		}
+	} else {
+		for (size_t i = 0; i < arrays.halfs.size(); ++i) {
+			arrays.floats_out[i] = glm::unpackHalf1x16(arrays.halfs[i]);
+		}
+	}
+}
+
+//The kernels of one level on the calling thread
+void convert_kernels(const MathKernels& kernels, Direction direction, Arrays& arrays) {
+	if (direction == TO_HALF) {
+		kernels.pack_halfs(arrays.floats.data(), arrays.halfs_out.data(), arrays.floats.size());
+	} else {
+		kernels.unpack_halfs(arrays.halfs.data(), arrays.floats_out.data(), arrays.halfs.size());
+	}
+}
+
+//Best kernels over the shared thread pool
+void convert_threaded(Direction direction, Arrays& arrays) {
+	if (direction == TO_HALF) {
+		to_halfs(arrays.floats.data(), arrays.halfs_out.data(), arrays.floats.size());
+	} else {
+		to_floats(arrays.halfs.data(), arrays.floats_out.data(), arrays.halfs.size());
+	}
+}
+
+/* Halves differing from packHalf1x16 that are not ties, where both are
+exactly as far from the float. The ties are counted in ties */
+size_t count_glm_half_errors(const std::vector<float>& floats, const std::vector<glm::uint16>& expected, const std::vector<glm::uint16>& got,
+	size_t& ties) {
+	size_t errors = 0;
+	ties = 0;
+	for (size_t i = 0; i < floats.size(); ++i) {
+		if (expected[i] == got[i]) {
+			continue;
+		}
+		double value = floats[i];
+		double a = glm::unpackHalf1x16(expected[i]);
+		double b = glm::unpackHalf1x16(got[i]);
+		if (std::abs(value - a) == std::abs(value - b) && a != b) {
+			++ties;
+		} else if (!(std::isnan(value) && std::isnan(b))) {
+			++errors;
+		}
+	}
+	return errors;
+}
+
+//Every half through unpack_halfs against unpackHalf1x16, NaNs may only gain the quiet bit
+size_t count_glm_float_errors(const MathKernels& kernels) {
+	std::vector<glm::uint16> halfs(65536);
+	for (size_t i = 0; i < halfs.size(); ++i) {
+		halfs[i] = glm::uint16(i);
+	}
+	std::vector<float> floats(halfs.size());
+	kernels.unpack_halfs(halfs.data(), floats.data(), halfs.size());
+	size_t errors = 0;
+	for (size_t i = 0; i < halfs.size(); ++i) {
+		glm::uint32 expected = float_bits(glm::unpackHalf1x16(halfs[i]));
+		glm::uint32 got = float_bits(floats[i]);
+		bool nan = std::isnan(floats[i]);
+		if (got != expected && !(nan && got == (expected | QUIET_NAN))) {
+			++errors;
+		}
+	}
+	return errors;
+}
+
+}//namespace
+
+int main() {
+	using std::cout;
+	using std::cerr;
+	using std::endl;
+
+	const MathKernels& reference = math_kernels(CPU_SSE2);
+	cout << ThreadPool::shared().size() << " threads, times in ns per value" << endl;
+	bool failed = false;
+	size_t float_errors = count_glm_float_errors(reference);
+	if (float_errors != 0) {
+		cerr << "The table kernels unpack " << float_errors << " halves unlike glm" << endl;
+		failed = true;
+	}
+
+	const size_t sizes[] = { 1 << 16, 1 << 20, 1 << 24 };
+	const Direction directions[] = { TO_HALF, TO_FLOAT };
+	std::printf("%-8s %8s %-8s %10s %8s %12s\n", "", "values", "path", "time", "speedup", "differences");
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+		const size_t count = sizes[s];
+		Arrays arrays;
+		arrays.floats = hdr_values(count);
+		arrays.halfs.resize(count);
+		reference.pack_halfs(arrays.floats.data(), arrays.halfs.data(), count);
+		arrays.floats_out.resize(count);
+		arrays.halfs_out.resize(count);
+		for (size_t d = 0; d < sizeof(directions) / sizeof(directions[0]); ++d) {
+			Direction direction = directions[d];
+			double glm_time = time_run([&]() { convert_glm(direction, arrays); }, count, RUN_COUNT, WORK_PER_RUN);
+			if (direction == TO_HALF) {
+				size_t ties = 0;
+				size_t errors = count_glm_half_errors(arrays.floats, arrays.halfs_out, arrays.halfs, ties);
+				if (errors != 0) {
+					cerr << "The table kernels round " << errors << " values unlike glm" << endl;
+					failed = true;
+				}
+				std::printf("%-8s %8u %-8s %10.2f %8s %12u ties\n", direction_name(direction), static_cast<unsigned int>(count), "glm",
+					glm_time, "", static_cast<unsigned int>(ties));
+			} else {
+				std::printf("%-8s %8u %-8s %10.2f\n", direction_name(direction), static_cast<unsigned int>(count), "glm", glm_time);
+			}
+			for_each_path([&](const char* path, const MathKernels* kernels) {
+				double time = kernels
+					? time_run([&]() { convert_kernels(*kernels, direction, arrays); }, count, RUN_COUNT, WORK_PER_RUN)
+					: time_run([&]() { convert_threaded(direction, arrays); }, count, RUN_COUNT, WORK_PER_RUN);
+				size_t differences = 0;
+				if (direction == TO_HALF) {
+					differences = count_differences(arrays.halfs, arrays.halfs_out);
+				} else {
+					std::vector<float> expected(count);
+					reference.unpack_halfs(arrays.halfs.data(), expected.data(), count);
+					differences = count_differences(expected, arrays.floats_out);
+				}
+				std::printf("%-8s %8u %-8s %10.2f %7.2fx %12u\n", direction_name(direction), static_cast<unsigned int>(count), path,
+					time, glm_time / time, static_cast<unsigned int>(differences));
+				if (differences != 0) {
+					cerr << direction_name(direction) << " " << path << ": " << differences << " values differ from the table kernels" << endl;
+					failed = true;
+				}
+			});
+		}
+	}
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
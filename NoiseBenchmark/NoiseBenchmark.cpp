@@ -0,0 +1,141 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/noise.hpp>
+
+#include "Benchmark.h"
+#include "MathDispatch.h"
+#include "Noise.h"
+#include "Parallel.h"
+
+/* Times fractal noise grids through every path of Noise.h: glm::perlin and
+glm::simplex one sample at a time, the row kernels of each level this CPU
+has on one thread, then noise_grid on the shared thread pool. Every grid is
+checked against the glm one and the program fails when they disagree */
+
+namespace {
+
+//Best of these many runs is reported, glm runs once
+const int RUN_COUNT = 3;
+//Absolute, on sums within +-2
+const float TOLERANCE = 1e-4f;
+
+struct Grid {
+	const char* name;
+	unsigned int width;
+	unsigned int height;
+	unsigned int depth;
+	//2 for a heightmap, 3 for a 3D texture, 4 for a slice of 4D noise
+	int dimensions;
+};
+
+const Grid GRIDS[] = {
+	{ "2D", 256, 256, 1, 2 },
+	{ "3D", 64, 64, 16, 3 },
+	{ "4D", 32, 32, 32, 4 },
+};
+//w of the 4D slice
+const float SLICE_W = 0.375f;
+
+const char* noise_name(NoiseType type) {
+	return type == NOISE_SIMPLEX ? "simplex" : "Perlin";
+}
+
+//Where Noise.h starts a row, x then moves by frequency / width
+glm::vec4 row_origin(const FractalNoise& noise, const Grid& grid, size_t row) {
+	return glm::vec4(0.0f, noise.frequency * float(row % grid.height) / float(grid.height),
+		noise.frequency * float(row / grid.height) / float(grid.depth), noise.frequency * (grid.dimensions == 4 ? SLICE_W : 0.0f));
+}
+
+float glm_noise(NoiseType type, int dimensions, const glm::vec4& p) {
+	if (dimensions == 2) {
+		return type == NOISE_SIMPLEX ? glm::simplex(glm::vec2(p)) : glm::perlin(glm::vec2(p));
+	}
+	if (dimensions == 3) {
+		return type == NOISE_SIMPLEX ? glm::simplex(glm::vec3(p)) : glm::perlin(glm::vec3(p));
+	}
+	return type == NOISE_SIMPLEX ? glm::simplex(p) : glm::perlin(p);
+}
+
+//One sample at a time with the glm functions, what the kernels must match
+void grid_glm(const FractalNoise& noise, const Grid& grid, std::vector<float>& out) {
+	const float step = noise.frequency / float(grid.width);
+	for (size_t row = 0; row < size_t(grid.height) * grid.depth; ++row) {
+		glm::vec4 origin = row_origin(noise, grid, row);
+		for (unsigned int x = 0; x < grid.width; ++x) {
+			glm::vec4 p(origin.x + float(x) * step, origin.y, origin.z, origin.w);
+			float sum = 0.0f;
+			float frequency = 1.0f;
+			float amplitude = 1.0f;
+			for (unsigned int o = 0; o < noise.octaves; ++o) {
+				sum += amplitude * glm_noise(noise.type, grid.dimensions, p * frequency);
+				frequency *= noise.lacunarity;
+				amplitude *= noise.gain;
+			}
+			out[row * grid.width + x] = sum;
+		}
+	}
+}
+
+//The row kernels of one level on the calling thread
+void grid_kernels(const MathKernels& kernels, const FractalNoise& noise, const Grid& grid, std::vector<float>& out) {
+	const float step = noise.frequency / float(grid.width);
+	for (size_t row = 0; row < size_t(grid.height) * grid.depth; ++row) {
+		glm::vec4 origin = row_origin(noise, grid, row);
+		(noise.type == NOISE_SIMPLEX ? kernels.simplex_row : kernels.perlin_row)(&origin[0], grid.dimensions, step, grid.width,
+			int(noise.octaves), noise.lacunarity, noise.gain, &out[row * grid.width]);
+	}
+}
+
+//Best kernels over the shared thread pool
+void grid_threaded(const FractalNoise& noise, const Grid& grid, std::vector<float>& out) {
+	if (grid.dimensions == 2) {
+		out = noise_grid(noise, grid.width, grid.height);
+	} else if (grid.dimensions == 3) {
+		out = noise_grid(noise, grid.width, grid.height, grid.depth);
+	} else {
+		out = noise_grid(noise, grid.width, grid.height, grid.depth, SLICE_W);
+	}
+}
+
+}//namespace
+
+int main() {
+	using std::cout;
+	using std::cerr;
+	using std::endl;
+
+	const NoiseType types[] = { NOISE_PERLIN, NOISE_SIMPLEX };
+	cout << ThreadPool::shared().size() << " threads, times in ns per sample and octave" << endl;
+	bool failed = false;
+	std::printf("%-8s %-3s %8s %-8s %10s %8s %10s\n", "noise", "", "samples", "path", "time", "speedup", "error");
+	for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); ++t) {
+		FractalNoise noise = { types[t], 6, 4.0f, 2.0f, 0.5f };
+		for (size_t g = 0; g < sizeof(GRIDS) / sizeof(GRIDS[0]); ++g) {
+			const Grid& grid = GRIDS[g];
+			const size_t samples = size_t(grid.width) * grid.height * grid.depth;
+			const size_t work = samples * noise.octaves;
+			std::vector<float> expected(samples);
+			std::vector<float> got(samples);
+			double glm_time = time_run([&]() { grid_glm(noise, grid, expected); }, work, 1);
+			std::printf("%-8s %-3s %8u %-8s %10.2f\n", noise_name(noise.type), grid.name, static_cast<unsigned int>(samples), "glm", glm_time);
+			for_each_path([&](const char* path, const MathKernels* kernels) {
+				double time = kernels
+					? time_run([&]() { grid_kernels(*kernels, noise, grid, got); }, work, RUN_COUNT)
+					: time_run([&]() { grid_threaded(noise, grid, got); }, work, RUN_COUNT);
+				float error = max_error(samples, [&](size_t i) { return std::abs(expected[i] - got[i]); });
+				std::printf("%-8s %-3s %8u %-8s %10.2f %7.2fx %10.2e\n", noise_name(noise.type), grid.name, static_cast<unsigned int>(samples), path,
+					time, glm_time / time, error);
+				if (!(error <= TOLERANCE)) {
+					cerr << noise_name(noise.type) << " " << grid.name << " " << path << ": result differs from glm by " << error << endl;
+					failed = true;
+				}
+			});
+		}
+	}
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,337 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include "Benchmark.h"
+#include "MathDispatch.h"
+#include "Parallel.h"
+#include "VectorPacking.h"
+
+/* Times the packed vertex formats of glm/gtc/packing.hpp both ways through
+every path of VectorPacking.h: the glm functions one vector at a time, the
+kernels of each level this CPU has on one thread, then the shared thread
+pool. Every path must give the bits of glm, for vectors spread past the
+clamp range with NaNs, infinities and exact halves among them, and for
+packed vectors of random bits. The program fails otherwise */
+
+namespace {
+
+//Vectors converted per timing, whatever the array size
+const size_t WORK_PER_RUN = 1 << 22;
+//Best of these many runs is reported
+const int RUN_COUNT = 5;
+
+const PackFormat FORMATS[] = {
+	PACK_UNORM_1X8,
+	PACK_SNORM_1X8,
+	PACK_UNORM_2X8,
+	PACK_SNORM_2X8,
+	PACK_UNORM_4X8,
+	PACK_SNORM_4X8,
+	PACK_UNORM_1X16,
+	PACK_SNORM_1X16,
+	PACK_UNORM_2X16,
+	PACK_SNORM_2X16,
+	PACK_UNORM_4X16,
+	PACK_SNORM_4X16,
+	PACK_I3X10_1X2,
+	PACK_U3X10_1X2,
+	PACK_UNORM_3X10_1X2,
+	PACK_SNORM_3X10_1X2,
+	PACK_F2X11_1X10,
+};
+
+const char* format_name(PackFormat format) {
+	switch (format) {
+	case PACK_UNORM_1X8:
+		return "Unorm1x8";
+	case PACK_SNORM_1X8:
+		return "Snorm1x8";
+	case PACK_UNORM_2X8:
+		return "Unorm2x8";
+	case PACK_SNORM_2X8:
+		return "Snorm2x8";
+	case PACK_UNORM_4X8:
+		return "Unorm4x8";
+	case PACK_SNORM_4X8:
+		return "Snorm4x8";
+	case PACK_UNORM_1X16:
+		return "Unorm1x16";
+	case PACK_SNORM_1X16:
+		return "Snorm1x16";
+	case PACK_UNORM_2X16:
+		return "Unorm2x16";
+	case PACK_SNORM_2X16:
+		return "Snorm2x16";
+	case PACK_UNORM_4X16:
+		return "Unorm4x16";
+	case PACK_SNORM_4X16:
+		return "Snorm4x16";
+	case PACK_I3X10_1X2:
+		return "I3x10_1x2";
+	case PACK_U3X10_1X2:
+		return "U3x10_1x2";
+	case PACK_UNORM_3X10_1X2:
+		return "Unorm3x10_1x2";
+	case PACK_SNORM_3X10_1X2:
+		return "Snorm3x10_1x2";
+	default:
+		return "F2x11_1x10";
+	}
+}
+
+enum Direction {
+	PACK,
+	UNPACK,
+};
+
+const char* direction_name(Direction direction) {
+	return direction == PACK ? "pack" : "unpack";
+}
+
+/* Components mostly within [-1.25, 1.25], one in eight a value the
+rounding or the clamp is touchy about. The float formats see the same
+values scaled up to their whole range. The integer formats get ints past
+their 10 bits fields, one in eight of any size, stored in place of the floats */
+std::vector<float> vector_values(PackFormat format, size_t count) {
+	const float specials[] = {
+		0.0f, -0.0f, 1.0f, -1.0f, 0.5f / 255.0f, 0.5f / 127.0f, 0.5f / 1023.0f, 0.5f / 511.0f, 1.5f / 65535.0f, 0.5f / 32767.0f,
+		6.103515625e-05f, 65024.0f, 65536.0f, 1e30f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+		std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::denorm_min(),
+	};
+	std::mt19937 random(static_cast<unsigned int>(count + format));
+	std::uniform_real_distribution<float> value(-1.25f, 1.25f);
+	std::uniform_real_distribution<float> exponent(-24.0f, 17.0f);
+	std::vector<float> values(count * pack_components(format));
+	const bool integers = format == PACK_I3X10_1X2 || format == PACK_U3X10_1X2;
+	for (size_t i = 0; i < values.size(); ++i) {
+		if (integers) {
+			glm::int32 component = random() % 8 == 0 ? static_cast<glm::int32>(random()) : static_cast<glm::int32>(random() % 2048) - 1024;
+			std::memcpy(&values[i], &component, sizeof(component));
+		} else if (random() % 8 == 0) {
+			values[i] = specials[random() % (sizeof(specials) / sizeof(specials[0]))];
+		} else if (format == PACK_F2X11_1X10) {
+			values[i] = std::exp2(exponent(random));
+		} else {
+			values[i] = value(random);
+		}
+	}
+	return values;
+}
+
+std::vector<unsigned char> packed_values(PackFormat format, size_t count) {
+	std::mt19937 random(static_cast<unsigned int>(count + format));
+	std::vector<unsigned char> bytes(count * packed_size(format));
+	for (size_t i = 0; i < bytes.size(); ++i) {
+		bytes[i] = static_cast<unsigned char>(random());
+	}
+	return bytes;
+}
+
+template <typename Vector, typename Packed, typename Pack>
+void pack_each(const void* in, void* out, size_t count, Pack pack) {
+	const Vector* vin = static_cast<const Vector*>(in);
+	Packed* pout = static_cast<Packed*>(out);
+	for (size_t i = 0; i < count; ++i) {
+		pout[i] = pack(vin[i]);
+	}
+}
+
+template <typename Packed, typename Vector, typename Unpack>
+void unpack_each(const void* in, void* out, size_t count, Unpack unpack) {
+	const Packed* pin = static_cast<const Packed*>(in);
+	Vector* vout = static_cast<Vector*>(out);
+	for (size_t i = 0; i < count; ++i) {
+		vout[i] = unpack(pin[i]);
+	}
+}
+
+//One vector at a time with the glm functions, what the kernels must match
+void pack_glm(PackFormat format, const void* in, void* out, size_t count) {
+	switch (format) {
+	case PACK_UNORM_1X8:
+		pack_each<float, glm::uint8>(in, out, count, [](float v) { return glm::packUnorm1x8(v); });
+		break;
+	case PACK_SNORM_1X8:
+		pack_each<float, glm::uint8>(in, out, count, [](float v) { return glm::packSnorm1x8(v); });
+		break;
+	case PACK_UNORM_2X8:
+		pack_each<glm::vec2, glm::uint16>(in, out, count, [](const glm::vec2& v) { return glm::packUnorm2x8(v); });
+		break;
+	case PACK_SNORM_2X8:
+		pack_each<glm::vec2, glm::uint16>(in, out, count, [](const glm::vec2& v) { return glm::packSnorm2x8(v); });
+		break;
+	case PACK_UNORM_4X8:
+		pack_each<glm::vec4, glm::uint32>(in, out, count, [](const glm::vec4& v) { return glm::packUnorm4x8(v); });
+		break;
+	case PACK_SNORM_4X8:
+		pack_each<glm::vec4, glm::uint32>(in, out, count, [](const glm::vec4& v) { return glm::packSnorm4x8(v); });
+		break;
+	case PACK_UNORM_1X16:
+		pack_each<float, glm::uint16>(in, out, count, [](float v) { return glm::packUnorm1x16(v); });
+		break;
+	case PACK_SNORM_1X16:
+		pack_each<float, glm::uint16>(in, out, count, [](float v) { return glm::packSnorm1x16(v); });
+		break;
+	case PACK_UNORM_2X16:
+		pack_each<glm::vec2, glm::uint32>(in, out, count, [](const glm::vec2& v) { return glm::packUnorm2x16(v); });
+		break;
+	case PACK_SNORM_2X16:
+		pack_each<glm::vec2, glm::uint32>(in, out, count, [](const glm::vec2& v) { return glm::packSnorm2x16(v); });
+		break;
+	case PACK_UNORM_4X16:
+		pack_each<glm::vec4, glm::uint64>(in, out, count, [](const glm::vec4& v) { return glm::packUnorm4x16(v); });
+		break;
+	case PACK_SNORM_4X16:
+		pack_each<glm::vec4, glm::uint64>(in, out, count, [](const glm::vec4& v) { return glm::packSnorm4x16(v); });
+		break;
+	case PACK_I3X10_1X2:
+		pack_each<glm::ivec4, glm::uint32>(in, out, count, [](const glm::ivec4& v) { return glm::packI3x10_1x2(v); });
+		break;
+	case PACK_U3X10_1X2:
+		pack_each<glm::uvec4, glm::uint32>(in, out, count, [](const glm::uvec4& v) { return glm::packU3x10_1x2(v); });
+		break;
+	case PACK_UNORM_3X10_1X2:
+		pack_each<glm::vec4, glm::uint32>(in, out, count, [](const glm::vec4& v) { return glm::packUnorm3x10_1x2(v); });
+		break;
+	case PACK_SNORM_3X10_1X2:
+		pack_each<glm::vec4, glm::uint32>(in, out, count, [](const glm::vec4& v) { return glm::packSnorm3x10_1x2(v); });
+		break;
+	case PACK_F2X11_1X10:
+		pack_each<glm::vec3, glm::uint32>(in, out, count, [](const glm::vec3& v) { return glm::packF2x11_1x10(v); });
+		break;
+	}
+}
+
+void unpack_glm(PackFormat format, const void* in, void* out, size_t count) {
+	switch (format) {
+	case PACK_UNORM_1X8:
+		unpack_each<glm::uint8, float>(in, out, count, [](glm::uint8 p) { return glm::unpackUnorm1x8(p); });
+		break;
+	case PACK_SNORM_1X8:
+		unpack_each<glm::uint8, float>(in, out, count, [](glm::uint8 p) { return glm::unpackSnorm1x8(p); });
+		break;
+	case PACK_UNORM_2X8:
+		unpack_each<glm::uint16, glm::vec2>(in, out, count, [](glm::uint16 p) { return glm::unpackUnorm2x8(p); });
+		break;
+	case PACK_SNORM_2X8:
+		unpack_each<glm::uint16, glm::vec2>(in, out, count, [](glm::uint16 p) { return glm::unpackSnorm2x8(p); });
+		break;
+	case PACK_UNORM_4X8:
+		unpack_each<glm::uint32, glm::vec4>(in, out, count, [](glm::uint32 p) { return glm::unpackUnorm4x8(p); });
+		break;
+	case PACK_SNORM_4X8:
+		unpack_each<glm::uint32, glm::vec4>(in, out, count, [](glm::uint32 p) { return glm::unpackSnorm4x8(p); });
+		break;
+	case PACK_UNORM_1X16:
+		unpack_each<glm::uint16, float>(in, out, count, [](glm::uint16 p) { return glm::unpackUnorm1x16(p); });
+		break;
+	case PACK_SNORM_1X16:
+		unpack_each<glm::uint16, float>(in, out, count, [](glm::uint16 p) { return glm::unpackSnorm1x16(p); });
+		break;
+	case PACK_UNORM_2X16:
+		unpack_each<glm::uint32, glm::vec2>(in, out, count, [](glm::uint32 p) { return glm::unpackUnorm2x16(p); });
+		break;
+	case PACK_SNORM_2X16:
+		unpack_each<glm::uint32, glm::vec2>(in, out, count, [](glm::uint32 p) { return glm::unpackSnorm2x16(p); });
+		break;
+	case PACK_UNORM_4X16:
+		unpack_each<glm::uint64, glm::vec4>(in, out, count, [](glm::uint64 p) { return glm::unpackUnorm4x16(p); });
+		break;
+	case PACK_SNORM_4X16:
+		unpack_each<glm::uint64, glm::vec4>(in, out, count, [](glm::uint64 p) { return glm::unpackSnorm4x16(p); });
+		break;
+	case PACK_I3X10_1X2:
+		unpack_each<glm::uint32, glm::ivec4>(in, out, count, [](glm::uint32 p) { return glm::unpackI3x10_1x2(p); });
+		break;
+	case PACK_U3X10_1X2:
+		unpack_each<glm::uint32, glm::uvec4>(in, out, count, [](glm::uint32 p) { return glm::unpackU3x10_1x2(p); });
+		break;
+	case PACK_UNORM_3X10_1X2:
+		unpack_each<glm::uint32, glm::vec4>(in, out, count, [](glm::uint32 p) { return glm::unpackUnorm3x10_1x2(p); });
+		break;
+	case PACK_SNORM_3X10_1X2:
+		unpack_each<glm::uint32, glm::vec4>(in, out, count, [](glm::uint32 p) { return glm::unpackSnorm3x10_1x2(p); });
+		break;
+	case PACK_F2X11_1X10:
+		unpack_each<glm::uint32, glm::vec3>(in, out, count, [](glm::uint32 p) { return glm::unpackF2x11_1x10(p); });
+		break;
+	}
+}
+
+struct Arrays {
+	std::vector<float> vectors;
+	std::vector<unsigned char> packed;
+	std::vector<float> vectors_out;
+	std::vector<unsigned char> packed_out;
+};
+
+}//namespace
+
+int main() {
+	using std::cout;
+	using std::cerr;
+	using std::endl;
+
+	cout << ThreadPool::shared().size() << " threads, times in ns per vector" << endl;
+	bool failed = false;
+	//Odd sizes leave a tail to every loop of the kernels
+	const size_t sizes[] = { 1 << 16, (1 << 20) + 3 };
+	const Direction directions[] = { PACK, UNPACK };
+	std::printf("%-14s %-6s %8s %-8s %10s %8s %12s\n", "format", "", "vectors", "path", "time", "speedup", "differences");
+	for (size_t f = 0; f < sizeof(FORMATS) / sizeof(FORMATS[0]); ++f) {
+		const PackFormat format = FORMATS[f];
+		for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+			const size_t count = sizes[s];
+			Arrays arrays;
+			arrays.vectors = vector_values(format, count);
+			arrays.packed = packed_values(format, count);
+			arrays.vectors_out.resize(arrays.vectors.size());
+			arrays.packed_out.resize(arrays.packed.size());
+			for (size_t d = 0; d < sizeof(directions) / sizeof(directions[0]); ++d) {
+				Direction direction = directions[d];
+				std::vector<unsigned char> expected_packed(arrays.packed.size());
+				std::vector<float> expected_vectors(arrays.vectors.size());
+				double glm_time = 0.0;
+				if (direction == PACK) {
+					glm_time = time_run([&]() { pack_glm(format, arrays.vectors.data(), expected_packed.data(), count); }, count, RUN_COUNT, WORK_PER_RUN);
+				} else {
+					glm_time = time_run([&]() { unpack_glm(format, arrays.packed.data(), expected_vectors.data(), count); }, count, RUN_COUNT, WORK_PER_RUN);
+				}
+				std::printf("%-14s %-6s %8u %-8s %10.2f\n", format_name(format), direction_name(direction), static_cast<unsigned int>(count),
+					"glm", glm_time);
+				for_each_path([&](const char* path, const MathKernels* kernels) {
+					double time = 0.0;
+					if (kernels && direction == PACK) {
+						time = time_run([&]() { kernels->pack_vectors(format, arrays.vectors.data(), arrays.packed_out.data(), count); }, count, RUN_COUNT, WORK_PER_RUN);
+					} else if (kernels) {
+						time = time_run([&]() { kernels->unpack_vectors(format, arrays.packed.data(), arrays.vectors_out.data(), count); }, count, RUN_COUNT, WORK_PER_RUN);
+					} else if (direction == PACK) {
+						time = time_run([&]() { pack_array(format, arrays.vectors.data(), arrays.packed_out.data(), count); }, count, RUN_COUNT, WORK_PER_RUN);
+					} else {
+						time = time_run([&]() { unpack_array(format, arrays.packed.data(), arrays.vectors_out.data(), count); }, count, RUN_COUNT, WORK_PER_RUN);
+					}
+					size_t differences = direction == PACK
+						? count_differences(expected_packed.data(), arrays.packed_out.data(), count, packed_size(format))
+						: count_differences(expected_vectors.data(), arrays.vectors_out.data(), count, pack_components(format) * sizeof(float));
+					std::printf("%-14s %-6s %8u %-8s %10.2f %7.2fx %12u\n", format_name(format), direction_name(direction),
+						static_cast<unsigned int>(count), path, time, glm_time / time, static_cast<unsigned int>(differences));
+					if (differences != 0) {
+						cerr << format_name(format) << " " << direction_name(direction) << " " << path << ": " << differences
+							<< " vectors differ from glm" << endl;
+						failed = true;
+					}
+				});
+			}
+		}
+	}
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
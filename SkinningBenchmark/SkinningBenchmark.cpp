@@ -0,0 +1,183 @@
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtx/dual_quaternion.hpp>
+
+#include "Benchmark.h"
+#include "MathDispatch.h"
+#include "Mesh.h"
+#include "MeshAttributes.h"
+#include "Parallel.h"
+#include "Skinning.h"
+
+/* Times dual quaternion skinning (DLB) against linear blend skinning with
+matrices, through every CPU path of Skinning.h: glm one vertex at a time,
+the kernels of each level this CPU has on one thread, then the shared
+thread pool. Every result is checked against the glm one and the program
+fails when they disagree. The GPU path reads the same palette, so the bytes
+per bone printed first are also what a frame uploads */
+
+namespace {
+
+//Vertices skinned per timing, whatever the mesh size
+const size_t WORK_PER_RUN = 1 << 22;
+//Best of these many runs is reported
+const int RUN_COUNT = 5;
+const unsigned int BONE_COUNT = 64;
+//Half a turn from the bottom of the chain to the top
+const float TWIST = 3.14159265f;
+//Few enough bones that the collapse of blended matrices shows
+const unsigned int TWIST_BONE_COUNT = 4;
+const float BEND = 1.0f;
+//Absolute, the meshes fit the unit sphere
+const float TOLERANCE = 1e-5f;
+
+enum Method {
+	DUAL_QUATERNIONS,
+	MATRICES,
+};
+
+const char* method_name(Method method) {
+	return method == DUAL_QUATERNIONS ? "DLB" : "LBS";
+}
+
+struct Pose {
+	std::vector<glm::fdualquat> dual_quaternions;
+	std::vector<glm::mat4> matrices;
+};
+
+struct Skinned {
+	std::vector<glm::vec3> positions;
+	std::vector<glm::vec3> normals;
+};
+
+//One vertex at a time with the glm types, what the kernels must match
+void skin_glm(Method method, const SkinnedMesh& mesh, const Pose& pose, Skinned& out) {
+	for (size_t i = 0; i < mesh.positions.size(); ++i) {
+		const glm::u16vec4& joints = mesh.joints[i];
+		const glm::vec4& weights = mesh.weights[i];
+		if (method == DUAL_QUATERNIONS) {
+			const glm::fdualquat& first = pose.dual_quaternions[joints[0]];
+			glm::quat real = first.real * weights[0];
+			glm::quat dual = first.dual * weights[0];
+			for (int k = 1; k < 4; ++k) {
+				const glm::fdualquat& bone = pose.dual_quaternions[joints[k]];
+				float weight = glm::dot(bone.real, first.real) < 0.0f ? -weights[k] : weights[k];
+				real = real + bone.real * weight;
+				dual = dual + bone.dual * weight;
+			}
+			float length = glm::length(real);
+			glm::fdualquat blended(real / length, dual / length);
+			out.positions[i] = blended * mesh.positions[i];
+			out.normals[i] = blended.real * mesh.normals[i];
+		} else {
+			glm::mat4 blended = pose.matrices[joints[0]] * weights[0];
+			for (int k = 1; k < 4; ++k) {
+				blended += pose.matrices[joints[k]] * weights[k];
+			}
+			out.positions[i] = glm::vec3(blended * glm::vec4(mesh.positions[i], 1.0f));
+			out.normals[i] = glm::mat3(blended) * mesh.normals[i];
+		}
+	}
+}
+
+//The kernels of one level on the calling thread
+void skin_kernels(const MathKernels& kernels, Method method, const SkinnedMesh& mesh, const Pose& pose, Skinned& out) {
+	const float* bones = method == DUAL_QUATERNIONS ? &pose.dual_quaternions[0].real.x : &pose.matrices[0][0][0];
+	(method == DUAL_QUATERNIONS ? kernels.skin_dual_quaternions : kernels.skin_matrices)(bones,
+		&mesh.joints[0][0], &mesh.weights[0][0], &mesh.positions[0][0], &mesh.normals[0][0],
+		&out.positions[0][0], &out.normals[0][0], mesh.positions.size());
+}
+
+//Best kernels over the shared thread pool
+void skin_threaded(Method method, const SkinnedMesh& mesh, const Pose& pose, Skinned& out) {
+	if (method == DUAL_QUATERNIONS) {
+		skin_dual_quaternions(mesh, pose.dual_quaternions.data(), out.positions.data(), out.normals.data());
+	} else {
+		skin_matrices(mesh, pose.matrices.data(), out.positions.data(), out.normals.data());
+	}
+}
+
+//Average distance to the y axis, the twist must not change it
+double mean_radius(const std::vector<glm::vec3>& positions) {
+	double sum = 0.0;
+	for (size_t i = 0; i < positions.size(); ++i) {
+		sum += glm::length(glm::vec2(positions[i].x, positions[i].z));
+	}
+	return positions.empty() ? 0.0 : sum / double(positions.size());
+}
+
+}//namespace
+
+int main() {
+	using std::cout;
+	using std::cerr;
+	using std::endl;
+
+	cout << BONE_COUNT << " bones, " << sizeof(glm::fdualquat) << " bytes per dual quaternion against " << sizeof(glm::mat4)
+		<< " per matrix. " << ThreadPool::shared().size() << " threads, times in ns per vertex" << endl;
+
+	Pose pose;
+	pose.dual_quaternions = pose_bone_chain(BONE_COUNT, TWIST, BEND);
+	for (size_t i = 0; i < pose.dual_quaternions.size(); ++i) {
+		pose.matrices.push_back(bone_matrix(pose.dual_quaternions[i]));
+	}
+
+	bool failed = false;
+	const unsigned int sphere_slices[] = { 64, 256, 1024 };
+	const Method methods[] = { DUAL_QUATERNIONS, MATRICES };
+	std::printf("%-6s %8s %-8s %10s %8s %10s\n", "method", "vertices", "path", "time", "speedup", "error");
+	for (size_t s = 0; s < sizeof(sphere_slices) / sizeof(sphere_slices[0]); ++s) {
+		Mesh sphere = create_sphere_mesh(sphere_slices[s], sphere_slices[s] / 2);
+		SkinnedMesh mesh = bind_to_bone_chain(sphere.vertices, compute_normals(sphere.vertices, sphere.indices), BONE_COUNT);
+		const size_t vertex_count = mesh.positions.size();
+		Skinned expected;
+		expected.positions.resize(vertex_count);
+		expected.normals.resize(vertex_count);
+		Skinned got = expected;
+		for (size_t m = 0; m < sizeof(methods) / sizeof(methods[0]); ++m) {
+			Method method = methods[m];
+			double glm_time = time_run([&]() { skin_glm(method, mesh, pose, expected); }, vertex_count, RUN_COUNT, WORK_PER_RUN);
+			std::printf("%-6s %8u %-8s %10.2f\n", method_name(method), static_cast<unsigned int>(vertex_count), "glm", glm_time);
+			for_each_path([&](const char* path, const MathKernels* kernels) {
+				double time = kernels
+					? time_run([&]() { skin_kernels(*kernels, method, mesh, pose, got); }, vertex_count, RUN_COUNT, WORK_PER_RUN)
+					: time_run([&]() { skin_threaded(method, mesh, pose, got); }, vertex_count, RUN_COUNT, WORK_PER_RUN);
+				//Largest distance between the expected and the computed positions or normals
+				float error = max_error(vertex_count, [&](size_t i) {
+					return glm::max(glm::distance(expected.positions[i], got.positions[i]), glm::distance(expected.normals[i], got.normals[i]));
+				});
+				std::printf("%-6s %8u %-8s %10.2f %7.2fx %10.2e\n", method_name(method), static_cast<unsigned int>(vertex_count), path,
+					time, glm_time / time, error);
+				if (!(error <= TOLERANCE)) {
+					cerr << method_name(method) << " " << path << ": result differs from glm by " << error << endl;
+					failed = true;
+				}
+			});
+		}
+	}
+
+	/* A short chain twisted alone: the dual quaternions turn the vertices
+	around it, the blended matrices pull them in between the bones */
+	Mesh sphere = create_sphere_mesh(256, 128);
+	SkinnedMesh mesh = bind_to_bone_chain(sphere.vertices, compute_normals(sphere.vertices, sphere.indices), TWIST_BONE_COUNT);
+	Pose twist;
+	twist.dual_quaternions = pose_bone_chain(TWIST_BONE_COUNT, TWIST, 0.0f);
+	for (size_t i = 0; i < twist.dual_quaternions.size(); ++i) {
+		twist.matrices.push_back(bone_matrix(twist.dual_quaternions[i]));
+	}
+	Skinned dual_quaternion_result;
+	dual_quaternion_result.positions.resize(mesh.positions.size());
+	dual_quaternion_result.normals.resize(mesh.positions.size());
+	Skinned matrix_result = dual_quaternion_result;
+	skin_threaded(DUAL_QUATERNIONS, mesh, twist, dual_quaternion_result);
+	skin_threaded(MATRICES, mesh, twist, matrix_result);
+	cout << "Mean distance to a chain of " << TWIST_BONE_COUNT << " bones twisted half a turn: bind pose " << mean_radius(mesh.positions)
+		<< ", DLB " << mean_radius(dual_quaternion_result.positions) << ", LBS " << mean_radius(matrix_result.positions) << endl;
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
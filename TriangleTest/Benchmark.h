@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "CpuFeatures.h"
+#include "MathDispatch.h"
+
+/* What the benchmark programs share: each one times glm one item at a time,
+then the same work through every path of the kernels, and checks that they
+agree with glm */
+
+/* Best of runs timings, in nanoseconds per item. run does count items, one
+timing calls it often enough to do about work_per_run of them, or once when
+work_per_run is zero */
+template <typename Run>
+double time_run(Run run, size_t count, int runs, size_t work_per_run = 0) {
+	const size_t repeats = std::max<size_t>(1, work_per_run / count);
+	double best = 0.0;
+	for (int r = 0; r < runs; ++r) {
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		for (size_t i = 0; i < repeats; ++i) {
+			run();
+		}
+		std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+		double per_item = elapsed.count() / static_cast<double>(repeats * count);
+		best = r == 0 ? per_item : std::min(best, per_item);
+	}
+	return best;
+}
+
+/* The paths compared to glm: visit(path, kernels) gets the kernels of every
+level this CPU runs, to use on the calling thread, then "threads" and null
+for the best kernels over the shared thread pool */
+template <typename Visit>
+void for_each_path(Visit visit) {
+	for (int level = CPU_SSE2; level <= CPU_AVX2; ++level) {
+		if (level <= cpu_level()) {
+			const MathKernels& kernels = math_kernels(CpuLevel(level));
+			visit(kernels.name, &kernels);
+		}
+	}
+	visit("threads", static_cast<const MathKernels*>(nullptr));
+}
+
+//Items whose size bytes are not the bits of the expected ones
+inline size_t count_differences(const void* expected, const void* got, size_t count, size_t size) {
+	const unsigned char* a = static_cast<const unsigned char*>(expected);
+	const unsigned char* b = static_cast<const unsigned char*>(got);
+	size_t differences = 0;
+	for (size_t i = 0; i < count; ++i) {
+		if (std::memcmp(a + i * size, b + i * size, size) != 0) {
+			++differences;
+		}
+	}
+	return differences;
+}
+
+template <typename T>
+size_t count_differences(const std::vector<T>& expected, const std::vector<T>& got) {
+	return count_differences(expected.data(), got.data(), expected.size(), sizeof(T));
+}
+
+//Largest error(i) of the count items, a NaN error is larger than any other
+template <typename Error>
+float max_error(size_t count, Error error) {
+	float worst = 0.0f;
+	for (size_t i = 0; i < count; ++i) {
+		float e = error(i);
+		if (!(e <= worst)) {
+			worst = e;
+		}
+	}
+	return worst;
+}
@@ -0,0 +1,556 @@
+#include "Bvh.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Parallel.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#	define BVH_SSE 1
+#	include <emmintrin.h>
+#else
+#	define BVH_SSE 0
+#endif
+
+namespace {
+
+/************************************************************************/
+/* Binary SAH build                                                     */
+/************************************************************************/
+const int BIN_COUNT = 16;
+//Below this size a node is always a leaf, above MAX_LEAF_SIZE it is always split
+const unsigned int MIN_LEAF_SIZE = 2;
+const unsigned int MAX_LEAF_SIZE = 8;
+//Cost of visiting a node relative to one triangle test
+const float TRAVERSAL_COST = 1.0f;
+//Nodes larger than this compute their bounds and bins in parallel
+const unsigned int PARALLEL_BINNING_SIZE = 1 << 16;
+const size_t PARALLEL_GRAIN = 1 << 14;
+
+struct Aabb {
+	glm::vec3 min;
+	glm::vec3 max;
+
+	Aabb() : min(FLT_MAX), max(-FLT_MAX) {
+	}
+	void grow(const glm::vec3& p) {
+		min = glm::min(min, p);
+		max = glm::max(max, p);
+	}
+	void grow(const Aabb& b) {
+		min = glm::min(min, b.min);
+		max = glm::max(max, b.max);
+	}
+	float area() const {
+		glm::vec3 d = max - min;
+		return (d.x < 0.0f) ? 0.0f : 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+};
+
+struct BinaryNode {
+	Aabb bounds;
+	//-1 for leaves
+	int left;
+	int right;
+	unsigned int first;
+	unsigned int count;
+};
+
+struct Bins {
+	Aabb bounds[3][BIN_COUNT];
+	unsigned int count[3][BIN_COUNT];
+
+	Bins() {
+		std::fill(&count[0][0], &count[0][0] + 3 * BIN_COUNT, 0u);
+	}
+	void merge(const Bins& other) {
+		for (int a = 0; a < 3; ++a) {
+			for (int b = 0; b < BIN_COUNT; ++b) {
+				bounds[a][b].grow(other.bounds[a][b]);
+				count[a][b] += other.count[a][b];
+			}
+		}
+	}
+};
+
+//Subtree left for the parallel phase of the build
+struct BuildTask {
+	int node;
+	unsigned int first;
+	unsigned int count;
+};
+
+class BvhBuilder {
+public:
+	BvhBuilder(const std::vector<Aabb>& boxes, const std::vector<glm::vec3>& centroids, std::vector<unsigned int>& order)
+		: boxes(boxes), centroids(centroids), order(order) {
+	}
+
+	/* Top of the tree on this thread (binning in parallel), subtrees smaller
+	than task_size are built afterwards in parallel. Returns the root */
+	int build(std::vector<BinaryNode>& nodes, unsigned int task_size);
+
+private:
+	int build_node(std::vector<BinaryNode>& nodes, unsigned int first, unsigned int count, std::vector<BuildTask>* tasks, unsigned int task_size);
+	void compute_bounds(unsigned int first, unsigned int count, bool parallel, Aabb& bounds, Aabb& centroid_bounds) const;
+	void compute_bins(unsigned int first, unsigned int count, bool parallel, const Aabb& centroid_bounds, Bins& bins) const;
+
+	const std::vector<Aabb>& boxes;
+	const std::vector<glm::vec3>& centroids;
+	std::vector<unsigned int>& order;
+};
+
+int bin_of(float c, float origin, float scale) {
+	int b = int((c - origin) * scale);
+	return std::max(0, std::min(BIN_COUNT - 1, b));
+}
+
+void BvhBuilder::compute_bounds(unsigned int first, unsigned int count, bool parallel, Aabb& bounds, Aabb& centroid_bounds) const {
+	if (!parallel) {
+		for (unsigned int i = first; i < first + count; ++i) {
+			bounds.grow(boxes[order[i]]);
+			centroid_bounds.grow(centroids[order[i]]);
+		}
+		return;
+	}
+	size_t chunks = (count + PARALLEL_GRAIN - 1) / PARALLEL_GRAIN;
+	std::vector<Aabb> chunk_bounds(chunks), chunk_centroids(chunks);
+	ThreadPool::shared().parallel_for(count, PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+		size_t k = begin / PARALLEL_GRAIN;
+		for (size_t i = first + begin; i < first + end; ++i) {
+			chunk_bounds[k].grow(boxes[order[i]]);
+			chunk_centroids[k].grow(centroids[order[i]]);
+		}
+	});
+	for (size_t k = 0; k < chunks; ++k) {
+		bounds.grow(chunk_bounds[k]);
+		centroid_bounds.grow(chunk_centroids[k]);
+	}
+}
+
+void BvhBuilder::compute_bins(unsigned int first, unsigned int count, bool parallel, const Aabb& centroid_bounds, Bins& bins) const {
+	glm::vec3 extent = centroid_bounds.max - centroid_bounds.min;
+	float scale[3];
+	for (int a = 0; a < 3; ++a) {
+		scale[a] = extent[a] > 0.0f ? float(BIN_COUNT) / extent[a] : 0.0f;
+	}
+	auto fill = [&](Bins& target, size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			unsigned int p = order[i];
+			for (int a = 0; a < 3; ++a) {
+				int b = bin_of(centroids[p][a], centroid_bounds.min[a], scale[a]);
+				target.bounds[a][b].grow(boxes[p]);
+				++target.count[a][b];
+			}
+		}
+	};
+	if (!parallel) {
+		fill(bins, first, first + count);
+		return;
+	}
+	std::vector<Bins> chunk_bins((count + PARALLEL_GRAIN - 1) / PARALLEL_GRAIN);
+	ThreadPool::shared().parallel_for(count, PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+		fill(chunk_bins[begin / PARALLEL_GRAIN], first + begin, first + end);
+	});
+	for (size_t k = 0; k < chunk_bins.size(); ++k) {
+		bins.merge(chunk_bins[k]);
+	}
+}
+
+int BvhBuilder::build_node(std::vector<BinaryNode>& nodes, unsigned int first, unsigned int count, std::vector<BuildTask>* tasks, unsigned int task_size) {
+	int index = int(nodes.size());
+	nodes.push_back(BinaryNode());
+	nodes[index].left = -1;
+	nodes[index].right = -1;
+	nodes[index].first = first;
+	nodes[index].count = count;
+
+	//Small enough, the parallel phase takes it from here
+	if (tasks && count <= task_size) {
+		BuildTask task = { index, first, count };
+		tasks->push_back(task);
+		return index;
+	}
+
+	const bool parallel = tasks != nullptr && count >= PARALLEL_BINNING_SIZE;
+	Aabb bounds, centroid_bounds;
+	compute_bounds(first, count, parallel, bounds, centroid_bounds);
+	nodes[index].bounds = bounds;
+	if (count <= MIN_LEAF_SIZE) {
+		return index;
+	}
+
+	/* Sweep the bins of every axis for the cheapest split */
+	Bins bins;
+	compute_bins(first, count, parallel, centroid_bounds, bins);
+	float best_cost = FLT_MAX;
+	int best_axis = -1;
+	int best_bin = 0;
+	for (int a = 0; a < 3; ++a) {
+		if (centroid_bounds.max[a] <= centroid_bounds.min[a]) {
+			continue;
+		}
+		float right_area[BIN_COUNT];
+		unsigned int right_count[BIN_COUNT];
+		Aabb right;
+		unsigned int n = 0;
+		for (int b = BIN_COUNT - 1; b > 0; --b) {
+			right.grow(bins.bounds[a][b]);
+			n += bins.count[a][b];
+			right_area[b] = right.area();
+			right_count[b] = n;
+		}
+		Aabb left;
+		n = 0;
+		for (int b = 0; b < BIN_COUNT - 1; ++b) {
+			left.grow(bins.bounds[a][b]);
+			n += bins.count[a][b];
+			float cost = left.area() * float(n) + right_area[b + 1] * float(right_count[b + 1]);
+			if (n > 0 && right_count[b + 1] > 0 && cost < best_cost) {
+				best_cost = cost;
+				best_axis = a;
+				best_bin = b;
+			}
+		}
+	}
+
+	float leaf_cost = float(count);
+	float split_cost = TRAVERSAL_COST + best_cost / std::max(bounds.area(), FLT_MIN);
+	if (count <= MAX_LEAF_SIZE && (best_axis < 0 || leaf_cost <= split_cost)) {
+		return index;
+	}
+
+	unsigned int* begin = &order[first];
+	unsigned int* end = begin + count;
+	unsigned int* middle = begin;
+	if (best_axis >= 0) {
+		float origin = centroid_bounds.min[best_axis];
+		float scale = float(BIN_COUNT) / (centroid_bounds.max[best_axis] - origin);
+		middle = std::partition(begin, end, [&](unsigned int p) {
+			return bin_of(centroids[p][best_axis], origin, scale) <= best_bin;
+		});
+	}
+	//Every centroid in the same place, split in the middle of the list
+	if (middle == begin || middle == end) {
+		middle = begin + count / 2;
+	}
+
+	unsigned int left_count = static_cast<unsigned int>(middle - begin);
+	int left = build_node(nodes, first, left_count, tasks, task_size);
+	int right = build_node(nodes, first + left_count, count - left_count, tasks, task_size);
+	nodes[index].left = left;
+	nodes[index].right = right;
+	return index;
+}
+
+int BvhBuilder::build(std::vector<BinaryNode>& nodes, unsigned int task_size) {
+	std::vector<BuildTask> tasks;
+	int root = build_node(nodes, 0, static_cast<unsigned int>(order.size()), &tasks, task_size);
+
+	/* Every task builds its subtree in its own array */
+	std::vector<std::vector<BinaryNode> > subtrees(tasks.size());
+	ThreadPool::shared().parallel_for(tasks.size(), 1, [&](size_t begin, size_t end) {
+		for (size_t t = begin; t < end; ++t) {
+			build_node(subtrees[t], tasks[t].first, tasks[t].count, nullptr, 0);
+		}
+	});
+
+	/* Append them, the placeholder node becomes the subtree root */
+	for (size_t t = 0; t < tasks.size(); ++t) {
+		int offset = int(nodes.size());
+		for (size_t i = 0; i < subtrees[t].size(); ++i) {
+			BinaryNode node = subtrees[t][i];
+			if (node.left >= 0) {
+				node.left += offset;
+				node.right += offset;
+			}
+			nodes.push_back(node);
+		}
+		nodes[tasks[t].node] = nodes[offset];
+	}
+	return root;
+}
+
+/************************************************************************/
+/* Collapse to four wide nodes                                          */
+/************************************************************************/
+/* depth is the level of the new node (the root is 1), max_depth the deepest
+level reached so far */
+int collapse(const std::vector<BinaryNode>& binary, int source, std::vector<BvhNode>& nodes, int depth, int& max_depth) {
+	max_depth = std::max(max_depth, depth);
+	int index = int(nodes.size());
+	BvhNode empty;
+	std::fill(empty.min_x, empty.min_x + 4, 0.0f);
+	std::fill(empty.min_y, empty.min_y + 4, 0.0f);
+	std::fill(empty.min_z, empty.min_z + 4, 0.0f);
+	std::fill(empty.max_x, empty.max_x + 4, 0.0f);
+	std::fill(empty.max_y, empty.max_y + 4, 0.0f);
+	std::fill(empty.max_z, empty.max_z + 4, 0.0f);
+	std::fill(empty.child, empty.child + 4, -1);
+	std::fill(empty.count, empty.count + 4, 0u);
+	nodes.push_back(empty);
+
+	/* Open the largest internal children until there are four */
+	int children[4];
+	int n = 0;
+	if (binary[source].left < 0) {
+		children[n++] = source;
+	} else {
+		children[n++] = binary[source].left;
+		children[n++] = binary[source].right;
+	}
+	while (n < 4) {
+		int best = -1;
+		float best_area = -1.0f;
+		for (int i = 0; i < n; ++i) {
+			const BinaryNode& c = binary[children[i]];
+			if (c.left >= 0 && c.bounds.area() > best_area) {
+				best = i;
+				best_area = c.bounds.area();
+			}
+		}
+		if (best < 0) {
+			break;
+		}
+		int opened = children[best];
+		children[best] = binary[opened].left;
+		children[n++] = binary[opened].right;
+	}
+
+	for (int i = 0; i < n; ++i) {
+		const BinaryNode& c = binary[children[i]];
+		int child;
+		unsigned int count;
+		if (c.left < 0) {
+			child = int(c.first);
+			count = c.count;
+		} else {
+			//nodes grows here, only use the index afterwards
+			child = collapse(binary, children[i], nodes, depth + 1, max_depth);
+			count = 0;
+		}
+		BvhNode& node = nodes[index];
+		node.min_x[i] = c.bounds.min.x;
+		node.min_y[i] = c.bounds.min.y;
+		node.min_z[i] = c.bounds.min.z;
+		node.max_x[i] = c.bounds.max.x;
+		node.max_y[i] = c.bounds.max.y;
+		node.max_z[i] = c.bounds.max.z;
+		node.child[i] = child;
+		node.count[i] = count;
+	}
+	return index;
+}
+
+/************************************************************************/
+/* Traversal                                                            */
+/************************************************************************/
+//Stack kept on the thread's stack, deeper trees get one from the heap
+const int STACK_SIZE = 256;
+
+bool intersect_triangle(const BvhTriangle& tri, const Ray& ray, float t_max, float& t, float& u, float& v) {
+	glm::vec3 p = glm::cross(ray.direction, tri.edge2);
+	float det = glm::dot(tri.edge1, p);
+	if (std::fabs(det) < 1e-12f) {
+		return false;
+	}
+	float inv_det = 1.0f / det;
+	glm::vec3 s = ray.origin - tri.v0;
+	u = glm::dot(s, p) * inv_det;
+	if (u < 0.0f || u > 1.0f) {
+		return false;
+	}
+	glm::vec3 q = glm::cross(s, tri.edge1);
+	v = glm::dot(ray.direction, q) * inv_det;
+	if (v < 0.0f || u + v > 1.0f) {
+		return false;
+	}
+	t = glm::dot(tri.edge2, q) * inv_det;
+	return t >= 0.0f && t <= t_max;
+}
+
+/* Slab test of the ray against the four boxes of the node. Returns a bit
+per child that is hit closer than t_max, entry distances go to t_near */
+int intersect_boxes(const BvhNode& node, const glm::vec3& origin, const glm::vec3& inv_dir, float t_max, float t_near[4]) {
+#if BVH_SSE
+	__m128 ox = _mm_set1_ps(origin.x), oy = _mm_set1_ps(origin.y), oz = _mm_set1_ps(origin.z);
+	__m128 ix = _mm_set1_ps(inv_dir.x), iy = _mm_set1_ps(inv_dir.y), iz = _mm_set1_ps(inv_dir.z);
+	__m128 tx0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.min_x), ox), ix);
+	__m128 tx1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.max_x), ox), ix);
+	__m128 ty0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.min_y), oy), iy);
+	__m128 ty1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.max_y), oy), iy);
+	__m128 tz0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.min_z), oz), iz);
+	__m128 tz1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.max_z), oz), iz);
+	__m128 enter = _mm_max_ps(_mm_max_ps(_mm_min_ps(tx0, tx1), _mm_min_ps(ty0, ty1)), _mm_max_ps(_mm_min_ps(tz0, tz1), _mm_setzero_ps()));
+	__m128 exit = _mm_min_ps(_mm_min_ps(_mm_max_ps(tx0, tx1), _mm_max_ps(ty0, ty1)), _mm_min_ps(_mm_max_ps(tz0, tz1), _mm_set1_ps(t_max)));
+	_mm_storeu_ps(t_near, enter);
+	return _mm_movemask_ps(_mm_cmple_ps(enter, exit));
+#else
+	int mask = 0;
+	for (int i = 0; i < 4; ++i) {
+		float tx0 = (node.min_x[i] - origin.x) * inv_dir.x, tx1 = (node.max_x[i] - origin.x) * inv_dir.x;
+		float ty0 = (node.min_y[i] - origin.y) * inv_dir.y, ty1 = (node.max_y[i] - origin.y) * inv_dir.y;
+		float tz0 = (node.min_z[i] - origin.z) * inv_dir.z, tz1 = (node.max_z[i] - origin.z) * inv_dir.z;
+		float enter = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::max(std::min(tz0, tz1), 0.0f));
+		float exit = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::min(std::max(tz0, tz1), t_max));
+		t_near[i] = enter;
+		if (enter <= exit) {
+			mask |= 1 << i;
+		}
+	}
+	return mask;
+#endif
+}
+
+}//namespace
+
+void Bvh::build(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices) {
+	nodes.clear();
+	triangles.clear();
+	stack_size = 0;
+	const size_t count = indices.size() / 3;
+	if (count == 0) {
+		return;
+	}
+
+	std::vector<Aabb> boxes(count);
+	std::vector<glm::vec3> centroids(count);
+	std::vector<unsigned int> order(count);
+	for (size_t t = 0; t < count; ++t) {
+		for (int k = 0; k < 3; ++k) {
+			boxes[t].grow(vertices[indices[3 * t + k]].position);
+		}
+		centroids[t] = 0.5f * (boxes[t].min + boxes[t].max);
+		order[t] = static_cast<unsigned int>(t);
+	}
+
+	/* Enough subtrees for every thread to stay busy */
+	unsigned int task_size = static_cast<unsigned int>(std::max(size_t(1024), count / (8 * ThreadPool::shared().size())));
+	std::vector<BinaryNode> binary;
+	BvhBuilder builder(boxes, centroids, order);
+	int root = builder.build(binary, task_size);
+	nodes.reserve(binary.size() / 2 + 1);
+	int depth = 0;
+	collapse(binary, root, nodes, 1, depth);
+	/* Each node pops itself and pushes at most four children, one level down */
+	stack_size = 3 * depth + 1;
+
+	/* Triangles in leaf order, with the edges precomputed */
+	triangles.resize(count);
+	for (size_t i = 0; i < count; ++i) {
+		unsigned int t = order[i];
+		glm::vec3 v0 = vertices[indices[3 * t]].position;
+		triangles[i].v0 = v0;
+		triangles[i].edge1 = vertices[indices[3 * t + 1]].position - v0;
+		triangles[i].edge2 = vertices[indices[3 * t + 2]].position - v0;
+		triangles[i].index = t;
+	}
+}
+
+template <bool ANY_HIT>
+bool Bvh::traverse(const Ray& ray, RayHit& hit) const {
+	hit.triangle = NO_HIT;
+	if (nodes.empty()) {
+		return false;
+	}
+	const glm::vec3 inv_dir = 1.0f / ray.direction;
+	float t_best = ray.t_max;
+	int local_stack[STACK_SIZE];
+	std::vector<int> heap_stack;
+	int* stack = local_stack;
+	if (stack_size > STACK_SIZE) {
+		heap_stack.resize(stack_size);
+		stack = heap_stack.data();
+	}
+	int top = 0;
+	stack[top++] = 0;
+
+	while (top > 0) {
+		const BvhNode& node = nodes[stack[--top]];
+		float t_near[4];
+		int mask = intersect_boxes(node, ray.origin, inv_dir, t_best, t_near);
+
+		/* Leaves are tested right away, inner nodes are pushed far to near */
+		int inner[4];
+		float inner_t[4];
+		int inner_count = 0;
+		for (int i = 0; i < 4; ++i) {
+			if (!(mask & (1 << i)) || node.child[i] < 0) {
+				continue;
+			}
+			if (node.count[i] > 0) {
+				for (unsigned int k = 0; k < node.count[i]; ++k) {
+					const BvhTriangle& tri = triangles[node.child[i] + k];
+					float t, u, v;
+					if (intersect_triangle(tri, ray, t_best, t, u, v)) {
+						t_best = t;
+						hit.triangle = tri.index;
+						hit.t = t;
+						hit.u = u;
+						hit.v = v;
+						if (ANY_HIT) {
+							return true;
+						}
+					}
+				}
+			} else {
+				int j = inner_count++;
+				while (j > 0 && inner_t[j - 1] < t_near[i]) {
+					inner[j] = inner[j - 1];
+					inner_t[j] = inner_t[j - 1];
+					--j;
+				}
+				inner[j] = node.child[i];
+				inner_t[j] = t_near[i];
+			}
+		}
+		for (int i = 0; i < inner_count; ++i) {
+			stack[top++] = inner[i];
+		}
+	}
+	return hit.triangle != NO_HIT;
+}
+
+bool Bvh::intersect(const Ray& ray, RayHit& hit) const {
+	return traverse<false>(ray, hit);
+}
+
+bool Bvh::occluded(const Ray& ray) const {
+	RayHit hit;
+	return traverse<true>(ray, hit);
+}
+
+void Bvh::intersect(const std::vector<Ray>& rays, std::vector<RayHit>& hits) const {
+	hits.resize(rays.size());
+	ThreadPool::shared().parallel_for(rays.size(), 256, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			traverse<false>(rays[i], hits[i]);
+		}
+	});
+}
+
+void Bvh::occluded(const std::vector<Ray>& rays, std::vector<bool>& results) const {
+	//vector<bool> packs bits, write bytes from the threads and convert after
+	std::vector<unsigned char> flags(rays.size());
+	ThreadPool::shared().parallel_for(rays.size(), 256, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			RayHit hit;
+			flags[i] = traverse<true>(rays[i], hit) ? 1 : 0;
+		}
+	});
+	results.assign(flags.begin(), flags.end());
+}
+
+Ray make_pick_ray(const glm::mat4& PVM, float x, float y, const glm::vec4& viewport) {
+	glm::vec3 near_point = glm::unProject(glm::vec3(x, y, 0.0f), glm::mat4(1.0f), PVM, viewport);
+	glm::vec3 far_point = glm::unProject(glm::vec3(x, y, 1.0f), glm::mat4(1.0f), PVM, viewport);
+	Ray ray;
+	ray.origin = near_point;
+	ray.direction = glm::normalize(far_point - near_point);
+	ray.t_max = glm::length(far_point - near_point);
+	return ray;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include "Mesh.h"
+
+struct Ray {
+	glm::vec3 origin;
+	glm::vec3 direction;
+	//Only hits in [0, t_max] count
+	float t_max;
+};
+
+struct RayHit {
+	//Index of the triangle in the source index buffer, NO_HIT when nothing was hit
+	unsigned int triangle;
+	float t;
+	//Barycentric coordinates of the hit, relative to the second and third vertices
+	float u;
+	float v;
+};
+
+const unsigned int NO_HIT = 0xFFFFFFFFu;
+
+/* Four wide node of the flattened hierarchy: the boxes of the four children
+are stored by component so one SSE instruction tests all of them (128 bytes,
+two cache lines). A child with count > 0 is a leaf holding the triangles
+[child, child + count); with count == 0 it is the index of another node.
+Unused slots have child == -1 */
+struct BvhNode {
+	float min_x[4], min_y[4], min_z[4];
+	float max_x[4], max_y[4], max_z[4];
+	int child[4];
+	unsigned int count[4];
+};
+
+//Triangle ready for Moller-Trumbore, in leaf order
+struct BvhTriangle {
+	glm::vec3 v0;
+	glm::vec3 edge1;
+	glm::vec3 edge2;
+	unsigned int index;
+};
+
+/* Bounding volume hierarchy over the triangles of a mesh. Built as a binary
+tree with binned SAH (the large nodes bin in parallel, then the subtrees are
+built in parallel), then collapsed to four wide nodes for traversal */
+class Bvh {
+public:
+	void build(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices);
+
+	//Closest hit along the ray, false when there is none
+	bool intersect(const Ray& ray, RayHit& hit) const;
+	//True as soon as any triangle is hit, for visibility and shadow queries
+	bool occluded(const Ray& ray) const;
+
+	//Closest hits of many rays, spread over the thread pool
+	void intersect(const std::vector<Ray>& rays, std::vector<RayHit>& hits) const;
+	void occluded(const std::vector<Ray>& rays, std::vector<bool>& results) const;
+
+	size_t node_count() const { return nodes.size(); }
+	bool empty() const { return triangles.empty(); }
+
+private:
+	template <bool ANY_HIT>
+	bool traverse(const Ray& ray, RayHit& hit) const;
+
+	std::vector<BvhNode> nodes;
+	std::vector<BvhTriangle> triangles;
+	//Entries the traversal stack needs, from the depth of the tree
+	int stack_size = 0;
+};
+
+/* Ray through the window position (x, y) (pixels, origin bottom left), in the
+space PVM takes points from. viewport is (x, y, width, height) */
+Ray make_pick_ray(const glm::mat4& PVM, float x, float y, const glm::vec4& viewport);
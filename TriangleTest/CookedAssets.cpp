@@ -0,0 +1,268 @@
+#include "CookedAssets.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+static_assert(sizeof(CookedVertex) == 12, "CookedVertex is read by glVertexAttribPointer with a 12 bytes stride");
+static_assert(sizeof(CookedMeshHeader) == 96, "CookedMeshHeader layout is part of the file format");
+static_assert(sizeof(CookedTextureHeader) == 160, "CookedTextureHeader layout is part of the file format");
+
+namespace {
+
+size_t align16(size_t offset) {
+	return (offset + 15) & ~size_t(15);
+}
+
+//One block of the file, written at its offset
+struct Block {
+	const void* data;
+	size_t size;
+	size_t offset;
+};
+
+bool write_blocks(const std::string& path, const void* header, size_t header_size, const std::vector<Block>& blocks) {
+	std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+	if (!out) {
+		return false;
+	}
+	out.write(static_cast<const char*>(header), header_size);
+	size_t position = header_size;
+	const char zeros[16] = { 0 };
+	for (size_t i = 0; i < blocks.size(); ++i) {
+		out.write(zeros, blocks[i].offset - position);
+		out.write(static_cast<const char*>(blocks[i].data), blocks[i].size);
+		position = blocks[i].offset + blocks[i].size;
+	}
+	return bool(out);
+}
+
+//The block lies inside the file
+bool inside(unsigned long long offset, unsigned long long size, size_t file_size) {
+	return offset <= file_size && size <= file_size - offset;
+}
+
+}//namespace
+
+/************************************************************************/
+/* Meshes                                                               */
+/************************************************************************/
+bool CookedMeshFile::open(const std::string& path) {
+	head = nullptr;
+	if (!file.open(path)) {
+		std::cerr << "Can not open " << path << std::endl;
+		return false;
+	}
+	const CookedMeshHeader* h = reinterpret_cast<const CookedMeshHeader*>(file.data());
+	if (file.size() < sizeof(CookedMeshHeader) || h->magic != COOKED_MESH_MAGIC) {
+		std::cerr << path << " is not a cooked mesh" << std::endl;
+		return false;
+	}
+	if (h->version != COOKED_VERSION) {
+		std::cerr << path << " was cooked by another version, cook it again" << std::endl;
+		return false;
+	}
+	if ((h->index_size != 2 && h->index_size != 4)
+		|| !inside(h->vertex_offset, (unsigned long long)(h->vertex_count) * sizeof(CookedVertex), file.size())
+		|| !inside(h->index_offset, (unsigned long long)(h->index_count) * h->index_size, file.size())
+		|| !inside(h->lod_offset, (unsigned long long)(h->lod_count) * sizeof(CookedLod), file.size())) {
+		std::cerr << path << " is damaged" << std::endl;
+		return false;
+	}
+	head = h;
+	for (unsigned int i = 0; i < h->lod_count; ++i) {
+		if (lods()[i].first_index > h->index_count || lods()[i].index_count > h->index_count - lods()[i].first_index) {
+			std::cerr << path << " is damaged" << std::endl;
+			head = nullptr;
+			return false;
+		}
+	}
+	return true;
+}
+
+const CookedVertex* CookedMeshFile::vertices() const {
+	return reinterpret_cast<const CookedVertex*>(file.data() + head->vertex_offset);
+}
+
+const void* CookedMeshFile::indices() const {
+	return file.data() + head->index_offset;
+}
+
+const CookedLod* CookedMeshFile::lods() const {
+	return reinterpret_cast<const CookedLod*>(file.data() + head->lod_offset);
+}
+
+bool write_cooked_mesh(const std::string& path, unsigned long long source_hash, const Mesh& mesh, const LodChain& chain) {
+	CookedMeshHeader header;
+	std::memset(&header, 0, sizeof(header));
+	header.magic = COOKED_MESH_MAGIC;
+	header.version = COOKED_VERSION;
+	header.source_hash = source_hash;
+	header.vertex_count = static_cast<unsigned int>(mesh.vertices.size());
+	header.index_count = static_cast<unsigned int>(chain.indices.size());
+	header.index_size = mesh.vertices.size() <= 65536 ? 2 : 4;
+	header.lod_count = static_cast<unsigned int>(chain.levels.size());
+
+	/************************************************************************/
+	/* Quantize the positions to the box and the colors to bytes            */
+	/************************************************************************/
+	glm::vec3 low(0.0f);
+	glm::vec3 high(0.0f);
+	for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+		low = i == 0 ? mesh.vertices[i].position : glm::min(low, mesh.vertices[i].position);
+		high = i == 0 ? mesh.vertices[i].position : glm::max(high, mesh.vertices[i].position);
+	}
+	const glm::vec3 size = high - low;
+	for (int k = 0; k < 3; ++k) {
+		header.box_min[k] = low[k];
+		header.box_size[k] = size[k];
+		header.center[k] = chain.center[k];
+	}
+	header.radius = chain.radius;
+	std::vector<CookedVertex> vertices(mesh.vertices.size());
+	for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+		const Vertex& v = mesh.vertices[i];
+		for (int k = 0; k < 3; ++k) {
+			float t = size[k] > 0.0f ? (v.position[k] - low[k]) / size[k] : 0.0f;
+			vertices[i].position[k] = static_cast<unsigned short>(glm::clamp(t, 0.0f, 1.0f) * 65535.0f + 0.5f);
+			vertices[i].color[k] = static_cast<unsigned char>(glm::clamp(v.color[k], 0.0f, 1.0f) * 255.0f + 0.5f);
+		}
+		vertices[i].position[3] = 0;
+		vertices[i].color[3] = 255;
+	}
+	std::vector<unsigned short> short_indices;
+	if (header.index_size == 2) {
+		short_indices.assign(chain.indices.begin(), chain.indices.end());
+	}
+	std::vector<CookedLod> lods(chain.levels.size());
+	for (size_t i = 0; i < chain.levels.size(); ++i) {
+		CookedLod lod = { chain.levels[i].first_index, chain.levels[i].index_count, chain.levels[i].error, 0 };
+		lods[i] = lod;
+	}
+
+	header.vertex_offset = align16(sizeof(header));
+	header.index_offset = align16(size_t(header.vertex_offset) + vertices.size() * sizeof(CookedVertex));
+	header.lod_offset = align16(size_t(header.index_offset) + chain.indices.size() * header.index_size);
+	std::vector<Block> blocks;
+	Block vertex_block = { vertices.data(), vertices.size() * sizeof(CookedVertex), size_t(header.vertex_offset) };
+	Block index_block = { header.index_size == 2 ? static_cast<const void*>(short_indices.data()) : static_cast<const void*>(chain.indices.data()),
+		chain.indices.size() * header.index_size, size_t(header.index_offset) };
+	Block lod_block = { lods.data(), lods.size() * sizeof(CookedLod), size_t(header.lod_offset) };
+	blocks.push_back(vertex_block);
+	blocks.push_back(index_block);
+	blocks.push_back(lod_block);
+	return write_blocks(path, &header, sizeof(header), blocks);
+}
+
+/************************************************************************/
+/* Textures                                                             */
+/************************************************************************/
+bool CookedTextureFile::open(const std::string& path) {
+	head = nullptr;
+	if (!file.open(path)) {
+		std::cerr << "Can not open " << path << std::endl;
+		return false;
+	}
+	const CookedTextureHeader* h = reinterpret_cast<const CookedTextureHeader*>(file.data());
+	if (file.size() < sizeof(CookedTextureHeader) || h->magic != COOKED_TEXTURE_MAGIC) {
+		std::cerr << path << " is not a cooked texture" << std::endl;
+		return false;
+	}
+	if (h->version != COOKED_VERSION) {
+		std::cerr << path << " was cooked by another version, cook it again" << std::endl;
+		return false;
+	}
+	if (h->level_count == 0 || h->level_count > MAX_COOKED_LEVELS) {
+		std::cerr << path << " is damaged" << std::endl;
+		return false;
+	}
+	head = h;
+	for (unsigned int i = 0; i < h->level_count; ++i) {
+		if (!inside(h->level_offsets[i], 4ull * level_width(i) * level_height(i), file.size())) {
+			std::cerr << path << " is damaged" << std::endl;
+			head = nullptr;
+			return false;
+		}
+	}
+	return true;
+}
+
+const unsigned char* CookedTextureFile::level(unsigned int i) const {
+	return reinterpret_cast<const unsigned char*>(file.data() + head->level_offsets[i]);
+}
+
+unsigned int CookedTextureFile::level_width(unsigned int i) const {
+	return std::max(1u, head->width >> i);
+}
+
+unsigned int CookedTextureFile::level_height(unsigned int i) const {
+	return std::max(1u, head->height >> i);
+}
+
+bool write_cooked_texture(const std::string& path, unsigned long long source_hash, const Image& image) {
+	CookedTextureHeader header;
+	std::memset(&header, 0, sizeof(header));
+	header.magic = COOKED_TEXTURE_MAGIC;
+	header.version = COOKED_VERSION;
+	header.source_hash = source_hash;
+	header.width = image.width;
+	header.height = image.height;
+
+	/* Every level halves the previous one (odd sizes round down), each texel
+	the average of the two by two it covers, clamped at the borders */
+	std::vector<std::vector<unsigned char> > levels(1, image.rgba);
+	unsigned int width = image.width;
+	unsigned int height = image.height;
+	while ((width > 1 || height > 1) && levels.size() < MAX_COOKED_LEVELS) {
+		unsigned int next_width = std::max(1u, width / 2);
+		unsigned int next_height = std::max(1u, height / 2);
+		const std::vector<unsigned char>& source = levels.back();
+		std::vector<unsigned char> next(size_t(next_width) * next_height * 4);
+		for (unsigned int y = 0; y < next_height; ++y) {
+			unsigned int y0 = std::min(2 * y, height - 1);
+			unsigned int y1 = std::min(2 * y + 1, height - 1);
+			for (unsigned int x = 0; x < next_width; ++x) {
+				unsigned int x0 = std::min(2 * x, width - 1);
+				unsigned int x1 = std::min(2 * x + 1, width - 1);
+				for (int c = 0; c < 4; ++c) {
+					unsigned int sum = source[(size_t(y0) * width + x0) * 4 + c] + source[(size_t(y0) * width + x1) * 4 + c]
+						+ source[(size_t(y1) * width + x0) * 4 + c] + source[(size_t(y1) * width + x1) * 4 + c];
+					next[(size_t(y) * next_width + x) * 4 + c] = static_cast<unsigned char>((sum + 2) / 4);
+				}
+			}
+		}
+		levels.push_back(next);
+		width = next_width;
+		height = next_height;
+	}
+	header.level_count = static_cast<unsigned int>(levels.size());
+
+	std::vector<Block> blocks;
+	size_t offset = sizeof(header);
+	for (size_t i = 0; i < levels.size(); ++i) {
+		offset = align16(offset);
+		header.level_offsets[i] = offset;
+		Block block = { levels[i].data(), levels[i].size(), offset };
+		blocks.push_back(block);
+		offset += levels[i].size();
+	}
+	return write_blocks(path, &header, sizeof(header), blocks);
+}
+
+bool read_cooked_source_hash(const std::string& path, unsigned int magic, unsigned long long& source_hash) {
+	std::ifstream in(path.c_str(), std::ios::binary);
+	unsigned char prefix[16];
+	if (!in.read(reinterpret_cast<char*>(prefix), sizeof(prefix))) {
+		return false;
+	}
+	unsigned int file_magic;
+	unsigned int version;
+	std::memcpy(&file_magic, prefix, 4);
+	std::memcpy(&version, prefix + 4, 4);
+	std::memcpy(&source_hash, prefix + 8, 8);
+	return file_magic == magic && version == COOKED_VERSION;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "MappedFile.h"
+#include "Mesh.h"
+#include "MeshLod.h"
+#include "PngDecoder.h"
+
+/* Runtime formats written by the AssetCooker. Each one is a header followed
+by blocks ready to hand to glBufferData or glTexImage2D, the file is memory
+mapped and nothing is converted at load time. Every block starts 16 bytes
+aligned, offsets are from the start of the file. Little endian only */
+
+const unsigned int COOKED_MESH_MAGIC = 0x4D434253; //"SBCM"
+const unsigned int COOKED_TEXTURE_MAGIC = 0x54434253; //"SBCT"
+const unsigned int COOKED_VERSION = 1;
+
+/* Quantized vertex: the position in the mesh box as three normalized
+unsigned shorts (the fourth pads to 8 bytes) and an RGBA8 color */
+struct CookedVertex {
+	unsigned short position[4];
+	unsigned char color[4];
+};
+
+struct CookedLod {
+	unsigned int first_index;
+	unsigned int index_count;
+	float error;
+	unsigned int reserved;
+};
+
+//Both headers start with magic, version and the hash the cooker keys its cache on
+struct CookedMeshHeader {
+	unsigned int magic;
+	unsigned int version;
+	unsigned long long source_hash;
+	unsigned int vertex_count;
+	unsigned int index_count;
+	//2 or 4 bytes per index
+	unsigned int index_size;
+	unsigned int lod_count;
+	//position = box_min + box_size * quantized / 65535
+	float box_min[3];
+	float box_size[3];
+	//Bounding sphere, for the LOD selection
+	float center[3];
+	float radius;
+	unsigned long long vertex_offset;
+	unsigned long long index_offset;
+	unsigned long long lod_offset;
+};
+
+const unsigned int MAX_COOKED_LEVELS = 16;
+
+//RGBA8 image with its full mip chain, level 0 first
+struct CookedTextureHeader {
+	unsigned int magic;
+	unsigned int version;
+	unsigned long long source_hash;
+	unsigned int width;
+	unsigned int height;
+	unsigned int level_count;
+	unsigned int reserved;
+	unsigned long long level_offsets[MAX_COOKED_LEVELS];
+};
+
+/* Mapped cooked mesh, the pointers stay valid while the object lives */
+class CookedMeshFile {
+public:
+	CookedMeshFile() : head(nullptr) {}
+
+	//False with the reason on std::cerr when the file is missing, stale or damaged
+	bool open(const std::string& path);
+
+	const CookedMeshHeader& header() const { return *head; }
+	const CookedVertex* vertices() const;
+	const void* indices() const;
+	const CookedLod* lods() const;
+
+private:
+	MappedFile file;
+	const CookedMeshHeader* head;
+};
+
+class CookedTextureFile {
+public:
+	CookedTextureFile() : head(nullptr) {}
+
+	bool open(const std::string& path);
+
+	const CookedTextureHeader& header() const { return *head; }
+	const unsigned char* level(unsigned int i) const;
+	unsigned int level_width(unsigned int i) const;
+	unsigned int level_height(unsigned int i) const;
+
+private:
+	MappedFile file;
+	const CookedTextureHeader* head;
+};
+
+/* Quantize and write a mesh with its LOD chain (whose indices it draws, 16
+bits when the vertices allow it). Returns false when the file can not be written */
+bool write_cooked_mesh(const std::string& path, unsigned long long source_hash, const Mesh& mesh, const LodChain& chain);
+
+//Write the image and a box filtered mip chain down to 1x1
+bool write_cooked_texture(const std::string& path, unsigned long long source_hash, const Image& image);
+
+/* Hash a cooked file was made from, false when the file is missing or
+from another version. Reads the header only */
+bool read_cooked_source_hash(const std::string& path, unsigned int magic, unsigned long long& source_hash);
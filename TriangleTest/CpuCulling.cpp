@@ -0,0 +1,228 @@
+#include "CpuCulling.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+
+#include <glm/glm.hpp>
+
+#include "CpuFeatures.h"
+#include "Frustum.h"
+#include "Parallel.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#	define CULLING_X86 1
+#	include <immintrin.h>
+#	if defined(_MSC_VER)
+//MSVC accepts AVX2 intrinsics in any function
+#		define CULLING_TARGET_AVX2
+#	else
+#		define CULLING_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#	endif
+#else
+#	define CULLING_X86 0
+#endif
+
+namespace {
+
+//Spheres per task, a multiple of eight so every chunk starts on a SIMD group
+const size_t CHUNK_SIZE = 16384;
+
+typedef size_t(*CullKernel)(const BoundingSpheres& spheres, const glm::vec4 planes[6], size_t begin, size_t end, unsigned int* out);
+
+#if CULLING_X86
+
+/* For every 8 bits mask, the lanes to move to the front and how many they are */
+struct CompactTable {
+	int lanes[256][8];
+	int count[256];
+
+	CompactTable() {
+		for (int mask = 0; mask < 256; ++mask) {
+			count[mask] = 0;
+			for (int lane = 0; lane < 8; ++lane) {
+				lanes[mask][lane] = 0;
+				if (mask & (1 << lane)) {
+					lanes[mask][count[mask]++] = lane;
+				}
+			}
+		}
+	}
+};
+const CompactTable compact_table;
+
+size_t cull_sse2(const BoundingSpheres& spheres, const glm::vec4 planes[6], size_t begin, size_t end, unsigned int* out) {
+	__m128 a[6], b[6], c[6], d[6];
+	for (int p = 0; p < 6; ++p) {
+		a[p] = _mm_set1_ps(planes[p].x);
+		b[p] = _mm_set1_ps(planes[p].y);
+		c[p] = _mm_set1_ps(planes[p].z);
+		d[p] = _mm_set1_ps(planes[p].w);
+	}
+	const __m128 sign = _mm_set1_ps(-0.0f);
+	size_t written = 0;
+	for (size_t i = begin; i < end; i += 4) {
+		__m128 x = _mm_loadu_ps(spheres.x() + i);
+		__m128 y = _mm_loadu_ps(spheres.y() + i);
+		__m128 z = _mm_loadu_ps(spheres.z() + i);
+		__m128 negative_r = _mm_xor_ps(_mm_loadu_ps(spheres.r() + i), sign);
+		__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (int p = 0; p < 6; ++p) {
+			__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, a[p]), _mm_mul_ps(y, b[p])), _mm_add_ps(_mm_mul_ps(z, c[p]), d[p]));
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negative_r));
+		}
+		//Branch free compaction, the lanes table also works for four lanes
+		int mask = _mm_movemask_ps(inside);
+		const int* lanes = compact_table.lanes[mask];
+		unsigned int base = static_cast<unsigned int>(i);
+		for (int k = 0; k < 4; ++k) {
+			out[written + k] = base + lanes[k];
+		}
+		written += compact_table.count[mask];
+	}
+	return written;
+}
+
+CULLING_TARGET_AVX2
+size_t cull_avx2(const BoundingSpheres& spheres, const glm::vec4 planes[6], size_t begin, size_t end, unsigned int* out) {
+	__m256 a[6], b[6], c[6], d[6];
+	for (int p = 0; p < 6; ++p) {
+		a[p] = _mm256_set1_ps(planes[p].x);
+		b[p] = _mm256_set1_ps(planes[p].y);
+		c[p] = _mm256_set1_ps(planes[p].z);
+		d[p] = _mm256_set1_ps(planes[p].w);
+	}
+	const __m256 sign = _mm256_set1_ps(-0.0f);
+	const __m256i step = _mm256_set1_epi32(8);
+	__m256i index = _mm256_add_epi32(_mm256_set1_epi32(int(begin)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+	size_t written = 0;
+	for (size_t i = begin; i < end; i += 8) {
+		__m256 x = _mm256_loadu_ps(spheres.x() + i);
+		__m256 y = _mm256_loadu_ps(spheres.y() + i);
+		__m256 z = _mm256_loadu_ps(spheres.z() + i);
+		__m256 negative_r = _mm256_xor_ps(_mm256_loadu_ps(spheres.r() + i), sign);
+		__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		for (int p = 0; p < 6; ++p) {
+			__m256 distance = _mm256_fmadd_ps(x, a[p], _mm256_fmadd_ps(y, b[p], _mm256_fmadd_ps(z, c[p], d[p])));
+			inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negative_r, _CMP_GE_OQ));
+		}
+		/* Move the indices of the visible lanes to the front and store all
+		eight, the next group overwrites the garbage after them */
+		int mask = _mm256_movemask_ps(inside);
+		__m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(compact_table.lanes[mask]));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + written), _mm256_permutevar8x32_epi32(index, lanes));
+		written += compact_table.count[mask];
+		index = _mm256_add_epi32(index, step);
+	}
+	return written;
+}
+
+#else
+
+size_t cull_scalar(const BoundingSpheres& spheres, const glm::vec4 planes[6], size_t begin, size_t end, unsigned int* out) {
+	const float* x = spheres.x();
+	const float* y = spheres.y();
+	const float* z = spheres.z();
+	const float* r = spheres.r();
+	size_t written = 0;
+	for (size_t i = begin; i < end; ++i) {
+		bool inside = true;
+		for (int p = 0; p < 6; ++p) {
+			float d = planes[p].x * x[i] + planes[p].y * y[i] + planes[p].z * z[i] + planes[p].w;
+			inside = inside && d >= -r[i];
+		}
+		if (inside) {
+			out[written++] = static_cast<unsigned int>(i);
+		}
+	}
+	return written;
+}
+
+#endif//CULLING_X86
+
+struct KernelChoice {
+	CullKernel kernel;
+	const char* name;
+
+	KernelChoice() {
+#if CULLING_X86
+		if (cpu_level() >= CPU_AVX2) {
+			kernel = cull_avx2;
+			name = "AVX2";
+		} else {
+			kernel = cull_sse2;
+			name = "SSE2";
+		}
+#else
+		kernel = cull_scalar;
+		name = "scalar";
+#endif
+	}
+};
+const KernelChoice kernel_choice;
+
+}//namespace
+
+BoundingSpheres::BoundingSpheres() : count(0) {
+}
+
+void BoundingSpheres::resize(size_t new_count) {
+	count = new_count;
+	size_t padded = (new_count + 7) & ~size_t(7);
+	center_x.assign(padded, 0.0f);
+	center_y.assign(padded, 0.0f);
+	center_z.assign(padded, 0.0f);
+	//A hugely negative radius fails every plane test
+	radius.assign(padded, -FLT_MAX);
+}
+
+void BoundingSpheres::set(size_t i, const glm::vec3& center, float r) {
+	center_x[i] = center.x;
+	center_y[i] = center.y;
+	center_z[i] = center.z;
+	radius[i] = r;
+}
+
+size_t FrustumCuller::cull(const BoundingSpheres& spheres, const glm::mat4& PV, std::vector<unsigned int>& visible) {
+	glm::vec4 planes[6];
+	extract_frustum_planes(PV, planes);
+
+	const size_t padded = spheres.padded_size();
+	if (scratch.size() < padded) {
+		scratch.resize(padded);
+	}
+	if (visible.size() < padded) {
+		visible.resize(padded);
+	}
+	const size_t chunks = (padded + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	chunk_counts.resize(chunks + 1);
+
+	/* First pass: every chunk compacts its survivors in its own slice of
+	the scratch buffer, so no synchronization is needed */
+	const CullKernel kernel = kernel_choice.kernel;
+	unsigned int* scratch_data = scratch.data();
+	size_t* counts = chunk_counts.data();
+	ThreadPool::shared().parallel_for(padded, CHUNK_SIZE, [&](size_t begin, size_t end) {
+		counts[begin / CHUNK_SIZE] = kernel(spheres, planes, begin, end, scratch_data + begin);
+	});
+
+	/* Second pass: prefix sum of the counts, then every chunk copies its
+	slice to the final place */
+	size_t total = 0;
+	for (size_t k = 0; k < chunks; ++k) {
+		size_t n = counts[k];
+		counts[k] = total;
+		total += n;
+	}
+	counts[chunks] = total;
+	unsigned int* output = visible.data();
+	ThreadPool::shared().parallel_for(padded, CHUNK_SIZE, [&](size_t begin, size_t) {
+		size_t k = begin / CHUNK_SIZE;
+		std::memcpy(output + counts[k], scratch_data + begin, (counts[k + 1] - counts[k]) * sizeof(unsigned int));
+	});
+	return total;
+}
+
+const char* FrustumCuller::kernel_name() {
+	return kernel_choice.name;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+/* Bounding spheres stored as structure of arrays, one array per component,
+so eight of them load into one AVX register. The arrays are padded to a
+multiple of eight with spheres that never pass a test */
+class BoundingSpheres {
+public:
+	BoundingSpheres();
+
+	void resize(size_t count);
+	void set(size_t i, const glm::vec3& center, float radius);
+
+	size_t size() const { return count; }
+	//Size of the arrays, a multiple of eight
+	size_t padded_size() const { return radius.size(); }
+
+	const float* x() const { return center_x.data(); }
+	const float* y() const { return center_y.data(); }
+	const float* z() const { return center_z.data(); }
+	const float* r() const { return radius.data(); }
+
+private:
+	std::vector<float> center_x;
+	std::vector<float> center_y;
+	std::vector<float> center_z;
+	std::vector<float> radius;
+	size_t count;
+};
+
+/* Frustum culling of bounding spheres on the CPU. Eight spheres per AVX2
+instruction (four with SSE2) and the array split over the shared thread
+pool. The instruction set is picked at run time */
+class FrustumCuller {
+public:
+	/* Write the indices of the spheres that touch the frustum of PV (in the
+	space of the spheres) to visible, in increasing order. visible only grows,
+	the return value is the number of valid entries */
+	size_t cull(const BoundingSpheres& spheres, const glm::mat4& PV, std::vector<unsigned int>& visible);
+
+	//Name of the kernel cull() uses on this machine
+	static const char* kernel_name();
+
+private:
+	std::vector<unsigned int> scratch;
+	std::vector<size_t> chunk_counts;
+};
@@ -0,0 +1,70 @@
+#include "CpuFeatures.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#	define FEATURES_X86 1
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#		include <immintrin.h>
+#	endif
+#else
+#	define FEATURES_X86 0
+#endif
+
+namespace {
+
+CpuLevel detect_cpu_level() {
+#if FEATURES_X86 && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	const int max_leaf = info[0];
+	__cpuid(info, 1);
+	bool fma = (info[2] & (1 << 12)) != 0;
+	bool f16c = (info[2] & (1 << 29)) != 0;
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	bool avx = (info[2] & (1 << 28)) != 0;
+	//The OS must save the YMM registers on context switches
+	bool ymm = osxsave && (_xgetbv(0) & 6) == 6;
+	if (!avx || !ymm) {
+		return CPU_SSE2;
+	}
+	bool avx2 = false;
+	if (max_leaf >= 7) {
+		__cpuidex(info, 7, 0);
+		avx2 = (info[1] & (1 << 5)) != 0;
+	}
+	return avx2 && fma && f16c ? CPU_AVX2 : CPU_AVX;
+#elif FEATURES_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c")) {
+		return CPU_AVX2;
+	}
+	return __builtin_cpu_supports("avx") ? CPU_AVX : CPU_SSE2;
+#else
+	return CPU_SSE2;
+#endif
+}
+
+}//namespace
+
+CpuLevel cpu_level() {
+	static const CpuLevel level = detect_cpu_level();
+	return level;
+}
+
+namespace {
+
+//Detected before main, function statics are not thread safe with the v120 toolset
+const CpuLevel startup_level = cpu_level();
+
+}//namespace
+
+const char* cpu_level_name(CpuLevel level) {
+	switch (level) {
+	case CPU_AVX2:
+		return "AVX2";
+	case CPU_AVX:
+		return "AVX";
+	default:
+		return "SSE2";
+	}
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+//Instruction sets the program has code for, each one includes the ones before
+enum CpuLevel {
+	//Any x86 CPU the program runs on, and every other kind of CPU
+	CPU_SSE2,
+	CPU_AVX,
+	//AVX2, FMA and F16C, they came together
+	CPU_AVX2,
+};
+
+/* Best level this CPU and its OS support, AVX needs the OS to save the YMM
+registers. Detected on first use */
+CpuLevel cpu_level();
+
+const char* cpu_level_name(CpuLevel level);
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+/* Number parsing for the importers. Plain decimal notation only (no locale,
+no hex, no inf or nan), which is all the text formats use, several times
+faster than strtod. Up to 19 significant digits are exact, then the powers
+of ten below 1e22 are exact doubles so most values round correctly. Every
+function skips leading spaces and tabs and returns the character after the
+number, or nullptr when there is no number at p */
+
+inline const char* skip_spaces(const char* p, const char* end) {
+	while (p < end && (*p == ' ' || *p == '\t')) {
+		++p;
+	}
+	return p;
+}
+
+inline const char* parse_double(const char* p, const char* end, double& value) {
+	static const double POWERS[23] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+	};
+	p = skip_spaces(p, end);
+	bool negative = false;
+	if (p < end && (*p == '-' || *p == '+')) {
+		negative = *p == '-';
+		++p;
+	}
+	std::uint64_t mantissa = 0;
+	int significant = 0;
+	int exponent = 0;
+	bool any_digit = false;
+	//Digits past the 19th only move the decimal point
+	for (; p < end && unsigned(*p - '0') < 10; ++p) {
+		any_digit = true;
+		if (significant < 19) {
+			mantissa = mantissa * 10 + unsigned(*p - '0');
+			significant += mantissa != 0 ? 1 : 0;
+		} else {
+			++exponent;
+		}
+	}
+	if (p < end && *p == '.') {
+		for (++p; p < end && unsigned(*p - '0') < 10; ++p) {
+			any_digit = true;
+			if (significant < 19) {
+				mantissa = mantissa * 10 + unsigned(*p - '0');
+				significant += mantissa != 0 ? 1 : 0;
+				--exponent;
+			}
+		}
+	}
+	if (!any_digit) {
+		return nullptr;
+	}
+	if (p < end && (*p == 'e' || *p == 'E')) {
+		const char* q = p + 1;
+		bool negative_exponent = false;
+		if (q < end && (*q == '-' || *q == '+')) {
+			negative_exponent = *q == '-';
+			++q;
+		}
+		if (q < end && unsigned(*q - '0') < 10) {
+			int e = 0;
+			for (; q < end && unsigned(*q - '0') < 10; ++q) {
+				e = e < 10000 ? e * 10 + (*q - '0') : e;
+			}
+			exponent += negative_exponent ? -e : e;
+			p = q;
+		}
+	}
+	double result = double(mantissa);
+	if (exponent < 0) {
+		result = -exponent <= 22 ? result / POWERS[-exponent] : result * std::pow(10.0, double(exponent));
+	} else if (exponent > 0) {
+		result = exponent <= 22 ? result * POWERS[exponent] : result * std::pow(10.0, double(exponent));
+	}
+	value = negative ? -result : result;
+	return p;
+}
+
+inline const char* parse_float(const char* p, const char* end, float& value) {
+	double result;
+	p = parse_double(p, end, result);
+	if (p) {
+		value = float(result);
+	}
+	return p;
+}
+
+inline const char* parse_int(const char* p, const char* end, long long& value) {
+	p = skip_spaces(p, end);
+	bool negative = false;
+	if (p < end && (*p == '-' || *p == '+')) {
+		negative = *p == '-';
+		++p;
+	}
+	if (p == end || unsigned(*p - '0') >= 10) {
+		return nullptr;
+	}
+	long long result = 0;
+	for (; p < end && unsigned(*p - '0') < 10; ++p) {
+		result = result * 10 + (*p - '0');
+	}
+	value = negative ? -result : result;
+	return p;
+}
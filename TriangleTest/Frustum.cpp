@@ -0,0 +1,30 @@
+#include "Frustum.h"
+
+#include <glm/glm.hpp>
+
+void extract_frustum_planes(const glm::mat4& PV, glm::vec4 planes[6]) {
+	/* Gribb and Hartmann: each plane is the last row of the matrix plus or
+	minus one of the other rows. glm is column major, so build the rows */
+	glm::vec4 rows[4];
+	for (int i = 0; i < 4; ++i) {
+		rows[i] = glm::vec4(PV[0][i], PV[1][i], PV[2][i], PV[3][i]);
+	}
+	planes[0] = rows[3] + rows[0];
+	planes[1] = rows[3] - rows[0];
+	planes[2] = rows[3] + rows[1];
+	planes[3] = rows[3] - rows[1];
+	planes[4] = rows[3] + rows[2];
+	planes[5] = rows[3] - rows[2];
+	for (int i = 0; i < 6; ++i) {
+		planes[i] /= glm::length(glm::vec3(planes[i]));
+	}
+}
+
+bool sphere_in_frustum(const glm::vec4 planes[6], const glm::vec3& center, float radius) {
+	for (int i = 0; i < 6; ++i) {
+		if (glm::dot(planes[i], glm::vec4(center, 1.0f)) < -radius) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+
+/* Six planes of the view volume of a projection * view (or PVM) matrix,
+in the space the matrix takes points from. Normals are normalized and point
+inside: dot(plane, vec4(p, 1)) is the signed distance of p to the plane.
+Order is left, right, bottom, top, near, far */
+void extract_frustum_planes(const glm::mat4& PV, glm::vec4 planes[6]);
+
+//True when the sphere touches the inside of the planes
+bool sphere_in_frustum(const glm::vec4 planes[6], const glm::vec3& center, float radius);
@@ -0,0 +1,107 @@
+#include "GeometryPool.h"
+
+#include <iostream>
+
+// Define a helpful macro for handling offsets into buffer objects
+#define BUFFER_OFFSET( offset )   ((GLvoid*) (offset))
+
+GeometryPool::GeometryPool() : vbo(0), ibo(0), vertex_capacity(0), index_capacity(0), vertex_count(0), index_count(0) {
+}
+
+void GeometryPool::create(GLuint max_vertices, GLuint max_indices) {
+	vertex_capacity = max_vertices;
+	index_capacity = max_indices;
+	vertex_count = 0;
+	index_count = 0;
+	ranges.clear();
+
+	//Allocate storage only, the meshes are copied in add_mesh
+	glGenBuffers(1, &vbo);
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, vertex_capacity * sizeof(Vertex), nullptr, GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glGenBuffers(1, &ibo);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_capacity * sizeof(unsigned short), nullptr, GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void GeometryPool::destroy() {
+	glDeleteBuffers(1, &vbo);
+	glDeleteBuffers(1, &ibo);
+	vbo = 0;
+	ibo = 0;
+	ranges.clear();
+}
+
+int GeometryPool::add_mesh(const Mesh& mesh) {
+	if (mesh.vertices.size() > 65536) {
+		std::cerr << "Mesh with " << mesh.vertices.size() << " vertices does not fit 16 bits indices" << std::endl;
+		return -1;
+	}
+	if (vertex_count + mesh.vertices.size() > vertex_capacity || index_count + mesh.indices.size() > index_capacity) {
+		std::cerr << "Geometry pool is full" << std::endl;
+		return -1;
+	}
+
+	MeshRange range;
+	range.first_index = index_count;
+	range.index_count = GLuint(mesh.indices.size());
+	range.base_vertex = GLint(vertex_count);
+	range.vertex_count = GLuint(mesh.vertices.size());
+
+	//Indices stay relative to the mesh, base_vertex is added by the draw
+	std::vector<unsigned short> short_indices(mesh.indices.begin(), mesh.indices.end());
+
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferSubData(GL_ARRAY_BUFFER, vertex_count * sizeof(Vertex), mesh.vertices.size() * sizeof(Vertex), mesh.vertices.data());
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+	glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, index_count * sizeof(unsigned short), short_indices.size() * sizeof(unsigned short), short_indices.data());
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+	vertex_count += range.vertex_count;
+	index_count += range.index_count;
+	ranges.push_back(range);
+	return int(ranges.size() - 1);
+}
+
+DrawElementsIndirectCommand GeometryPool::draw_command(int handle, GLuint instance_count, GLuint first_instance) const {
+	const MeshRange& r = ranges[handle];
+	DrawElementsIndirectCommand command = { r.index_count, instance_count, r.first_index, r.base_vertex, first_instance };
+	return command;
+}
+
+void upload_draw_commands(GLuint& buffer, const std::vector<DrawElementsIndirectCommand>& commands) {
+	if (buffer == 0) {
+		glGenBuffers(1, &buffer);
+	}
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer);
+	glBufferData(GL_DRAW_INDIRECT_BUFFER, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data(), GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+bool multi_draw_supported() {
+	if (!GLEW_VERSION_4_0 && !GLEW_ARB_draw_indirect) {
+		std::cerr << "Indirect draws need OpenGL 4.0 or ARB_draw_indirect" << std::endl;
+		return false;
+	}
+	if (!GLEW_VERSION_4_2 && !GLEW_ARB_base_instance) {
+		std::cerr << "Indirect draws with a first instance need OpenGL 4.2 or ARB_base_instance" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+void multi_draw(GLuint indirect_buffer, GLsizei command_count, GLenum index_type) {
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect_buffer);
+	if (GLEW_VERSION_4_3 || GLEW_ARB_multi_draw_indirect) {
+		glMultiDrawElementsIndirect(GL_TRIANGLES, index_type, BUFFER_OFFSET(0), command_count, 0);
+	} else {
+		for (GLsizei i = 0; i < command_count; ++i) {
+			glDrawElementsIndirect(GL_TRIANGLES, index_type, BUFFER_OFFSET(i * sizeof(DrawElementsIndirectCommand)));
+		}
+	}
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+
+#include <GL/glew.h>
+
+#include "Mesh.h"
+
+//Where one mesh lives inside the shared buffers
+struct MeshRange {
+	GLuint first_index;
+	GLuint index_count;
+	GLint base_vertex;
+	GLuint vertex_count;
+};
+
+//Memory layout read by glMultiDrawElementsIndirect
+struct DrawElementsIndirectCommand {
+	GLuint count;
+	GLuint instanceCount;
+	GLuint firstIndex;
+	GLint baseVertex;
+	GLuint baseInstance;
+};
+
+/* One big VBO and one big IBO that many meshes are sub-allocated from.
+Indices are 16 bits and relative to the first vertex of their mesh, the
+draw adds base_vertex, so the pool itself may hold more than 65536 vertices */
+class GeometryPool {
+public:
+	GeometryPool();
+
+	//Allocate the GL buffers, needs a current context
+	void create(GLuint max_vertices, GLuint max_indices);
+	void destroy();
+
+	//Copy the mesh into the pool, returns its handle or -1 when it does not fit
+	int add_mesh(const Mesh& mesh);
+
+	const MeshRange& range(int handle) const { return ranges[handle]; }
+	size_t mesh_count() const { return ranges.size(); }
+	GLuint vertex_buffer() const { return vbo; }
+	GLuint index_buffer() const { return ibo; }
+
+	//Command drawing instance_count copies of a mesh, starting at first_instance
+	DrawElementsIndirectCommand draw_command(int handle, GLuint instance_count, GLuint first_instance) const;
+
+private:
+	GLuint vbo;
+	GLuint ibo;
+	GLuint vertex_capacity;
+	GLuint index_capacity;
+	GLuint vertex_count;
+	GLuint index_count;
+	std::vector<MeshRange> ranges;
+};
+
+//Fill (or grow) a GL_DRAW_INDIRECT_BUFFER with the commands
+void upload_draw_commands(GLuint& buffer, const std::vector<DrawElementsIndirectCommand>& commands);
+
+/* Whether this context runs multi_draw with commands whose first_instance is
+not zero: indirect draws (GL 4.0) that honour baseInstance (GL 4.2). Prints
+what is missing otherwise */
+bool multi_draw_supported();
+
+//Submit every command with one call, one call per command when GL 4.3 is missing
+void multi_draw(GLuint indirect_buffer, GLsizei command_count, GLenum index_type = GL_UNSIGNED_SHORT);
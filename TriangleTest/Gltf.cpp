@@ -0,0 +1,647 @@
+#include "Gltf.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "Json.h"
+#include "MappedFile.h"
+
+namespace {
+
+const unsigned int GLB_MAGIC = 0x46546C67;
+const unsigned int GLB_CHUNK_JSON = 0x4E4F534A;
+const unsigned int GLB_CHUNK_BIN = 0x004E4942;
+
+//Bytes of a buffer, owner keeps them alive
+struct BufferData {
+	std::shared_ptr<const void> owner;
+	const unsigned char* data;
+	size_t size;
+};
+
+struct BufferView {
+	int buffer;
+	size_t offset;
+	size_t length;
+	GLsizei stride;
+	//Created the first time an accessor reads the view
+	GLuint gl_buffer;
+};
+
+unsigned int read_le32(const unsigned char* p) {
+	return unsigned(p[0]) | unsigned(p[1]) << 8 | unsigned(p[2]) << 16 | unsigned(p[3]) << 24;
+}
+
+std::string directory_of(const std::string& path) {
+	size_t slash = path.find_last_of("/\\");
+	return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+}
+
+int hex_digit(char c) {
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+//URIs may escape spaces and other characters as %XX
+std::string decode_uri(const std::string& uri) {
+	std::string path;
+	for (size_t i = 0; i < uri.size(); ++i) {
+		if (uri[i] == '%' && i + 2 < uri.size() && hex_digit(uri[i + 1]) >= 0 && hex_digit(uri[i + 2]) >= 0) {
+			path += char(hex_digit(uri[i + 1]) * 16 + hex_digit(uri[i + 2]));
+			i += 2;
+		} else {
+			path += uri[i];
+		}
+	}
+	return path;
+}
+
+bool decode_base64(const char* p, const char* end, std::vector<unsigned char>& out) {
+	unsigned int bits = 0;
+	int count = 0;
+	for (; p < end && *p != '='; ++p) {
+		int value;
+		if (*p >= 'A' && *p <= 'Z') value = *p - 'A';
+		else if (*p >= 'a' && *p <= 'z') value = *p - 'a' + 26;
+		else if (*p >= '0' && *p <= '9') value = *p - '0' + 52;
+		else if (*p == '+') value = 62;
+		else if (*p == '/') value = 63;
+		else return false;
+		bits = (bits << 6) | unsigned(value);
+		count += 6;
+		if (count >= 8) {
+			count -= 8;
+			out.push_back(static_cast<unsigned char>(bits >> count));
+		}
+	}
+	return true;
+}
+
+size_t component_size(GLenum type) {
+	switch (type) {
+	case GL_BYTE:
+	case GL_UNSIGNED_BYTE: return 1;
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT: return 2;
+	case GL_UNSIGNED_INT:
+	case GL_FLOAT: return 4;
+	default: return 0;
+	}
+}
+
+GLint component_count(const std::string& type) {
+	if (type == "SCALAR") return 1;
+	if (type == "VEC2") return 2;
+	if (type == "VEC3") return 3;
+	if (type == "VEC4") return 4;
+	return 0;
+}
+
+//Split a TRS matrix, the shear a node matrix might hold is lost
+void decompose_matrix(const glm::mat4& m, glm::vec3& translation, glm::quat& rotation, glm::vec3& scale) {
+	translation = glm::vec3(m[3]);
+	glm::mat3 basis(m);
+	scale = glm::vec3(glm::length(basis[0]), glm::length(basis[1]), glm::length(basis[2]));
+	if (glm::determinant(basis) < 0.0f) {
+		scale.x = -scale.x;
+	}
+	for (int k = 0; k < 3; ++k) {
+		if (scale[k] != 0.0f) {
+			basis[k] /= scale[k];
+		}
+	}
+	rotation = glm::normalize(glm::quat_cast(basis));
+}
+
+/* Parsing state of one file, gone once the scene is loaded */
+class GltfFile {
+public:
+	JsonDocument json;
+	std::string directory;
+	std::vector<BufferData> buffers;
+	std::vector<BufferView> views;
+	//Every GL buffer made, handed to the scene
+	std::vector<GLuint> gl_buffers;
+
+	bool load_buffers(const BufferData& glb_chunk) {
+		int list = json.member(json.root(), "buffers");
+		for (int b = json.first_child(list); b != JsonDocument::NONE; b = json.next_element(list, b)) {
+			BufferData buffer = { std::shared_ptr<const void>(), nullptr, 0 };
+			size_t length = size_t(json.number(json.member(b, "byteLength")));
+			int uri = json.member(b, "uri");
+			if (uri == JsonDocument::NONE) {
+				//The binary chunk of a .glb
+				buffer = glb_chunk;
+			} else {
+				std::string text = json.string(uri);
+				if (text.compare(0, 5, "data:") == 0) {
+					size_t comma = text.find(',');
+					std::shared_ptr<std::vector<unsigned char> > bytes(new std::vector<unsigned char>());
+					if (comma == std::string::npos || !decode_base64(text.data() + comma + 1, text.data() + text.size(), *bytes)) {
+						std::cerr << "glTF: bad data uri in buffer " << buffers.size() << std::endl;
+						return false;
+					}
+					buffer.owner = bytes;
+					buffer.data = bytes->data();
+					buffer.size = bytes->size();
+				} else {
+					std::shared_ptr<MappedFile> file(new MappedFile());
+					std::string path = directory + decode_uri(text);
+					if (!file->open(path)) {
+						std::cerr << "glTF: can not open " << path << std::endl;
+						return false;
+					}
+					buffer.owner = file;
+					buffer.data = reinterpret_cast<const unsigned char*>(file->data());
+					buffer.size = file->size();
+				}
+			}
+			if (buffer.size < length) {
+				std::cerr << "glTF: buffer " << buffers.size() << " is shorter than its byteLength" << std::endl;
+				return false;
+			}
+			buffers.push_back(buffer);
+		}
+		return true;
+	}
+
+	bool load_views() {
+		int list = json.member(json.root(), "bufferViews");
+		for (int v = json.first_child(list); v != JsonDocument::NONE; v = json.next_element(list, v)) {
+			BufferView view;
+			view.buffer = json.integer(json.member(v, "buffer"));
+			view.offset = size_t(json.number(json.member(v, "byteOffset")));
+			view.length = size_t(json.number(json.member(v, "byteLength")));
+			view.stride = GLsizei(json.integer(json.member(v, "byteStride"), 0));
+			view.gl_buffer = 0;
+			if (view.buffer < 0 || size_t(view.buffer) >= buffers.size() || view.offset + view.length > buffers[view.buffer].size) {
+				std::cerr << "glTF: bufferView " << views.size() << " is out of its buffer" << std::endl;
+				return false;
+			}
+			views.push_back(view);
+		}
+		return true;
+	}
+
+	//Straight from the mapped file to the GPU, no copy in between
+	GLuint gl_buffer(int v, GLenum target) {
+		BufferView& view = views[v];
+		if (view.gl_buffer == 0) {
+			glGenBuffers(1, &view.gl_buffer);
+			glBindBuffer(target, view.gl_buffer);
+			glBufferData(target, view.length, buffers[view.buffer].data + view.offset, GL_STATIC_DRAW);
+			glBindBuffer(target, 0);
+			gl_buffers.push_back(view.gl_buffer);
+		}
+		return view.gl_buffer;
+	}
+
+	/* Describe an accessor for GL, false when it can not be read in place
+	(no bufferView, sparse, matrices, out of range) */
+	bool read_accessor(int index, GLenum target, GltfAttribute& attribute, size_t& count) {
+		int accessor = json.element(json.member(json.root(), "accessors"), unsigned(index));
+		int v = json.integer(json.member(accessor, "bufferView"));
+		if (accessor == JsonDocument::NONE || v < 0 || size_t(v) >= views.size() || json.member(accessor, "sparse") != JsonDocument::NONE) {
+			return false;
+		}
+		attribute.type = GLenum(json.integer(json.member(accessor, "componentType"), 0));
+		attribute.components = component_count(json.string(json.member(accessor, "type")));
+		attribute.normalized = json.boolean(json.member(accessor, "normalized")) ? GL_TRUE : GL_FALSE;
+		attribute.stride = views[v].stride;
+		attribute.offset = size_t(json.number(json.member(accessor, "byteOffset")));
+		count = size_t(json.number(json.member(accessor, "count")));
+		const size_t element = component_size(attribute.type) * size_t(attribute.components);
+		const size_t step = attribute.stride != 0 ? size_t(attribute.stride) : element;
+		if (element == 0 || (count > 0 && attribute.offset + (count - 1) * step + element > views[v].length)) {
+			return false;
+		}
+		attribute.buffer = gl_buffer(v, target);
+		return true;
+	}
+
+	//POSITION bounds, from min and max when present or from the data
+	void position_bounds(int index, glm::vec3& low, glm::vec3& high) {
+		int accessor = json.element(json.member(json.root(), "accessors"), unsigned(index));
+		int min = json.member(accessor, "min");
+		int max = json.member(accessor, "max");
+		if (json.count(min) == 3 && json.count(max) == 3) {
+			for (unsigned int k = 0; k < 3; ++k) {
+				low[k] = float(json.number(json.element(min, k)));
+				high[k] = float(json.number(json.element(max, k)));
+			}
+			return;
+		}
+		const BufferView& view = views[json.integer(json.member(accessor, "bufferView"))];
+		const unsigned char* p = buffers[view.buffer].data + view.offset + size_t(json.number(json.member(accessor, "byteOffset")));
+		const size_t step = view.stride != 0 ? size_t(view.stride) : sizeof(glm::vec3);
+		const size_t count = size_t(json.number(json.member(accessor, "count")));
+		low = glm::vec3(0.0f);
+		high = glm::vec3(0.0f);
+		for (size_t i = 0; i < count; ++i, p += step) {
+			glm::vec3 position;
+			std::memcpy(&position, p, sizeof(position));
+			low = i == 0 ? position : glm::min(low, position);
+			high = i == 0 ? position : glm::max(high, position);
+		}
+	}
+};
+
+}//namespace
+
+GltfScene::GltfScene() : stop(false) {
+}
+
+GltfScene::~GltfScene() {
+	//GL objects need the context, only the worker is stopped here
+	stop = true;
+	if (worker.joinable()) {
+		worker.join();
+	}
+}
+
+bool GltfScene::load(const std::string& path, TransformHierarchy& hierarchy, unsigned int parent) {
+	destroy();
+	std::shared_ptr<MappedFile> file(new MappedFile());
+	if (!file->open(path) || file->size() == 0) {
+		std::cerr << "Can not open " << path << std::endl;
+		return false;
+	}
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(file->data());
+	const size_t size = file->size();
+
+	/************************************************************************/
+	/* Split a .glb in its JSON and binary chunks                           */
+	/************************************************************************/
+	const char* json_text = file->data();
+	size_t json_size = size;
+	BufferData glb_chunk = { std::shared_ptr<const void>(), nullptr, 0 };
+	if (size >= 12 && read_le32(bytes) == GLB_MAGIC) {
+		if (read_le32(bytes + 4) != 2) {
+			std::cerr << "glTF: only version 2 binaries are supported" << std::endl;
+			return false;
+		}
+		json_size = 0;
+		const size_t length = std::min(size_t(read_le32(bytes + 8)), size);
+		for (size_t offset = 12; offset + 8 <= length;) {
+			size_t chunk_size = read_le32(bytes + offset);
+			unsigned int chunk_type = read_le32(bytes + offset + 4);
+			if (chunk_size > length - offset - 8) {
+				break;
+			}
+			if (chunk_type == GLB_CHUNK_JSON && json_size == 0) {
+				json_text = file->data() + offset + 8;
+				json_size = chunk_size;
+			} else if (chunk_type == GLB_CHUNK_BIN && glb_chunk.data == nullptr) {
+				glb_chunk.owner = file;
+				glb_chunk.data = bytes + offset + 8;
+				glb_chunk.size = chunk_size;
+			}
+			offset += 8 + chunk_size;
+		}
+	}
+
+	GltfFile gltf;
+	gltf.directory = directory_of(path);
+	JsonDocument& json = gltf.json;
+	if (!json.parse(json_text, json_size)) {
+		std::cerr << "glTF: " << json.error() << std::endl;
+		return false;
+	}
+	const int root = json.root();
+	std::string version = json.string(json.member(json.member(root, "asset"), "version"));
+	if (version.compare(0, 1, "2") != 0) {
+		std::cerr << "glTF: version " << version << " is not supported" << std::endl;
+		return false;
+	}
+	int required = json.member(root, "extensionsRequired");
+	for (int e = json.first_child(required); e != JsonDocument::NONE; e = json.next_element(required, e)) {
+		std::cerr << "glTF: required extension " << json.string(e) << " is not supported" << std::endl;
+		return false;
+	}
+	if (!gltf.load_buffers(glb_chunk) || !gltf.load_views()) {
+		return false;
+	}
+
+	/************************************************************************/
+	/* Textures, their images are decoded by the worker                     */
+	/************************************************************************/
+	const int samplers = json.member(root, "samplers");
+	const int texture_list = json.member(root, "textures");
+	for (int t = json.first_child(texture_list); t != JsonDocument::NONE; t = json.next_element(texture_list, t)) {
+		int sampler = json.element(samplers, unsigned(json.integer(json.member(t, "sampler"))));
+		Texture texture;
+		texture.image = json.integer(json.member(t, "source"));
+		texture.min_filter = json.integer(json.member(sampler, "minFilter"), GL_LINEAR_MIPMAP_LINEAR);
+		texture.mag_filter = json.integer(json.member(sampler, "magFilter"), GL_LINEAR);
+		texture.wrap_s = json.integer(json.member(sampler, "wrapS"), GL_REPEAT);
+		texture.wrap_t = json.integer(json.member(sampler, "wrapT"), GL_REPEAT);
+		texture.name = 0;
+		textures.push_back(texture);
+	}
+	std::vector<ImageSource> sources;
+	const int images = json.member(root, "images");
+	for (int i = json.first_child(images); i != JsonDocument::NONE; i = json.next_element(images, i)) {
+		ImageSource source = { std::string(), std::shared_ptr<const void>(), nullptr, 0 };
+		int uri = json.member(i, "uri");
+		int v = json.integer(json.member(i, "bufferView"));
+		if (uri != JsonDocument::NONE) {
+			std::string text = json.string(uri);
+			if (text.compare(0, 5, "data:") == 0) {
+				size_t comma = text.find(',');
+				std::shared_ptr<std::vector<unsigned char> > encoded(new std::vector<unsigned char>());
+				if (comma != std::string::npos && decode_base64(text.data() + comma + 1, text.data() + text.size(), *encoded)) {
+					source.owner = encoded;
+					source.data = encoded->data();
+					source.size = encoded->size();
+				}
+			} else {
+				source.path = gltf.directory + decode_uri(text);
+			}
+		} else if (v >= 0 && size_t(v) < gltf.views.size()) {
+			const BufferView& view = gltf.views[v];
+			source.owner = gltf.buffers[view.buffer].owner;
+			source.data = gltf.buffers[view.buffer].data + view.offset;
+			source.size = view.length;
+		}
+		sources.push_back(source);
+	}
+
+	/************************************************************************/
+	/* Meshes, made the first time a node uses them                         */
+	/************************************************************************/
+	const int meshes = json.member(root, "meshes");
+	const int materials = json.member(root, "materials");
+	const size_t NOT_MADE = size_t(-1);
+	std::vector<std::pair<size_t, size_t> > mesh_primitives(json.count(meshes), std::make_pair(NOT_MADE, size_t(0)));
+	auto make_mesh = [&](int mesh_index) {
+		std::pair<size_t, size_t>& range = mesh_primitives[mesh_index];
+		if (range.first != NOT_MADE) {
+			return range;
+		}
+		range.first = primitive_list.size();
+		int primitives = json.member(json.element(meshes, unsigned(mesh_index)), "primitives");
+		for (int p = json.first_child(primitives); p != JsonDocument::NONE; p = json.next_element(primitives, p)) {
+			GltfPrimitive primitive = GltfPrimitive();
+			primitive.mode = GLenum(json.integer(json.member(p, "mode"), GL_TRIANGLES));
+			primitive.base_color = glm::vec4(1.0f);
+			primitive.texture = -1;
+			int texcoord_set = 0;
+			int material = json.element(materials, unsigned(json.integer(json.member(p, "material"))));
+			int pbr = json.member(material, "pbrMetallicRoughness");
+			int factor = json.member(pbr, "baseColorFactor");
+			for (unsigned int k = 0; k < 4 && json.count(factor) == 4; ++k) {
+				primitive.base_color[k] = float(json.number(json.element(factor, k)));
+			}
+			int base_texture = json.member(pbr, "baseColorTexture");
+			if (base_texture != JsonDocument::NONE) {
+				primitive.texture = json.integer(json.member(base_texture, "index"));
+				texcoord_set = json.integer(json.member(base_texture, "texCoord"), 0);
+			}
+
+			int attributes = json.member(p, "attributes");
+			int position = json.integer(json.member(attributes, "POSITION"));
+			size_t vertex_count = 0;
+			if (position < 0 || !gltf.read_accessor(position, GL_ARRAY_BUFFER, primitive.position, vertex_count)
+				|| primitive.position.type != GL_FLOAT || primitive.position.components != 3) {
+				std::cerr << "glTF: skipped a primitive of mesh " << mesh_index << " without readable positions" << std::endl;
+				continue;
+			}
+			gltf.position_bounds(position, primitive.low, primitive.high);
+			size_t unused;
+			int normal = json.integer(json.member(attributes, "NORMAL"));
+			if (normal < 0 || !gltf.read_accessor(normal, GL_ARRAY_BUFFER, primitive.normal, unused)) {
+				primitive.normal.buffer = 0;
+			}
+			int color = json.integer(json.member(attributes, "COLOR_0"));
+			if (color < 0 || !gltf.read_accessor(color, GL_ARRAY_BUFFER, primitive.color, unused)) {
+				primitive.color.buffer = 0;
+			}
+			int texcoord = json.integer(json.member(attributes, ("TEXCOORD_" + std::to_string(texcoord_set)).c_str()));
+			if (texcoord < 0 || !gltf.read_accessor(texcoord, GL_ARRAY_BUFFER, primitive.texcoord, unused)) {
+				primitive.texcoord.buffer = 0;
+			}
+
+			int indices = json.integer(json.member(p, "indices"));
+			if (indices >= 0) {
+				GltfAttribute index_attribute;
+				size_t index_count = 0;
+				if (!gltf.read_accessor(indices, GL_ELEMENT_ARRAY_BUFFER, index_attribute, index_count) || index_attribute.components != 1
+					|| (index_attribute.type != GL_UNSIGNED_BYTE && index_attribute.type != GL_UNSIGNED_SHORT && index_attribute.type != GL_UNSIGNED_INT)) {
+					std::cerr << "glTF: skipped a primitive of mesh " << mesh_index << " with unreadable indices" << std::endl;
+					continue;
+				}
+				primitive.index_buffer = index_attribute.buffer;
+				primitive.index_type = index_attribute.type;
+				primitive.index_offset = index_attribute.offset;
+				primitive.count = GLsizei(index_count);
+			} else {
+				primitive.count = GLsizei(vertex_count);
+			}
+			primitive_list.push_back(primitive);
+		}
+		range.second = primitive_list.size() - range.first;
+		return range;
+	};
+
+	/************************************************************************/
+	/* Nodes of the default scene, parents before children                  */
+	/************************************************************************/
+	const int nodes = json.member(root, "nodes");
+	std::vector<unsigned char> visited(json.count(nodes), 0);
+	std::vector<std::pair<int, unsigned int> > pending;
+	int scene = json.element(json.member(root, "scenes"), unsigned(json.integer(json.member(root, "scene"), 0)));
+	int scene_nodes = json.member(scene, "nodes");
+	if (scene_nodes != JsonDocument::NONE) {
+		for (int n = json.first_child(scene_nodes); n != JsonDocument::NONE; n = json.next_element(scene_nodes, n)) {
+			pending.push_back(std::make_pair(json.integer(n), parent));
+		}
+	} else {
+		//No scene, every node nobody points to is a root
+		std::vector<unsigned char> is_child(json.count(nodes), 0);
+		for (int n = json.first_child(nodes); n != JsonDocument::NONE; n = json.next_element(nodes, n)) {
+			int children = json.member(n, "children");
+			for (int c = json.first_child(children); c != JsonDocument::NONE; c = json.next_element(children, c)) {
+				unsigned int child = unsigned(json.integer(c));
+				if (child < is_child.size()) {
+					is_child[child] = 1;
+				}
+			}
+		}
+		for (size_t n = 0; n < is_child.size(); ++n) {
+			if (!is_child[n]) {
+				pending.push_back(std::make_pair(int(n), parent));
+			}
+		}
+	}
+	while (!pending.empty()) {
+		int index = pending.back().first;
+		unsigned int node_parent = pending.back().second;
+		pending.pop_back();
+		//A node has one parent, a cycle or a second parent is ignored
+		if (index < 0 || size_t(index) >= visited.size() || visited[index]) {
+			continue;
+		}
+		visited[index] = 1;
+		int node = json.element(nodes, unsigned(index));
+		glm::vec3 translation(0.0f);
+		glm::quat rotation(1.0f, 0.0f, 0.0f, 0.0f);
+		glm::vec3 scale(1.0f);
+		int matrix = json.member(node, "matrix");
+		if (json.count(matrix) == 16) {
+			float values[16];
+			for (unsigned int k = 0; k < 16; ++k) {
+				values[k] = float(json.number(json.element(matrix, k)));
+			}
+			decompose_matrix(glm::make_mat4(values), translation, rotation, scale);
+		} else {
+			int t = json.member(node, "translation");
+			int r = json.member(node, "rotation");
+			int s = json.member(node, "scale");
+			for (unsigned int k = 0; k < 3 && json.count(t) == 3; ++k) {
+				translation[k] = float(json.number(json.element(t, k)));
+			}
+			//glTF stores x y z w
+			if (json.count(r) == 4) {
+				rotation = glm::quat(float(json.number(json.element(r, 3))), float(json.number(json.element(r, 0))),
+					float(json.number(json.element(r, 1))), float(json.number(json.element(r, 2))));
+			}
+			for (unsigned int k = 0; k < 3 && json.count(s) == 3; ++k) {
+				scale[k] = float(json.number(json.element(s, k)));
+			}
+		}
+		unsigned int handle = hierarchy.add(node_parent, translation, rotation, scale);
+		int mesh = json.integer(json.member(node, "mesh"));
+		if (mesh >= 0 && size_t(mesh) < mesh_primitives.size()) {
+			std::pair<size_t, size_t> range = make_mesh(mesh);
+			GltfDrawNode draw_node = { handle, range.first, range.second };
+			if (range.second > 0) {
+				draw_node_list.push_back(draw_node);
+			}
+		}
+		int children = json.member(node, "children");
+		for (int c = json.first_child(children); c != JsonDocument::NONE; c = json.next_element(children, c)) {
+			pending.push_back(std::make_pair(json.integer(c), handle));
+		}
+	}
+	buffers = gltf.gl_buffers;
+
+	if (!sources.empty()) {
+		stop = false;
+		worker = std::thread(&GltfScene::decode_images, this, sources);
+	}
+	return true;
+}
+
+void GltfScene::decode_images(std::vector<ImageSource> sources) {
+	for (size_t i = 0; i < sources.size() && !stop; ++i) {
+		ImageSource& source = sources[i];
+		MappedFile file;
+		if (!source.path.empty()) {
+			if (!file.open(source.path)) {
+				std::cerr << "glTF: can not open image " << source.path << std::endl;
+				continue;
+			}
+			source.data = reinterpret_cast<const unsigned char*>(file.data());
+			source.size = file.size();
+		}
+		DecodedImage image;
+		image.image = int(i);
+		bool decoded_png = false;
+		//An exception would end the whole program on this thread
+		try {
+			decoded_png = source.data != nullptr && decode_png(source.data, source.size, image.pixels);
+		} catch (const std::exception& e) {
+			std::cerr << "glTF: image " << i << " failed to decode: " << e.what() << std::endl;
+			continue;
+		}
+		if (!decoded_png) {
+			std::cerr << "glTF: image " << i << " is not a PNG this loader can decode" << std::endl;
+			continue;
+		}
+		std::lock_guard<std::mutex> lock(decoded_mutex);
+		decoded.push_back(std::move(image));
+	}
+}
+
+size_t GltfScene::poll_textures() {
+	std::vector<DecodedImage> ready;
+	{
+		std::lock_guard<std::mutex> lock(decoded_mutex);
+		ready.swap(decoded);
+	}
+	size_t uploaded = 0;
+	for (size_t i = 0; i < ready.size(); ++i) {
+		const Image& pixels = ready[i].pixels;
+		for (size_t t = 0; t < textures.size(); ++t) {
+			Texture& texture = textures[t];
+			if (texture.image != ready[i].image) {
+				continue;
+			}
+			glGenTextures(1, &texture.name);
+			glBindTexture(GL_TEXTURE_2D, texture.name);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, texture.min_filter);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, texture.mag_filter);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, texture.wrap_s);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, texture.wrap_t);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, GLsizei(pixels.width), GLsizei(pixels.height), 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.rgba.data());
+			if (texture.min_filter != GL_LINEAR && texture.min_filter != GL_NEAREST) {
+				glGenerateMipmap(GL_TEXTURE_2D);
+			}
+			glBindTexture(GL_TEXTURE_2D, 0);
+			++uploaded;
+		}
+	}
+	return uploaded;
+}
+
+GLuint GltfScene::texture(int index) const {
+	return index >= 0 && size_t(index) < textures.size() ? textures[index].name : 0;
+}
+
+bool GltfScene::bounds(const TransformHierarchy& hierarchy, glm::vec3& low, glm::vec3& high) const {
+	bool any = false;
+	for (size_t n = 0; n < draw_node_list.size(); ++n) {
+		const glm::mat4& M = hierarchy.world(draw_node_list[n].node);
+		for (size_t p = draw_node_list[n].first_primitive; p < draw_node_list[n].first_primitive + draw_node_list[n].primitive_count; ++p) {
+			const GltfPrimitive& primitive = primitive_list[p];
+			for (int corner = 0; corner < 8; ++corner) {
+				glm::vec3 local((corner & 1) ? primitive.high.x : primitive.low.x, (corner & 2) ? primitive.high.y : primitive.low.y, (corner & 4) ? primitive.high.z : primitive.low.z);
+				glm::vec3 world = glm::vec3(M * glm::vec4(local, 1.0f));
+				low = any ? glm::min(low, world) : world;
+				high = any ? glm::max(high, world) : world;
+				any = true;
+			}
+		}
+	}
+	return any;
+}
+
+void GltfScene::destroy() {
+	stop = true;
+	if (worker.joinable()) {
+		worker.join();
+	}
+	stop = false;
+	if (!buffers.empty()) {
+		glDeleteBuffers(GLsizei(buffers.size()), buffers.data());
+	}
+	for (size_t t = 0; t < textures.size(); ++t) {
+		if (textures[t].name != 0) {
+			glDeleteTextures(1, &textures[t].name);
+		}
+	}
+	buffers.clear();
+	textures.clear();
+	primitive_list.clear();
+	draw_node_list.clear();
+	decoded.clear();
+}
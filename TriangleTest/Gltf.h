@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include "PngDecoder.h"
+#include "Transforms.h"
+
+/* How glVertexAttribPointer reads one accessor, straight out of the buffer
+object made from its bufferView. buffer is 0 when the primitive lacks it */
+struct GltfAttribute {
+	GLuint buffer;
+	GLint components;
+	GLenum type;
+	GLboolean normalized;
+	GLsizei stride;
+	size_t offset;
+};
+
+struct GltfPrimitive {
+	GLenum mode;
+	GltfAttribute position;
+	GltfAttribute normal;
+	GltfAttribute color;
+	GltfAttribute texcoord;
+	//Without index buffer count vertices are drawn with glDrawArrays
+	GLuint index_buffer;
+	GLenum index_type;
+	size_t index_offset;
+	GLsizei count;
+	//Base color factor and texture (-1 for none) of the material
+	glm::vec4 base_color;
+	int texture;
+	//Model space box of the POSITION accessor
+	glm::vec3 low;
+	glm::vec3 high;
+};
+
+//Node of the hierarchy that draws a mesh
+struct GltfDrawNode {
+	unsigned int node;
+	size_t first_primitive;
+	size_t primitive_count;
+};
+
+/* glTF 2.0 scene (.gltf with external or embedded buffers, or .glb). Every
+bufferView holding geometry becomes one GL buffer, filled directly from the
+memory mapped file, and the accessors only describe how to read it: offset,
+stride and component type go to glVertexAttribPointer as they are. Nodes are
+added to a TransformHierarchy. PNG images are decoded on a worker thread
+and uploaded by poll_textures() as they arrive, the scene draws untextured
+until then */
+class GltfScene {
+public:
+	GltfScene();
+	~GltfScene();
+
+	/* Load the default scene below parent, needs a current context. Prints
+	the reason to std::cerr and returns false on failure */
+	bool load(const std::string& path, TransformHierarchy& hierarchy, unsigned int parent);
+	void destroy();
+
+	//Upload the textures decoded since the last call, returns how many. GL thread only
+	size_t poll_textures();
+	//GL texture, 0 while it is still loading or when it failed
+	GLuint texture(int index) const;
+
+	const std::vector<GltfPrimitive>& primitives() const { return primitive_list; }
+	const std::vector<GltfDrawNode>& draw_nodes() const { return draw_node_list; }
+
+	//World space box of every primitive as of the last hierarchy update, false when empty
+	bool bounds(const TransformHierarchy& hierarchy, glm::vec3& low, glm::vec3& high) const;
+
+private:
+	GltfScene(const GltfScene&);
+	GltfScene& operator=(const GltfScene&);
+
+	struct Texture {
+		int image;
+		GLint min_filter;
+		GLint mag_filter;
+		GLint wrap_s;
+		GLint wrap_t;
+		GLuint name;
+	};
+
+	/* Encoded image bytes, owner keeps them alive while the worker reads.
+	Images from files are mapped by the worker itself */
+	struct ImageSource {
+		std::string path;
+		std::shared_ptr<const void> owner;
+		const unsigned char* data;
+		size_t size;
+	};
+
+	struct DecodedImage {
+		int image;
+		Image pixels;
+	};
+
+	void decode_images(std::vector<ImageSource> sources);
+
+	std::vector<GltfPrimitive> primitive_list;
+	std::vector<GltfDrawNode> draw_node_list;
+	std::vector<GLuint> buffers;
+	std::vector<Texture> textures;
+
+	std::thread worker;
+	std::atomic<bool> stop;
+	std::mutex decoded_mutex;
+	std::vector<DecodedImage> decoded;
+};
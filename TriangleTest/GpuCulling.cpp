@@ -0,0 +1,308 @@
+#include "GpuCulling.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "Frustum.h"
+
+// Define a helpful macro for handling offsets into buffer objects
+#define BUFFER_OFFSET( offset )   ((GLvoid*) (offset))
+
+namespace {
+
+const GLuint LOCAL_SIZE = 64;
+const GLuint PYRAMID_LOCAL_SIZE = 8;
+
+const char* cull_shader_src =
+	"#version 430\n"
+	"layout(local_size_x = 64) in;\n"
+	"\n"
+	"struct DrawCommand {\n"
+	"\tuint count;\n"
+	"\tuint instanceCount;\n"
+	"\tuint firstIndex;\n"
+	"\tint baseVertex;\n"
+	"\tuint baseInstance;\n"
+	"};\n"
+	"\n"
+	"struct CullObject {\n"
+	"\tvec4 sphere;\n"
+	"\tvec4 cone;\n"
+	"\tDrawCommand command;\n"
+	"\tuint padding0;\n"
+	"\tuint padding1;\n"
+	"\tuint padding2;\n"
+	"};\n"
+	"\n"
+	"layout(std430, binding = 0) readonly buffer Objects {\n"
+	"\tCullObject objects[];\n"
+	"};\n"
+	"layout(std430, binding = 1) writeonly buffer Commands {\n"
+	"\tDrawCommand commands[];\n"
+	"};\n"
+	"layout(std430, binding = 2) buffer Count {\n"
+	"\tuint draw_count;\n"
+	"};\n"
+	"\n"
+	"uniform uint object_count;\n"
+	"uniform vec4 planes[6];\n"
+	"uniform mat4 PV;\n"
+	"uniform vec3 camera_position;\n"
+	"uniform bool use_depth_pyramid;\n"
+	"uniform sampler2D depth_pyramid;\n"
+	"uniform vec2 pyramid_size;\n"
+	"uniform int pyramid_levels;\n"
+	"\n"
+	"bool in_frustum(vec4 sphere) {\n"
+	"\tfor (int i = 0; i < 6; ++i) {\n"
+	"\t\tif (dot(planes[i], vec4(sphere.xyz, 1.0)) < -sphere.w) {\n"
+	"\t\t\treturn false;\n"
+	"\t\t}\n"
+	"\t}\n"
+	"\treturn true;\n"
+	"}\n"
+	"\n"
+	"//Every triangle inside faces away from the camera\n"
+	"bool is_backfacing(vec4 sphere, vec4 cone) {\n"
+	"\tvec3 to_center = sphere.xyz - camera_position;\n"
+	"\treturn dot(to_center, cone.xyz) >= cone.w * length(to_center) + sphere.w;\n"
+	"}\n"
+	"\n"
+	"/* Project the box around the sphere, compare its nearest depth with the\n"
+	"farthest depth of the pyramid texels that cover it */\n"
+	"bool is_occluded(vec4 sphere) {\n"
+	"\tvec3 box_min = vec3(1.0);\n"
+	"\tvec3 box_max = vec3(0.0);\n"
+	"\tfor (int i = 0; i < 8; ++i) {\n"
+	"\t\tvec3 corner = sphere.xyz + sphere.w * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);\n"
+	"\t\tvec4 clip = PV * vec4(corner, 1.0);\n"
+	"\t\t//Crossing the near plane, keep it\n"
+	"\t\tif (clip.w <= 0.0) {\n"
+	"\t\t\treturn false;\n"
+	"\t\t}\n"
+	"\t\tvec3 window = 0.5 * clip.xyz / clip.w + 0.5;\n"
+	"\t\tbox_min = min(box_min, window);\n"
+	"\t\tbox_max = max(box_max, window);\n"
+	"\t}\n"
+	"\tbox_min.xy = clamp(box_min.xy, 0.0, 1.0);\n"
+	"\tbox_max.xy = clamp(box_max.xy, 0.0, 1.0);\n"
+	"\tvec2 extent = (box_max.xy - box_min.xy) * pyramid_size;\n"
+	"\t//Level where the box covers at most 2x2 texels\n"
+	"\tint level = int(ceil(log2(max(max(extent.x, extent.y), 1.0))));\n"
+	"\tlevel = clamp(level, 0, pyramid_levels - 1);\n"
+	"\tivec2 size = textureSize(depth_pyramid, level);\n"
+	"\tivec2 lo = clamp(ivec2(box_min.xy * vec2(size)), ivec2(0), size - 1);\n"
+	"\tivec2 hi = clamp(ivec2(box_max.xy * vec2(size)), ivec2(0), size - 1);\n"
+	"\tfloat depth = max(max(texelFetch(depth_pyramid, lo, level).r, texelFetch(depth_pyramid, ivec2(hi.x, lo.y), level).r),\n"
+	"\t\tmax(texelFetch(depth_pyramid, ivec2(lo.x, hi.y), level).r, texelFetch(depth_pyramid, hi, level).r));\n"
+	"\treturn box_min.z > depth;\n"
+	"}\n"
+	"\n"
+	"void main(void) {\n"
+	"\tuint id = gl_GlobalInvocationID.x;\n"
+	"\tif (id >= object_count) {\n"
+	"\t\treturn;\n"
+	"\t}\n"
+	"\tvec4 sphere = objects[id].sphere;\n"
+	"\tif (!in_frustum(sphere) || is_backfacing(sphere, objects[id].cone)) {\n"
+	"\t\treturn;\n"
+	"\t}\n"
+	"\tif (use_depth_pyramid && is_occluded(sphere)) {\n"
+	"\t\treturn;\n"
+	"\t}\n"
+	"\tuint slot = atomicAdd(draw_count, 1u);\n"
+	"\tcommands[slot] = objects[id].command;\n"
+	"}\n";
+
+/* Every texel of a level keeps the farthest depth of the texels it covers
+in the level below. Odd sizes fold the extra row and column in */
+const char* pyramid_shader_src =
+	"#version 430\n"
+	"layout(local_size_x = 8, local_size_y = 8) in;\n"
+	"\n"
+	"uniform sampler2D source;\n"
+	"uniform int source_level;\n"
+	"layout(r32f, binding = 0) writeonly uniform image2D destination;\n"
+	"\n"
+	"void main(void) {\n"
+	"\tivec2 coord = ivec2(gl_GlobalInvocationID.xy);\n"
+	"\tivec2 size = imageSize(destination);\n"
+	"\tif (any(greaterThanEqual(coord, size))) {\n"
+	"\t\treturn;\n"
+	"\t}\n"
+	"\tivec2 source_size = textureSize(source, source_level);\n"
+	"\tivec2 first = coord * source_size / size;\n"
+	"\tivec2 last = max(first, ((coord + 1) * source_size + size - 1) / size - 1);\n"
+	"\tfloat depth = 0.0;\n"
+	"\tfor (int y = first.y; y <= last.y; ++y) {\n"
+	"\t\tfor (int x = first.x; x <= last.x; ++x) {\n"
+	"\t\t\tdepth = max(depth, texelFetch(source, min(ivec2(x, y), source_size - 1), source_level).r);\n"
+	"\t\t}\n"
+	"\t}\n"
+	"\timageStore(destination, coord, vec4(depth));\n"
+	"}\n";
+
+GLuint create_compute_program(const char* source) {
+	GLuint shader = glCreateShader(GL_COMPUTE_SHADER);
+	glShaderSource(shader, 1, &source, nullptr);
+	glCompileShader(shader);
+	int status;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+	if (status == GL_FALSE) {
+		std::cerr << "Compute shader was not compiled!!" << std::endl;
+	}
+	GLuint program = glCreateProgram();
+	glAttachShader(program, shader);
+	glLinkProgram(program);
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
+	if (status == GL_FALSE) {
+		std::cerr << "OpenGL compute program was not linked!!" << std::endl;
+	}
+	glDeleteShader(shader);
+	return program;
+}
+
+}//namespace
+
+GpuCuller::GpuCuller() : cull_program(0), pyramid_program(0), object_buffer(0), command_buffer(0), count_buffer(0),
+	pyramid_texture(0), pyramid_width(0), pyramid_height(0), pyramid_levels(0), object_count(0) {
+}
+
+bool GpuCuller::create() {
+	if (!GLEW_VERSION_4_3 && !GLEW_ARB_compute_shader) {
+		std::cerr << "GPU culling needs compute shaders (OpenGL 4.3)" << std::endl;
+		return false;
+	}
+	cull_program = create_compute_program(cull_shader_src);
+	pyramid_program = create_compute_program(pyramid_shader_src);
+	glGenBuffers(1, &object_buffer);
+	glGenBuffers(1, &command_buffer);
+	glGenBuffers(1, &count_buffer);
+	GLuint zero = 0;
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, count_buffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(GLuint), &zero, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	return true;
+}
+
+void GpuCuller::destroy() {
+	glDeleteProgram(cull_program);
+	glDeleteProgram(pyramid_program);
+	glDeleteBuffers(1, &object_buffer);
+	glDeleteBuffers(1, &command_buffer);
+	glDeleteBuffers(1, &count_buffer);
+	glDeleteTextures(1, &pyramid_texture);
+	pyramid_texture = 0;
+	object_count = 0;
+}
+
+void GpuCuller::set_objects(const std::vector<CullObject>& objects) {
+	object_count = GLuint(objects.size());
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, object_buffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, objects.size() * sizeof(CullObject), objects.data(), GL_STATIC_DRAW);
+	//Worst case every object is visible
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, command_buffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, objects.size() * sizeof(DrawElementsIndirectCommand), nullptr, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void GpuCuller::build_depth_pyramid(GLuint depth_texture, int width, int height) {
+	/* (Re)allocate the pyramid when the window size changes */
+	if (pyramid_texture == 0 || width != pyramid_width || height != pyramid_height) {
+		glDeleteTextures(1, &pyramid_texture);
+		pyramid_width = width;
+		pyramid_height = height;
+		pyramid_levels = 1;
+		while ((std::max(width, height) >> pyramid_levels) > 0) {
+			++pyramid_levels;
+		}
+		glGenTextures(1, &pyramid_texture);
+		glBindTexture(GL_TEXTURE_2D, pyramid_texture);
+		glTexStorage2D(GL_TEXTURE_2D, pyramid_levels, GL_R32F, width, height);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
+	glUseProgram(pyramid_program);
+	glUniform1i(glGetUniformLocation(pyramid_program, "source"), 0);
+	GLint source_level_loc = glGetUniformLocation(pyramid_program, "source_level");
+	glActiveTexture(GL_TEXTURE0);
+	for (int level = 0; level < pyramid_levels; ++level) {
+		//Level 0 copies the depth buffer, the others reduce the previous level
+		glBindTexture(GL_TEXTURE_2D, level == 0 ? depth_texture : pyramid_texture);
+		glUniform1i(source_level_loc, level == 0 ? 0 : level - 1);
+		glBindImageTexture(0, pyramid_texture, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+		GLuint w = GLuint(std::max(1, pyramid_width >> level));
+		GLuint h = GLuint(std::max(1, pyramid_height >> level));
+		glDispatchCompute((w + PYRAMID_LOCAL_SIZE - 1) / PYRAMID_LOCAL_SIZE, (h + PYRAMID_LOCAL_SIZE - 1) / PYRAMID_LOCAL_SIZE, 1);
+		glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glUseProgram(0);
+}
+
+void GpuCuller::cull(const glm::mat4& PV, const glm::vec3& camera_position, bool use_depth_pyramid) {
+	glm::vec4 planes[6];
+	extract_frustum_planes(PV, planes);
+	use_depth_pyramid = use_depth_pyramid && pyramid_texture != 0;
+
+	/* Reset the draw count, and the commands too when the GPU can not read
+	the count: the draw then submits every slot and zeroed ones draw nothing */
+	GLuint zero = 0;
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, count_buffer);
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(GLuint), &zero);
+	if (!GLEW_ARB_indirect_parameters) {
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, command_buffer);
+		glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+	}
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+	glUseProgram(cull_program);
+	glUniform1ui(glGetUniformLocation(cull_program, "object_count"), object_count);
+	glUniform4fv(glGetUniformLocation(cull_program, "planes"), 6, glm::value_ptr(planes[0]));
+	glUniformMatrix4fv(glGetUniformLocation(cull_program, "PV"), 1, GL_FALSE, glm::value_ptr(PV));
+	glUniform3fv(glGetUniformLocation(cull_program, "camera_position"), 1, glm::value_ptr(camera_position));
+	glUniform1i(glGetUniformLocation(cull_program, "use_depth_pyramid"), use_depth_pyramid ? 1 : 0);
+	glUniform1i(glGetUniformLocation(cull_program, "depth_pyramid"), 0);
+	glUniform2f(glGetUniformLocation(cull_program, "pyramid_size"), float(pyramid_width), float(pyramid_height));
+	glUniform1i(glGetUniformLocation(cull_program, "pyramid_levels"), pyramid_levels);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, use_depth_pyramid ? pyramid_texture : 0);
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, object_buffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, command_buffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, count_buffer);
+	glDispatchCompute((object_count + LOCAL_SIZE - 1) / LOCAL_SIZE, 1, 1);
+	//The commands and the count are consumed by the indirect draw
+	glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glUseProgram(0);
+}
+
+void GpuCuller::draw(GLenum index_type) {
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, command_buffer);
+	if (GLEW_ARB_indirect_parameters) {
+		glBindBuffer(GL_PARAMETER_BUFFER_ARB, count_buffer);
+		glMultiDrawElementsIndirectCountARB(GL_TRIANGLES, index_type, BUFFER_OFFSET(0), 0, GLsizei(object_count), 0);
+		glBindBuffer(GL_PARAMETER_BUFFER_ARB, 0);
+	} else {
+		glMultiDrawElementsIndirect(GL_TRIANGLES, index_type, BUFFER_OFFSET(0), GLsizei(object_count), 0);
+	}
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+GLuint GpuCuller::read_visible_count() const {
+	GLuint count = 0;
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, count_buffer);
+	glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(GLuint), &count);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	return count;
+}
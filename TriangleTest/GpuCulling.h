@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+
+#include <GL/glew.h>
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+#include "GeometryPool.h"
+
+//One cullable draw, mirrors the std430 layout of the compute shader (64 bytes)
+struct CullObject {
+	//World space bounding sphere, center in xyz and radius in w
+	glm::vec4 sphere;
+	/* Normal cone (see MeshletBounds), culls the object when it faces away
+	from the camera. (0, 0, 0, 1) disables the test */
+	glm::vec4 cone;
+	//Command written to the output when the object survives
+	DrawElementsIndirectCommand command;
+	GLuint padding[3];
+};
+
+/* Compute pass that tests every object against the frustum and its normal cone (and optionally
+a depth pyramid of the previous frame) and appends the surviving commands to
+an indirect buffer. The CPU only dispatches, its cost does not depend on the
+number of objects. Needs OpenGL 4.3, nothing beyond core compute so it also
+runs on Mesa llvmpipe */
+class GpuCuller {
+public:
+	GpuCuller();
+
+	//Compile the compute programs, false when compute shaders are missing
+	bool create();
+	void destroy();
+
+	//Upload the objects and size the output buffers for all of them
+	void set_objects(const std::vector<CullObject>& objects);
+
+	//Max reduce the depth texture into the occlusion pyramid
+	void build_depth_pyramid(GLuint depth_texture, int width, int height);
+
+	//Run the culling compute pass, the results are ready for draw()
+	void cull(const glm::mat4& PV, const glm::vec3& camera_position, bool use_depth_pyramid);
+
+	//Draw the surviving commands with the current VBO/IBO and program
+	void draw(GLenum index_type = GL_UNSIGNED_SHORT);
+
+	//Number of objects that passed the last cull, reads back from the GPU (slow)
+	GLuint read_visible_count() const;
+
+private:
+	GLuint cull_program;
+	GLuint pyramid_program;
+	GLuint object_buffer;
+	GLuint command_buffer;
+	//Holds the atomic draw count, also bound as GL_PARAMETER_BUFFER_ARB
+	GLuint count_buffer;
+	GLuint pyramid_texture;
+	int pyramid_width;
+	int pyramid_height;
+	int pyramid_levels;
+	GLuint object_count;
+};
@@ -0,0 +1,194 @@
+#include "GpuSkinning.h"
+
+#include <iostream>
+
+#include <glm/gtc/type_ptr.hpp>
+
+namespace {
+
+//Same math as the skin_dual_quaternions kernels
+const char* skinning_vertex_shader_src =
+	"#version 430\n"
+	"in vec3 Position;\n"
+	"in vec3 Normal;\n"
+	"in uvec4 Joints;\n"
+	"in vec4 Weights;\n"
+	"\n"
+	"struct Bone {\n"
+	"\tvec4 real;\n"
+	"\tvec4 dual;\n"
+	"};\n"
+	"\n"
+	"layout(std430, binding = 0) readonly buffer Bones {\n"
+	"\tBone bones[];\n"
+	"};\n"
+	"\n"
+	"uniform mat4 PVM;\n"
+	"\n"
+	"out vec4 vColor;\n"
+	"\n"
+	"void main(void) {\n"
+	"\t//Weighted sum of the bones, each on the side of the first one\n"
+	"\tBone first = bones[Joints.x];\n"
+	"\tvec4 real = Weights.x * first.real;\n"
+	"\tvec4 dual = Weights.x * first.dual;\n"
+	"\tfor (int i = 1; i < 4; ++i) {\n"
+	"\t\tBone bone = bones[Joints[i]];\n"
+	"\t\tfloat weight = dot(bone.real, first.real) < 0.0 ? -Weights[i] : Weights[i];\n"
+	"\t\treal += weight * bone.real;\n"
+	"\t\tdual += weight * bone.dual;\n"
+	"\t}\n"
+	"\tfloat scale = inversesqrt(dot(real, real));\n"
+	"\treal *= scale;\n"
+	"\tdual *= scale;\n"
+	"\tvec3 position = Position + 2.0 * (cross(real.xyz, cross(real.xyz, Position) + real.w * Position + dual.xyz) + real.w * dual.xyz - dual.w * real.xyz);\n"
+	"\tvec3 normal = Normal + 2.0 * cross(real.xyz, cross(real.xyz, Normal) + real.w * Normal);\n"
+	"\tgl_Position = PVM * vec4(position, 1.0);\n"
+	"\tvColor = vec4(0.5 * normal + 0.5, 1.0);\n"
+	"}\n";
+
+const char* skinning_fragment_shader_src =
+	"#version 430\n"
+	"\n"
+	"in vec4 vColor;\n"
+	"\n"
+	"out vec4 fragcolor;\n"
+	"\n"
+	"void main(void) {\n"
+	"\tfragcolor = vColor;\n"
+	"}\n";
+
+GLuint create_skinning_program() {
+	GLuint vertex = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(vertex, 1, &skinning_vertex_shader_src, nullptr);
+	GLuint fragment = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(fragment, 1, &skinning_fragment_shader_src, nullptr);
+	int status;
+	glCompileShader(vertex);
+	glGetShaderiv(vertex, GL_COMPILE_STATUS, &status);
+	if (status == GL_FALSE) {
+		std::cerr << "Skinning vertex shader was not compiled!!" << std::endl;
+	}
+	glCompileShader(fragment);
+	glGetShaderiv(fragment, GL_COMPILE_STATUS, &status);
+	if (status == GL_FALSE) {
+		std::cerr << "Skinning fragment shader was not compiled!!" << std::endl;
+	}
+	GLuint program = glCreateProgram();
+	glAttachShader(program, vertex);
+	glAttachShader(program, fragment);
+	glLinkProgram(program);
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
+	if (status == GL_FALSE) {
+		std::cerr << "OpenGL skinning program was not linked!!" << std::endl;
+	}
+	glDeleteShader(vertex);
+	glDeleteShader(fragment);
+	return program;
+}
+
+template <typename T>
+void upload_array(GLuint buffer, const std::vector<T>& data) {
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(T), data.data(), GL_STATIC_DRAW);
+}
+
+}//namespace
+
+GpuSkinner::GpuSkinner() : program(0), u_PVM_location(-1), a_position_loc(-1), a_normal_loc(-1), a_joints_loc(-1), a_weights_loc(-1),
+	position_buffer(0), normal_buffer(0), joint_buffer(0), weight_buffer(0), index_buffer(0), bone_buffer(0), index_count(0) {
+}
+
+bool GpuSkinner::create() {
+	if (!GLEW_VERSION_4_3 && !GLEW_ARB_shader_storage_buffer_object) {
+		std::cerr << "GPU skinning needs shader storage buffers (OpenGL 4.3)" << std::endl;
+		return false;
+	}
+	program = create_skinning_program();
+	u_PVM_location = glGetUniformLocation(program, "PVM");
+	a_position_loc = glGetAttribLocation(program, "Position");
+	a_normal_loc = glGetAttribLocation(program, "Normal");
+	a_joints_loc = glGetAttribLocation(program, "Joints");
+	a_weights_loc = glGetAttribLocation(program, "Weights");
+	glGenBuffers(1, &position_buffer);
+	glGenBuffers(1, &normal_buffer);
+	glGenBuffers(1, &joint_buffer);
+	glGenBuffers(1, &weight_buffer);
+	glGenBuffers(1, &index_buffer);
+	glGenBuffers(1, &bone_buffer);
+	return true;
+}
+
+void GpuSkinner::destroy() {
+	glDeleteProgram(program);
+	glDeleteBuffers(1, &position_buffer);
+	glDeleteBuffers(1, &normal_buffer);
+	glDeleteBuffers(1, &joint_buffer);
+	glDeleteBuffers(1, &weight_buffer);
+	glDeleteBuffers(1, &index_buffer);
+	glDeleteBuffers(1, &bone_buffer);
+	index_count = 0;
+}
+
+void GpuSkinner::set_mesh(const SkinnedMesh& mesh, const std::vector<unsigned int>& indices) {
+	upload_array(position_buffer, mesh.positions);
+	upload_array(normal_buffer, mesh.normals);
+	upload_array(joint_buffer, mesh.joints);
+	upload_array(weight_buffer, mesh.weights);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	index_count = GLsizei(indices.size());
+}
+
+void GpuSkinner::set_bones(const std::vector<glm::fdualquat>& bones) {
+	//A new store every pose, the driver does not wait for the draws still reading the last one
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, bone_buffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, bones.size() * sizeof(glm::fdualquat), bones.data(), GL_STREAM_DRAW);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void GpuSkinner::draw(const glm::mat4& PVM) {
+	glUseProgram(program);
+	if (u_PVM_location != -1) {
+		glUniformMatrix4fv(u_PVM_location, 1, GL_FALSE, glm::value_ptr(PVM));
+	}
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, bone_buffer);
+
+	if (a_position_loc != -1) {
+		glBindBuffer(GL_ARRAY_BUFFER, position_buffer);
+		glEnableVertexAttribArray(a_position_loc);
+		glVertexAttribPointer(a_position_loc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+	}
+	if (a_normal_loc != -1) {
+		glBindBuffer(GL_ARRAY_BUFFER, normal_buffer);
+		glEnableVertexAttribArray(a_normal_loc);
+		glVertexAttribPointer(a_normal_loc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+	}
+	if (a_joints_loc != -1) {
+		//Integer attribute, the shader indexes the bones with it
+		glBindBuffer(GL_ARRAY_BUFFER, joint_buffer);
+		glEnableVertexAttribArray(a_joints_loc);
+		glVertexAttribIPointer(a_joints_loc, 4, GL_UNSIGNED_SHORT, 0, nullptr);
+	}
+	if (a_weights_loc != -1) {
+		glBindBuffer(GL_ARRAY_BUFFER, weight_buffer);
+		glEnableVertexAttribArray(a_weights_loc);
+		glVertexAttribPointer(a_weights_loc, 4, GL_FLOAT, GL_FALSE, 0, nullptr);
+	}
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer);
+
+	glDrawElements(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, nullptr);
+
+	const GLint locations[] = { a_position_loc, a_normal_loc, a_joints_loc, a_weights_loc };
+	for (GLint location : locations) {
+		if (location != -1) {
+			glDisableVertexAttribArray(location);
+		}
+	}
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	glUseProgram(0);
+}
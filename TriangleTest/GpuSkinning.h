@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+
+#include <GL/glew.h>
+#include <glm/mat4x4.hpp>
+#include <glm/gtx/dual_quaternion.hpp>
+
+#include "Skinning.h"
+
+/* Dual quaternion skinning in the vertex shader. The bones live in a shader
+storage buffer holding the bytes of the CPU palette, the vertices keep
+their bind pose and the arrays of SkinnedMesh as attributes, so a frame
+only uploads 32 bytes per bone. Colored by the skinned normal. Needs
+OpenGL 4.3 for the storage buffer */
+class GpuSkinner {
+public:
+	GpuSkinner();
+
+	//Compile the skinning program, false when shader storage buffers are missing
+	bool create();
+	void destroy();
+
+	//Upload the bind pose, the influences and the triangles of the mesh
+	void set_mesh(const SkinnedMesh& mesh, const std::vector<unsigned int>& indices);
+
+	//Upload the pose, as skin_dual_quaternions reads it
+	void set_bones(const std::vector<glm::fdualquat>& bones);
+
+	//Draw the mesh in its current pose with the skinning program
+	void draw(const glm::mat4& PVM);
+
+private:
+	GLuint program;
+	GLint u_PVM_location;
+	GLint a_position_loc;
+	GLint a_normal_loc;
+	GLint a_joints_loc;
+	GLint a_weights_loc;
+	GLuint position_buffer;
+	GLuint normal_buffer;
+	GLuint joint_buffer;
+	GLuint weight_buffer;
+	GLuint index_buffer;
+	GLuint bone_buffer;
+	GLsizei index_count;
+};
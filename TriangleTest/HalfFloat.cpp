@@ -0,0 +1,44 @@
+#include "HalfFloat.h"
+
+#include <algorithm>
+
+#include "MathDispatch.h"
+#include "Parallel.h"
+
+namespace {
+
+//Smallest part, whole 32 bytes lines of floats and halves
+const size_t HALF_GRAIN = 65536;
+
+//One part per thread, so the kernels see the largest outputs and stream the big ones
+size_t half_grain(size_t count) {
+	size_t threads = ThreadPool::shared().size();
+	size_t part = (count + threads - 1) / threads;
+	return std::max(HALF_GRAIN, (part + HALF_GRAIN - 1) / HALF_GRAIN * HALF_GRAIN);
+}
+
+}//namespace
+
+void to_halfs(const float* in, glm::uint16* out, size_t count) {
+	ThreadPool::shared().parallel_for(count, half_grain(count), [&](size_t begin, size_t end) {
+		pack_halfs(in + begin, out + begin, end - begin);
+	});
+}
+
+void to_floats(const glm::uint16* in, float* out, size_t count) {
+	ThreadPool::shared().parallel_for(count, half_grain(count), [&](size_t begin, size_t end) {
+		unpack_halfs(in + begin, out + begin, end - begin);
+	});
+}
+
+std::vector<glm::uint16> to_halfs(const std::vector<float>& values) {
+	std::vector<glm::uint16> halfs(values.size());
+	to_halfs(values.data(), halfs.data(), values.size());
+	return halfs;
+}
+
+std::vector<float> to_floats(const std::vector<glm::uint16>& halfs) {
+	std::vector<float> values(halfs.size());
+	to_floats(halfs.data(), values.data(), halfs.size());
+	return values;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/fwd.hpp>
+
+/* Floats to half floats (GL_HALF_FLOAT) and back for vertex streams and HDR
+images. The array is split over the shared thread pool, one part per
+thread, and each part goes through the kernels of MathDispatch.h: F16C on
+AVX2 CPUs, two table lookups per value elsewhere, both giving the same
+bits. Rounded to nearest even. A part writing 4 MB or more goes out with
+streaming stores (see glm/gtx/batch_half.hpp), which leave the cache to
+the input. in and out must not overlap */
+void to_halfs(const float* in, glm::uint16* out, size_t count);
+void to_floats(const glm::uint16* in, float* out, size_t count);
+
+std::vector<glm::uint16> to_halfs(const std::vector<float>& values);
+std::vector<float> to_floats(const std::vector<glm::uint16>& halfs);
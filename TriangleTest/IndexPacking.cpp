@@ -0,0 +1,112 @@
+#include "IndexPacking.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+//Vertices a 16 bits index reaches from its base vertex
+const unsigned int SHORT_INDEX_SPAN = 65536;
+
+/* Greedy split of one range: a chunk grows while its lowest and highest
+vertex stay less than SHORT_INDEX_SPAN apart. False when a single triangle
+does not fit */
+bool split_range(const std::vector<unsigned int>& indices, const IndexRange& range, std::vector<IndexChunk>& chunks) {
+	const unsigned int end = range.first_index + range.index_count;
+	unsigned int chunk_first = range.first_index;
+	unsigned int low = 0;
+	unsigned int high = 0;
+	for (unsigned int i = range.first_index; i + 3 <= end; i += 3) {
+		unsigned int triangle_low = std::min(indices[i], std::min(indices[i + 1], indices[i + 2]));
+		unsigned int triangle_high = std::max(indices[i], std::max(indices[i + 1], indices[i + 2]));
+		if (triangle_high - triangle_low >= SHORT_INDEX_SPAN) {
+			return false;
+		}
+		if (i == chunk_first) {
+			low = triangle_low;
+			high = triangle_high;
+		} else if (std::max(high, triangle_high) - std::min(low, triangle_low) >= SHORT_INDEX_SPAN) {
+			IndexChunk chunk = { chunk_first, i - chunk_first, low };
+			chunks.push_back(chunk);
+			chunk_first = i;
+			low = triangle_low;
+			high = triangle_high;
+		} else {
+			low = std::min(low, triangle_low);
+			high = std::max(high, triangle_high);
+		}
+	}
+	if (end > chunk_first) {
+		IndexChunk chunk = { chunk_first, end - chunk_first, low };
+		chunks.push_back(chunk);
+	}
+	return true;
+}
+
+//One chunk per range, from vertex zero
+void whole_ranges(const std::vector<IndexRange>& ranges, IndexLayout& layout) {
+	layout.chunks.clear();
+	layout.range_chunks.assign(1, 0);
+	for (size_t r = 0; r < ranges.size(); ++r) {
+		if (ranges[r].index_count > 0) {
+			IndexChunk chunk = { ranges[r].first_index, ranges[r].index_count, 0 };
+			layout.chunks.push_back(chunk);
+		}
+		layout.range_chunks.push_back(static_cast<unsigned int>(layout.chunks.size()));
+	}
+}
+
+}//namespace
+
+IndexLayout pack_indices(const std::vector<unsigned int>& indices, size_t vertex_count, const std::vector<IndexRange>& ranges,
+	std::vector<unsigned char>& packed) {
+	std::vector<IndexRange> all_ranges(ranges);
+	if (all_ranges.empty()) {
+		IndexRange everything = { 0, static_cast<unsigned int>(indices.size()) };
+		all_ranges.push_back(everything);
+	}
+	IndexLayout layout;
+	layout.index_size = 2;
+	whole_ranges(all_ranges, layout);
+
+	/************************************************************************/
+	/* Split when the mesh is too big for 16 bits and it pays off           */
+	/************************************************************************/
+	if (vertex_count > SHORT_INDEX_SPAN) {
+		std::vector<IndexChunk> chunks;
+		std::vector<unsigned int> range_chunks(1, 0);
+		size_t index_count = 0;
+		bool fits = true;
+		for (size_t r = 0; r < all_ranges.size() && fits; ++r) {
+			fits = split_range(indices, all_ranges[r], chunks);
+			range_chunks.push_back(static_cast<unsigned int>(chunks.size()));
+			index_count += all_ranges[r].index_count;
+		}
+		//Every range needs a call anyway, only the extra ones count
+		if (fits && chunks.size() <= std::max(all_ranges.size(), index_count / MIN_CHUNK_INDICES)) {
+			layout.chunks.swap(chunks);
+			layout.range_chunks.swap(range_chunks);
+		} else {
+			layout.index_size = 4;
+		}
+	}
+
+	/************************************************************************/
+	/* Write the indices relative to their chunk                            */
+	/************************************************************************/
+	packed.assign(indices.size() * layout.index_size, 0);
+	if (layout.index_size == 4) {
+		if (!packed.empty()) {
+			std::memcpy(packed.data(), indices.data(), packed.size());
+		}
+		return layout;
+	}
+	unsigned short* short_indices = reinterpret_cast<unsigned short*>(packed.data());
+	for (size_t c = 0; c < layout.chunks.size(); ++c) {
+		const IndexChunk& chunk = layout.chunks[c];
+		for (unsigned int i = chunk.first_index; i < chunk.first_index + chunk.index_count; ++i) {
+			short_indices[i] = static_cast<unsigned short>(indices[i] - chunk.base_vertex);
+		}
+	}
+	return layout;
+}
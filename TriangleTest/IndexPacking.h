@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+//Part of an index buffer drawn on its own, a LOD level for instance
+struct IndexRange {
+	unsigned int first_index;
+	unsigned int index_count;
+};
+
+//One draw call, its indices are relative to base_vertex
+struct IndexChunk {
+	unsigned int first_index;
+	unsigned int index_count;
+	unsigned int base_vertex;
+};
+
+/* How a packed index buffer is drawn: range i is the chunks
+[range_chunks[i], range_chunks[i + 1]) */
+struct IndexLayout {
+	//2 or 4 bytes per index
+	unsigned int index_size;
+	std::vector<IndexChunk> chunks;
+	std::vector<unsigned int> range_chunks;
+};
+
+//Below this many indices per draw, on average, splitting costs more in calls than it saves in bandwidth
+const unsigned int MIN_CHUNK_INDICES = 3 * 1024;
+
+/* Pick the narrowest index type that draws the mesh and write the indices in
+it. Meshes of up to 65536 vertices use 16 bits. Larger ones are split, each
+range into chunks whose vertices lie within 65536 of each other, drawn with a
+base vertex and still 16 bits; no vertex is duplicated. When a triangle
+spans more than that, or the chunks get too small to pay off, the whole
+buffer falls back to 32 bits. Vertices in first use order (see
+optimize_vertex_fetch) split best.
+An empty ranges list is one range over every index. Ranges must not overlap,
+indices outside of them are written as zero */
+IndexLayout pack_indices(const std::vector<unsigned int>& indices, size_t vertex_count, const std::vector<IndexRange>& ranges,
+	std::vector<unsigned char>& packed);
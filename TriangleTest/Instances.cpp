@@ -0,0 +1,54 @@
+#include "Instances.h"
+
+#include <cmath>
+#include <random>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+
+unsigned int grid_side(unsigned int count) {
+	unsigned int side = glm::max(1u, static_cast<unsigned int>(std::ceil(std::pow(double(count), 1.0 / 3.0))));
+	//pow may round down for perfect cubes
+	while (side * side * side < count) {
+		++side;
+	}
+	return side;
+}
+
+}//namespace
+
+std::vector<Instance> create_instance_grid(unsigned int count, float spacing) {
+	const float TAU = 6.28318f;
+	std::vector<Instance> instances(count);
+	const unsigned int side = grid_side(count);
+	const float offset = 0.5f * spacing * float(side - 1);
+
+	//Fixed seed so every run draws the same scene
+	std::mt19937 generator(1234);
+	std::uniform_real_distribution<float> angle(0.0f, TAU);
+	std::uniform_int_distribution<int> channel(64, 255);
+
+	for (unsigned int i = 0; i < count; ++i) {
+		glm::vec3 cell(float(i % side), float((i / side) % side), float(i / (side * side)));
+		glm::mat4 M = glm::translate(glm::mat4(1.0f), spacing * cell - offset);
+		M = glm::rotate(M, angle(generator), glm::vec3(0.0f, 1.0f, 0.0f));
+		//glm is column major, the instance stores rows
+		glm::mat4 rows = glm::transpose(M);
+		for (int r = 0; r < 3; ++r) {
+			instances[i].model_rows[r] = rows[r];
+		}
+		for (int c = 0; c < 3; ++c) {
+			instances[i].color[c] = static_cast<unsigned char>(channel(generator));
+		}
+		instances[i].color[3] = 255;
+	}
+	return instances;
+}
+
+float instance_grid_radius(unsigned int count, float spacing) {
+	const unsigned int side = grid_side(count);
+	//Half diagonal of the grid plus the unit size of one copy
+	return 0.5f * std::sqrt(3.0f) * spacing * float(side - 1) + 1.0f;
+}
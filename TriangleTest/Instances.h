@@ -0,0 +1,19 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/vec4.hpp>
+
+//Per instance attributes read with a divisor of 1 by the instanced draw
+struct Instance {
+	//First three rows of the model matrix, the last one is always (0, 0, 0, 1)
+	glm::vec4 model_rows[3];
+	//RGBA8 tint, normalized by the vertex attribute setup
+	unsigned char color[4];
+};
+
+//Cubic grid of randomly rotated and tinted copies, centered at the origin
+std::vector<Instance> create_instance_grid(unsigned int count, float spacing);
+
+//Radius of the sphere that contains the grid created with the same parameters
+float instance_grid_radius(unsigned int count, float spacing);
@@ -0,0 +1,273 @@
+#include "Json.h"
+
+#include <cstring>
+
+#include "FastParse.h"
+
+namespace {
+
+//Deeper documents are rejected instead of overflowing the stack
+const int MAX_DEPTH = 256;
+
+const char* skip_whitespace(const char* p, const char* end) {
+	while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) {
+		++p;
+	}
+	return p;
+}
+
+int hex_digit(char c) {
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+unsigned int read_hex4(const char* p, const char* end) {
+	unsigned int code = 0;
+	for (int i = 0; i < 4; ++i) {
+		int digit = p + i < end ? hex_digit(p[i]) : -1;
+		if (digit < 0) {
+			return 0xFFFD;
+		}
+		code = code * 16 + unsigned(digit);
+	}
+	return code;
+}
+
+void append_utf8(std::string& out, unsigned int code) {
+	if (code < 0x80) {
+		out += char(code);
+	} else if (code < 0x800) {
+		out += char(0xC0 | (code >> 6));
+		out += char(0x80 | (code & 0x3F));
+	} else if (code < 0x10000) {
+		out += char(0xE0 | (code >> 12));
+		out += char(0x80 | ((code >> 6) & 0x3F));
+		out += char(0x80 | (code & 0x3F));
+	} else {
+		out += char(0xF0 | (code >> 18));
+		out += char(0x80 | ((code >> 12) & 0x3F));
+		out += char(0x80 | ((code >> 6) & 0x3F));
+		out += char(0x80 | (code & 0x3F));
+	}
+}
+
+}//namespace
+
+bool JsonDocument::fail(const char* p, const char* reason) {
+	message = std::string(reason) + " at byte " + std::to_string(p - source);
+	return false;
+}
+
+bool JsonDocument::parse(const char* text, size_t size) {
+	source = text;
+	source_end = text + size;
+	tokens.clear();
+	message.clear();
+	//About one token every eight bytes in typical glTF
+	tokens.reserve(size / 8 + 1);
+	const char* p = skip_whitespace(text, source_end);
+	if (!parse_value(p, 0)) {
+		tokens.clear();
+		return false;
+	}
+	p = skip_whitespace(p, source_end);
+	if (p != source_end) {
+		tokens.clear();
+		return fail(p, "trailing characters");
+	}
+	return true;
+}
+
+bool JsonDocument::parse_value(const char*& p, int depth) {
+	if (depth > MAX_DEPTH) {
+		return fail(p, "nested too deep");
+	}
+	if (p >= source_end) {
+		return fail(p, "unexpected end");
+	}
+	const size_t index = tokens.size();
+	JsonToken token = { JSON_NULL, unsigned(p - source), 0, 0, 0 };
+	tokens.push_back(token);
+
+	if (*p == '{' || *p == '[') {
+		const bool object = *p == '{';
+		const char close = object ? '}' : ']';
+		tokens[index].type = object ? JSON_OBJECT : JSON_ARRAY;
+		p = skip_whitespace(p + 1, source_end);
+		unsigned int children = 0;
+		if (p < source_end && *p == close) {
+			++p;
+		} else {
+			for (;;) {
+				if (object) {
+					if (p >= source_end || *p != '"') {
+						return fail(p, "expected a key");
+					}
+					if (!parse_value(p, depth + 1)) {
+						return false;
+					}
+					p = skip_whitespace(p, source_end);
+					if (p >= source_end || *p != ':') {
+						return fail(p, "expected ':'");
+					}
+					p = skip_whitespace(p + 1, source_end);
+				}
+				if (!parse_value(p, depth + 1)) {
+					return false;
+				}
+				++children;
+				p = skip_whitespace(p, source_end);
+				if (p < source_end && *p == ',') {
+					p = skip_whitespace(p + 1, source_end);
+				} else if (p < source_end && *p == close) {
+					++p;
+					break;
+				} else {
+					return fail(p, object ? "expected ',' or '}'" : "expected ',' or ']'");
+				}
+			}
+		}
+		tokens[index].children = children;
+	} else if (*p == '"') {
+		tokens[index].type = JSON_STRING;
+		tokens[index].begin = unsigned(p + 1 - source);
+		for (++p; p < source_end && *p != '"'; ++p) {
+			if (*p == '\\') {
+				++p;
+			}
+		}
+		if (p >= source_end) {
+			return fail(p, "unterminated string");
+		}
+		tokens[index].end = unsigned(p - source);
+		++p;
+		tokens[index].next = unsigned(tokens.size());
+		return true;
+	} else if (*p == '-' || (*p >= '0' && *p <= '9')) {
+		tokens[index].type = JSON_NUMBER;
+		while (p < source_end && (std::strchr("+-.eE", *p) != nullptr || (*p >= '0' && *p <= '9'))) {
+			++p;
+		}
+	} else if (source_end - p >= 4 && std::strncmp(p, "true", 4) == 0) {
+		tokens[index].type = JSON_TRUE;
+		p += 4;
+	} else if (source_end - p >= 5 && std::strncmp(p, "false", 5) == 0) {
+		tokens[index].type = JSON_FALSE;
+		p += 5;
+	} else if (source_end - p >= 4 && std::strncmp(p, "null", 4) == 0) {
+		p += 4;
+	} else {
+		return fail(p, "unexpected character");
+	}
+	tokens[index].end = unsigned(p - source);
+	tokens[index].next = unsigned(tokens.size());
+	return true;
+}
+
+int JsonDocument::member(int object, const char* key) const {
+	if (object == NONE || tokens[object].type != JSON_OBJECT) {
+		return NONE;
+	}
+	for (int k = first_child(object); k != NONE; k = next_member(object, k)) {
+		if (string_equals(k, key)) {
+			return k + 1;
+		}
+	}
+	return NONE;
+}
+
+int JsonDocument::element(int array, unsigned int i) const {
+	if (array == NONE || tokens[array].type != JSON_ARRAY || i >= tokens[array].children) {
+		return NONE;
+	}
+	int e = array + 1;
+	for (; i > 0; --i) {
+		e = int(tokens[e].next);
+	}
+	return e;
+}
+
+int JsonDocument::first_child(int value) const {
+	return value != NONE && tokens[value].children > 0 ? value + 1 : NONE;
+}
+
+int JsonDocument::next_element(int array, int element) const {
+	unsigned int next = tokens[element].next;
+	return next < tokens[array].next ? int(next) : NONE;
+}
+
+int JsonDocument::next_member(int object, int key) const {
+	unsigned int next = tokens[key + 1].next;
+	return next < tokens[object].next ? int(next) : NONE;
+}
+
+double JsonDocument::number(int value, double fallback) const {
+	if (value == NONE || tokens[value].type != JSON_NUMBER) {
+		return fallback;
+	}
+	double result = fallback;
+	parse_double(source + tokens[value].begin, source + tokens[value].end, result);
+	return result;
+}
+
+int JsonDocument::integer(int value, int fallback) const {
+	return value == NONE || tokens[value].type != JSON_NUMBER ? fallback : int(number(value));
+}
+
+bool JsonDocument::boolean(int value, bool fallback) const {
+	if (value == NONE) {
+		return fallback;
+	}
+	return tokens[value].type == JSON_TRUE ? true : tokens[value].type == JSON_FALSE ? false : fallback;
+}
+
+std::string JsonDocument::string(int value) const {
+	std::string out;
+	if (value == NONE || tokens[value].type != JSON_STRING) {
+		return out;
+	}
+	const char* p = source + tokens[value].begin;
+	const char* end = source + tokens[value].end;
+	out.reserve(end - p);
+	for (; p < end; ++p) {
+		if (*p != '\\' || p + 1 >= end) {
+			out += *p;
+			continue;
+		}
+		++p;
+		switch (*p) {
+		case 'b': out += '\b'; break;
+		case 'f': out += '\f'; break;
+		case 'n': out += '\n'; break;
+		case 'r': out += '\r'; break;
+		case 't': out += '\t'; break;
+		case 'u': {
+			unsigned int code = read_hex4(p + 1, end);
+			p += 4;
+			//Surrogate pair
+			if (code >= 0xD800 && code < 0xDC00 && end - p > 6 && p[1] == '\\' && p[2] == 'u') {
+				unsigned int low = read_hex4(p + 3, end);
+				if (low >= 0xDC00 && low < 0xE000) {
+					code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+					p += 6;
+				}
+			}
+			append_utf8(out, code);
+			break;
+		}
+		default: out += *p; break;
+		}
+	}
+	return out;
+}
+
+bool JsonDocument::string_equals(int value, const char* text) const {
+	if (value == NONE || tokens[value].type != JSON_STRING) {
+		return false;
+	}
+	//Raw comparison, escaped text never matches
+	size_t length = tokens[value].end - tokens[value].begin;
+	return std::strlen(text) == length && std::memcmp(source + tokens[value].begin, text, length) == 0;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+enum JsonType {
+	JSON_NULL,
+	JSON_FALSE,
+	JSON_TRUE,
+	JSON_NUMBER,
+	JSON_STRING,
+	JSON_ARRAY,
+	JSON_OBJECT,
+};
+
+/* One value of a document. Numbers and strings are ranges of the source
+text, which has to outlive the document */
+struct JsonToken {
+	JsonType type;
+	//Range in the text, strings without their quotes
+	unsigned int begin;
+	unsigned int end;
+	//Direct children: elements of an array, key value pairs of an object
+	unsigned int children;
+	//Token right after this value and everything inside it
+	unsigned int next;
+};
+
+/* Minimal allocation JSON reader. parse() fills one array of tokens in
+document order and lookups walk it, no maps or strings are built. Every
+object member is a key token (a string) directly followed by its value.
+Walking the members of an object:
+	for (int key = json.first_child(object); key != JsonDocument::NONE; key = json.next_member(object, key))
+		value = key + 1 */
+class JsonDocument {
+public:
+	static const int NONE = -1;
+
+	//False on malformed text, error() tells why
+	bool parse(const char* text, size_t size);
+	const std::string& error() const { return message; }
+
+	int root() const { return tokens.empty() ? NONE : 0; }
+	JsonType type(int value) const { return tokens[value].type; }
+	unsigned int count(int value) const { return value == NONE ? 0 : tokens[value].children; }
+
+	//Value of key in object, NONE when missing or when object is not an object
+	int member(int object, const char* key) const;
+	//Element i of an array, NONE when out of range
+	int element(int array, unsigned int i) const;
+
+	int first_child(int value) const;
+	//Next element of array after element, NONE at the end
+	int next_element(int array, int element) const;
+	//Next key of object after key, NONE at the end
+	int next_member(int object, int key) const;
+
+	//The fallback is returned when value is missing or of another type
+	double number(int value, double fallback = 0.0) const;
+	int integer(int value, int fallback = -1) const;
+	bool boolean(int value, bool fallback = false) const;
+	//Unescaped copy, empty when value is not a string
+	std::string string(int value) const;
+	bool string_equals(int value, const char* text) const;
+
+private:
+	bool parse_value(const char*& p, int depth);
+	bool fail(const char* p, const char* reason);
+
+	const char* source;
+	const char* source_end;
+	std::vector<JsonToken> tokens;
+	std::string message;
+};
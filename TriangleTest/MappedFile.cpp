@@ -0,0 +1,110 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile() : file(INVALID_HANDLE_VALUE), mapping(nullptr), view(nullptr), length(0) {
+}
+
+bool MappedFile::open(const std::string& path) {
+	close();
+	file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size)) {
+		close();
+		return false;
+	}
+	length = static_cast<size_t>(file_size.QuadPart);
+	//Empty files can not be mapped, they are just empty
+	if (length == 0) {
+		return true;
+	}
+	mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr) {
+		close();
+		return false;
+	}
+	view = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	if (view == nullptr) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+void MappedFile::close() {
+	if (view) {
+		UnmapViewOfFile(view);
+	}
+	if (mapping) {
+		CloseHandle(mapping);
+	}
+	if (file != INVALID_HANDLE_VALUE) {
+		CloseHandle(file);
+	}
+	file = INVALID_HANDLE_VALUE;
+	mapping = nullptr;
+	view = nullptr;
+	length = 0;
+}
+
+#else
+
+MappedFile::MappedFile() : descriptor(-1), view(nullptr), length(0) {
+}
+
+bool MappedFile::open(const std::string& path) {
+	close();
+	descriptor = ::open(path.c_str(), O_RDONLY);
+	if (descriptor < 0) {
+		return false;
+	}
+	struct stat info;
+	if (fstat(descriptor, &info) != 0) {
+		close();
+		return false;
+	}
+	length = static_cast<size_t>(info.st_size);
+	if (length == 0) {
+		return true;
+	}
+	void* address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+	if (address == MAP_FAILED) {
+		close();
+		return false;
+	}
+	madvise(address, length, MADV_SEQUENTIAL);
+	view = static_cast<const char*>(address);
+	return true;
+}
+
+void MappedFile::close() {
+	if (view) {
+		munmap(const_cast<char*>(view), length);
+	}
+	if (descriptor >= 0) {
+		::close(descriptor);
+	}
+	descriptor = -1;
+	view = nullptr;
+	length = 0;
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+	close();
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/* Read only memory mapping of a whole file, the OS pages it in on demand
+so even multi GB files open instantly */
+class MappedFile {
+public:
+	MappedFile();
+	~MappedFile();
+
+	//False when the file can not be opened or mapped
+	bool open(const std::string& path);
+	void close();
+
+	const char* data() const { return view; }
+	size_t size() const { return length; }
+
+private:
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+
+#ifdef _WIN32
+	void* file;
+	void* mapping;
+#else
+	int descriptor;
+#endif
+	const char* view;
+	size_t length;
+};
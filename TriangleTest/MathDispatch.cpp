@@ -0,0 +1,87 @@
+#include "MathDispatch.h"
+
+const MathKernels& math_kernels() {
+	static const MathKernels& kernels = math_kernels(cpu_level());
+	return kernels;
+}
+
+namespace {
+
+/* Chosen before main: function statics are not thread safe with the v120
+toolset, and the first call often comes from several worker threads */
+const MathKernels& startup_kernels = math_kernels();
+
+}//namespace
+
+const MathKernels& math_kernels(CpuLevel level) {
+	switch (level) {
+	case CPU_AVX2:
+		return math_kernels_avx2();
+	case CPU_AVX:
+		return math_kernels_avx();
+	default:
+		return math_kernels_sse2();
+	}
+}
+
+void multiply_matrices(const glm::mat4* a, const glm::mat4* b, glm::mat4* out, size_t count) {
+	math_kernels().multiply_matrices(reinterpret_cast<const float*>(a), reinterpret_cast<const float*>(b), reinterpret_cast<float*>(out), count);
+}
+
+void invert_matrices(const glm::mat4* in, glm::mat4* out, size_t count) {
+	math_kernels().invert_matrices(reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count);
+}
+
+void transform_points(const glm::mat4& m, const void* in, size_t in_stride, void* out, size_t out_stride, size_t count) {
+	math_kernels().transform_points(&m[0][0], in, in_stride, out, out_stride, count);
+}
+
+void normalize_vectors(const glm::vec3* in, glm::vec3* out, size_t count) {
+	math_kernels().normalize_vectors(reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count);
+}
+
+void pack_snorm_3x10_1x2(const glm::vec4* in, unsigned int* out, size_t count) {
+	math_kernels().pack_vectors(PACK_SNORM_3X10_1X2, in, out, count);
+}
+
+void pack_vectors(PackFormat format, const void* in, void* out, size_t count) {
+	math_kernels().pack_vectors(format, in, out, count);
+}
+
+void unpack_vectors(PackFormat format, const void* in, void* out, size_t count) {
+	math_kernels().unpack_vectors(format, in, out, count);
+}
+
+void quats_to_mat3(const glm::quat* in, glm::mat3* out, size_t count) {
+	math_kernels().quats_to_mat3(reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count);
+}
+
+void skin_dual_quaternions(const glm::fdualquat* bones, const glm::u16vec4* joints, const glm::vec4* weights,
+	const glm::vec3* positions, const glm::vec3* normals, glm::vec3* out_positions, glm::vec3* out_normals, size_t count) {
+	math_kernels().skin_dual_quaternions(reinterpret_cast<const float*>(bones), reinterpret_cast<const unsigned short*>(joints),
+		reinterpret_cast<const float*>(weights), reinterpret_cast<const float*>(positions), reinterpret_cast<const float*>(normals),
+		reinterpret_cast<float*>(out_positions), reinterpret_cast<float*>(out_normals), count);
+}
+
+void skin_matrices(const glm::mat4* bones, const glm::u16vec4* joints, const glm::vec4* weights,
+	const glm::vec3* positions, const glm::vec3* normals, glm::vec3* out_positions, glm::vec3* out_normals, size_t count) {
+	math_kernels().skin_matrices(reinterpret_cast<const float*>(bones), reinterpret_cast<const unsigned short*>(joints),
+		reinterpret_cast<const float*>(weights), reinterpret_cast<const float*>(positions), reinterpret_cast<const float*>(normals),
+		reinterpret_cast<float*>(out_positions), reinterpret_cast<float*>(out_normals), count);
+}
+
+void perlin_row(const glm::vec4& origin, int dimensions, float step, size_t count, int octaves, float lacunarity, float gain, float* out) {
+	math_kernels().perlin_row(&origin[0], dimensions, step, count, octaves, lacunarity, gain, out);
+}
+
+void simplex_row(const glm::vec4& origin, int dimensions, float step, size_t count, int octaves, float lacunarity, float gain, float* out) {
+	math_kernels().simplex_row(&origin[0], dimensions, step, count, octaves, lacunarity, gain, out);
+}
+
+void pack_halfs(const float* in, glm::uint16* out, size_t count) {
+	math_kernels().pack_halfs(in, out, count);
+}
+
+void unpack_halfs(const glm::uint16* in, float* out, size_t count) {
+	math_kernels().unpack_halfs(in, out, count);
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+
+#include <glm/mat3x3.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_precision.hpp>
+#include <glm/gtx/dual_quaternion.hpp>
+
+#include "CpuFeatures.h"
+#include "MathKernels.h"
+
+/* Array versions of the hot glm functions, run by the kernels built for the
+best instruction set of this CPU (see MathKernels.h). The choice is made
+once, so one binary runs everywhere at each machine's speed. Results may
+differ in the last bits from one CPU to another, FMA rounds once */
+
+//Kernels used by the functions below, chosen on first use
+const MathKernels& math_kernels();
+
+//Kernels of one level, which this CPU must support
+const MathKernels& math_kernels(CpuLevel level);
+
+//out[i] = a[i] * b[i], out may be a or b
+void multiply_matrices(const glm::mat4* a, const glm::mat4* b, glm::mat4* out, size_t count);
+
+//out[i] = inverse(in[i]), out may be in
+void invert_matrices(const glm::mat4* in, glm::mat4* out, size_t count);
+
+/* Points given as three floats every in_stride bytes, written every
+out_stride bytes as vec3(m * vec4(p, 1)). out may be in */
+void transform_points(const glm::mat4& m, const void* in, size_t in_stride, void* out, size_t out_stride, size_t count);
+
+//Zero length vectors give zero, out may be in
+void normalize_vectors(const glm::vec3* in, glm::vec3* out, size_t count);
+
+//out[i] = packSnorm3x10_1x2(in[i])
+void pack_snorm_3x10_1x2(const glm::vec4* in, unsigned int* out, size_t count);
+
+/* Vectors to format, bit for bit the glm function (packUnorm4x8...) on
+every CPU: see PackFormat for the sizes. Single threaded, VectorPacking.h
+splits big arrays over the thread pool */
+void pack_vectors(PackFormat format, const void* in, void* out, size_t count);
+
+//Packed vectors back to components, as the glm unpack function of format
+void unpack_vectors(PackFormat format, const void* in, void* out, size_t count);
+
+//out[i] = mat3_cast(in[i])
+void quats_to_mat3(const glm::quat* in, glm::mat3* out, size_t count);
+
+/* Skinned positions and normals of count vertices, four joints and weights
+each. normals and out_normals may be null. Single threaded, Skinning.h
+splits meshes over the thread pool */
+void skin_dual_quaternions(const glm::fdualquat* bones, const glm::u16vec4* joints, const glm::vec4* weights,
+	const glm::vec3* positions, const glm::vec3* normals, glm::vec3* out_positions, glm::vec3* out_normals, size_t count);
+
+//Same with skinning matrices blended by weight (linear blend skinning)
+void skin_matrices(const glm::mat4* bones, const glm::u16vec4* joints, const glm::vec4* weights,
+	const glm::vec3* positions, const glm::vec3* normals, glm::vec3* out_positions, glm::vec3* out_normals, size_t count);
+
+/* Fractal noise of count points along x, as glm::perlinRow: the first
+dimensions (2, 3 or 4) components of origin are used. Single threaded,
+Noise.h fills grids over the thread pool */
+void perlin_row(const glm::vec4& origin, int dimensions, float step, size_t count, int octaves, float lacunarity, float gain, float* out);
+
+//Same with simplex noise, as glm::simplexRow
+void simplex_row(const glm::vec4& origin, int dimensions, float step, size_t count, int octaves, float lacunarity, float gain, float* out);
+
+/* Half floats rounded to nearest even, F16C on AVX2 CPUs. Single threaded,
+HalfFloat.h splits big arrays over the thread pool */
+void pack_halfs(const float* in, glm::uint16* out, size_t count);
+
+//Floats of half floats
+void unpack_halfs(const glm::uint16* in, float* out, size_t count);
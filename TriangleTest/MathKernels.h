@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+
+/* The hot glm loops, built once per instruction set: MathKernelsSSE2.cpp,
+MathKernelsAVX.cpp and MathKernelsAVX2.cpp compile MathKernels.inl with
+their own target flags. Each build renames the glm namespace, so the inline
+glm functions it contains can not be mixed up with the ones of the rest of
+the program at link time. That is also why this header uses plain floats
+and no glm type: use MathDispatch.h, not these tables */
+
+/* Formats of glm/gtc/packing.hpp for pack_vectors and unpack_vectors. The
+vectors have the component count of the name (four for the 3x10_1x2 ones,
+three for PACK_F2X11_1X10), floats except the ints of PACK_I3X10_1X2 and
+PACK_U3X10_1X2, packed in as many bits as their components add up to */
+enum PackFormat {
+	PACK_UNORM_1X8,
+	PACK_SNORM_1X8,
+	PACK_UNORM_2X8,
+	PACK_SNORM_2X8,
+	PACK_UNORM_4X8,
+	PACK_SNORM_4X8,
+	PACK_UNORM_1X16,
+	PACK_SNORM_1X16,
+	PACK_UNORM_2X16,
+	PACK_SNORM_2X16,
+	PACK_UNORM_4X16,
+	PACK_SNORM_4X16,
+	PACK_I3X10_1X2,
+	PACK_U3X10_1X2,
+	PACK_UNORM_3X10_1X2,
+	PACK_SNORM_3X10_1X2,
+	PACK_F2X11_1X10,
+};
+
+struct MathKernels {
+	//"SSE2", "AVX" or "AVX2"
+	const char* name;
+	//out[i] = a[i] * b[i], 16 floats per matrix. out may be a or b
+	void (*multiply_matrices)(const float* a, const float* b, float* out, size_t count);
+	//out[i] = inverse(in[i]). out may be in
+	void (*invert_matrices)(const float* in, float* out, size_t count);
+	//out = m * (in, 1) without the divide, three floats every stride bytes. out may be in
+	void (*transform_points)(const float* m, const void* in, size_t in_stride, void* out, size_t out_stride, size_t count);
+	//Three floats per vector, zero length ones stay zero. out may be in
+	void (*normalize_vectors)(const float* in, float* out, size_t count);
+	//The glm pack function of format (packUnorm4x8...) of each vector, bit for bit
+	void (*pack_vectors)(PackFormat format, const void* in, void* out, size_t count);
+	//The glm unpack function of format of each packed vector
+	void (*unpack_vectors)(PackFormat format, const void* in, void* out, size_t count);
+	//mat3_cast of quaternions stored x, y, z, w, nine floats per matrix
+	void (*quats_to_mat3)(const float* in, float* out, size_t count);
+	/* Dual quaternion linear blending of skinned vertices. Eight floats per
+	bone (real then dual part, x y z w), four joints and four weights per
+	vertex, three floats per position and normal. normals may be null */
+	void (*skin_dual_quaternions)(const float* bones, const unsigned short* joints, const float* weights,
+		const float* positions, const float* normals, float* out_positions, float* out_normals, size_t count);
+	//Same with 16 floats per bone, the matrices are blended (linear blend skinning)
+	void (*skin_matrices)(const float* bones, const unsigned short* joints, const float* weights,
+		const float* positions, const float* normals, float* out_positions, float* out_normals, size_t count);
+	/* Fractal Perlin noise of count points along x, as glm::perlinRow. origin
+	holds dimensions floats, 2, 3 or 4 */
+	void (*perlin_row)(const float* origin, int dimensions, float step, size_t count, int octaves, float lacunarity, float gain, float* out);
+	//Same with simplex noise, as glm::simplexRow
+	void (*simplex_row)(const float* origin, int dimensions, float step, size_t count, int octaves, float lacunarity, float gain, float* out);
+	//Half floats rounded to nearest even, as glm::packHalfs: F16C for AVX2, tables otherwise
+	void (*pack_halfs)(const float* in, unsigned short* out, size_t count);
+	//Floats of half floats, as glm::unpackHalfs
+	void (*unpack_halfs)(const unsigned short* in, float* out, size_t count);
+};
+
+const MathKernels& math_kernels_sse2();
+const MathKernels& math_kernels_avx();
+const MathKernels& math_kernels_avx2();
@@ -0,0 +1,322 @@
+/* Body of the MathKernels*.cpp files, which define MATH_KERNELS_NAMESPACE,
+MATH_KERNELS_NAME and MATH_KERNELS_TABLE before including it. Only glm may
+be included below the rename: a standard library inline function compiled
+here could end up used by the other files too */
+
+#include "MathKernels.h"
+
+#define glm MATH_KERNELS_NAMESPACE
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtx/batch_half.hpp>
+#include <glm/gtx/batch_noise.hpp>
+#include <glm/gtx/batch_packing.hpp>
+#include <glm/gtx/batch_quat.hpp>
+#include <glm/gtx/batch_transform.hpp>
+#include <glm/gtx/wide.hpp>
+#if GLM_ARCH & GLM_ARCH_SSE2
+#	include <glm/gtx/simd_mat4.hpp>
+#endif
+
+namespace {
+
+void multiply_matrices(const float* a, const float* b, float* out, size_t count) {
+	const glm::mat4* ma = reinterpret_cast<const glm::mat4*>(a);
+	const glm::mat4* mb = reinterpret_cast<const glm::mat4*>(b);
+	glm::mat4* mout = reinterpret_cast<glm::mat4*>(out);
+	for (size_t i = 0; i < count; ++i) {
+#if GLM_ARCH & GLM_ARCH_SSE2
+		mout[i] = glm::mat4_cast(glm::detail::fmat4x4SIMD(ma[i]) * glm::detail::fmat4x4SIMD(mb[i]));
+#else
+		mout[i] = ma[i] * mb[i];
+#endif
+	}
+}
+
+void invert_matrices(const float* in, float* out, size_t count) {
+	const glm::mat4* mi = reinterpret_cast<const glm::mat4*>(in);
+	glm::mat4* mout = reinterpret_cast<glm::mat4*>(out);
+	for (size_t i = 0; i < count; ++i) {
+#if GLM_ARCH & GLM_ARCH_SSE2
+		mout[i] = glm::mat4_cast(glm::inverse(glm::detail::fmat4x4SIMD(mi[i])));
+#else
+		mout[i] = glm::inverse(mi[i]);
+#endif
+	}
+}
+
+void transform_points(const float* m, const void* in, size_t in_stride, void* out, size_t out_stride, size_t count) {
+	glm::transformPointsStrided(*reinterpret_cast<const glm::mat4*>(m), in, in_stride, out, out_stride, count);
+}
+
+void normalize_vectors(const float* in, float* out, size_t count) {
+	const glm::vec3* vin = reinterpret_cast<const glm::vec3*>(in);
+	glm::vec3* vout = reinterpret_cast<glm::vec3*>(out);
+	for (size_t i = 0; i < count; i += 8) {
+		glm::vec3x8 v = glm::wideGather(vin + i, count - i);
+		glm::floatx8 length = glm::length(v);
+		glm::wideScatter(glm::select(length > glm::floatx8(0.0f), v / length, glm::vec3x8()), vout + i, count - i);
+	}
+}
+
+//The glm function of format on arrays of the vector and packed types of the format
+template <typename Vector, typename Packed>
+void pack_as(void (*pack)(const Vector*, Packed*, size_t), const void* in, void* out, size_t count) {
+	pack(static_cast<const Vector*>(in), static_cast<Packed*>(out), count);
+}
+
+template <typename Packed, typename Vector>
+void unpack_as(void (*unpack)(const Packed*, Vector*, size_t), const void* in, void* out, size_t count) {
+	unpack(static_cast<const Packed*>(in), static_cast<Vector*>(out), count);
+}
+
+void pack_vectors(PackFormat format, const void* in, void* out, size_t count) {
+	switch (format) {
+	case PACK_UNORM_1X8:
+		pack_as<float, glm::uint8>(glm::packUnorm1x8, in, out, count);
+		break;
+	case PACK_SNORM_1X8:
+		pack_as<float, glm::uint8>(glm::packSnorm1x8, in, out, count);
+		break;
+	case PACK_UNORM_2X8:
+		pack_as<glm::vec2, glm::uint16>(glm::packUnorm2x8, in, out, count);
+		break;
+	case PACK_SNORM_2X8:
+		pack_as<glm::vec2, glm::uint16>(glm::packSnorm2x8, in, out, count);
+		break;
+	case PACK_UNORM_4X8:
+		pack_as<glm::vec4, glm::uint32>(glm::packUnorm4x8, in, out, count);
+		break;
+	case PACK_SNORM_4X8:
+		pack_as<glm::vec4, glm::uint32>(glm::packSnorm4x8, in, out, count);
+		break;
+	case PACK_UNORM_1X16:
+		pack_as<float, glm::uint16>(glm::packUnorm1x16, in, out, count);
+		break;
+	case PACK_SNORM_1X16:
+		pack_as<float, glm::uint16>(glm::packSnorm1x16, in, out, count);
+		break;
+	case PACK_UNORM_2X16:
+		pack_as<glm::vec2, glm::uint32>(glm::packUnorm2x16, in, out, count);
+		break;
+	case PACK_SNORM_2X16:
+		pack_as<glm::vec2, glm::uint32>(glm::packSnorm2x16, in, out, count);
+		break;
+	case PACK_UNORM_4X16:
+		pack_as<glm::vec4, glm::uint64>(glm::packUnorm4x16, in, out, count);
+		break;
+	case PACK_SNORM_4X16:
+		pack_as<glm::vec4, glm::uint64>(glm::packSnorm4x16, in, out, count);
+		break;
+	case PACK_I3X10_1X2:
+		pack_as<glm::ivec4, glm::uint32>(glm::packI3x10_1x2, in, out, count);
+		break;
+	case PACK_U3X10_1X2:
+		pack_as<glm::uvec4, glm::uint32>(glm::packU3x10_1x2, in, out, count);
+		break;
+	case PACK_UNORM_3X10_1X2:
+		pack_as<glm::vec4, glm::uint32>(glm::packUnorm3x10_1x2, in, out, count);
+		break;
+	case PACK_SNORM_3X10_1X2:
+		pack_as<glm::vec4, glm::uint32>(glm::packSnorm3x10_1x2, in, out, count);
+		break;
+	case PACK_F2X11_1X10:
+		pack_as<glm::vec3, glm::uint32>(glm::packF2x11_1x10, in, out, count);
+		break;
+	}
+}
+
+void unpack_vectors(PackFormat format, const void* in, void* out, size_t count) {
+	switch (format) {
+	case PACK_UNORM_1X8:
+		unpack_as<glm::uint8, float>(glm::unpackUnorm1x8, in, out, count);
+		break;
+	case PACK_SNORM_1X8:
+		unpack_as<glm::uint8, float>(glm::unpackSnorm1x8, in, out, count);
+		break;
+	case PACK_UNORM_2X8:
+		unpack_as<glm::uint16, glm::vec2>(glm::unpackUnorm2x8, in, out, count);
+		break;
+	case PACK_SNORM_2X8:
+		unpack_as<glm::uint16, glm::vec2>(glm::unpackSnorm2x8, in, out, count);
+		break;
+	case PACK_UNORM_4X8:
+		unpack_as<glm::uint32, glm::vec4>(glm::unpackUnorm4x8, in, out, count);
+		break;
+	case PACK_SNORM_4X8:
+		unpack_as<glm::uint32, glm::vec4>(glm::unpackSnorm4x8, in, out, count);
+		break;
+	case PACK_UNORM_1X16:
+		unpack_as<glm::uint16, float>(glm::unpackUnorm1x16, in, out, count);
+		break;
+	case PACK_SNORM_1X16:
+		unpack_as<glm::uint16, float>(glm::unpackSnorm1x16, in, out, count);
+		break;
+	case PACK_UNORM_2X16:
+		unpack_as<glm::uint32, glm::vec2>(glm::unpackUnorm2x16, in, out, count);
+		break;
+	case PACK_SNORM_2X16:
+		unpack_as<glm::uint32, glm::vec2>(glm::unpackSnorm2x16, in, out, count);
+		break;
+	case PACK_UNORM_4X16:
+		unpack_as<glm::uint64, glm::vec4>(glm::unpackUnorm4x16, in, out, count);
+		break;
+	case PACK_SNORM_4X16:
+		unpack_as<glm::uint64, glm::vec4>(glm::unpackSnorm4x16, in, out, count);
+		break;
+	case PACK_I3X10_1X2:
+		unpack_as<glm::uint32, glm::ivec4>(glm::unpackI3x10_1x2, in, out, count);
+		break;
+	case PACK_U3X10_1X2:
+		unpack_as<glm::uint32, glm::uvec4>(glm::unpackU3x10_1x2, in, out, count);
+		break;
+	case PACK_UNORM_3X10_1X2:
+		unpack_as<glm::uint32, glm::vec4>(glm::unpackUnorm3x10_1x2, in, out, count);
+		break;
+	case PACK_SNORM_3X10_1X2:
+		unpack_as<glm::uint32, glm::vec4>(glm::unpackSnorm3x10_1x2, in, out, count);
+		break;
+	case PACK_F2X11_1X10:
+		unpack_as<glm::uint32, glm::vec3>(glm::unpackF2x11_1x10, in, out, count);
+		break;
+	}
+}
+
+void quats_to_mat3(const float* in, float* out, size_t count) {
+	glm::quatsToMat3(reinterpret_cast<const glm::quat*>(in), reinterpret_cast<glm::mat3*>(out), count);
+}
+
+/* The skinning kernels blend the bones of each vertex with plain vec4 math,
+the bones of a vertex lie next to each other. Eight blended vertices are
+then turned into wide types for the transform, which vectorizes across
+vertices. Lanes past count are zero and not stored */
+
+void skin_dual_quaternions(const float* bones, const unsigned short* joints, const float* weights,
+	const float* positions, const float* normals, float* out_positions, float* out_normals, size_t count) {
+	//Palette entry 2b is the real part of bone b, 2b + 1 its dual part
+	const glm::vec4* palette = reinterpret_cast<const glm::vec4*>(bones);
+	const glm::vec4* vweights = reinterpret_cast<const glm::vec4*>(weights);
+	const glm::vec3* vpositions = reinterpret_cast<const glm::vec3*>(positions);
+	const glm::vec3* vnormals = reinterpret_cast<const glm::vec3*>(normals);
+	glm::vec3* vout_positions = reinterpret_cast<glm::vec3*>(out_positions);
+	glm::vec3* vout_normals = reinterpret_cast<glm::vec3*>(out_normals);
+	for (size_t i = 0; i < count; i += 8) {
+		size_t n = count - i < 8 ? count - i : 8;
+		glm::vec4 blended_real[8];
+		glm::vec4 blended_dual[8];
+		for (size_t l = 0; l < n; ++l) {
+			const unsigned short* joint = joints + 4 * (i + l);
+			const glm::vec4& weight = vweights[i + l];
+			//Every bone on the side of the first one, so they do not cancel out
+			const glm::vec4 first = palette[2 * joint[0]];
+			glm::vec4 real = first * weight.x;
+			glm::vec4 dual = palette[2 * joint[0] + 1] * weight.x;
+			for (int k = 1; k < 4; ++k) {
+				const glm::vec4 bone_real = palette[2 * joint[k]];
+				float signed_weight = glm::dot(bone_real, first) < 0.0f ? -weight[k] : weight[k];
+				real += bone_real * signed_weight;
+				dual += palette[2 * joint[k] + 1] * signed_weight;
+			}
+			blended_real[l] = real;
+			blended_dual[l] = dual;
+		}
+		glm::vec4x8 real = glm::wideGather(blended_real, n);
+		glm::vec4x8 dual = glm::wideGather(blended_dual, n);
+		glm::floatx8 scale = glm::inversesqrt(glm::dot(real, real));
+		glm::vec3x8 r(real.x * scale, real.y * scale, real.z * scale);
+		glm::vec3x8 d(dual.x * scale, dual.y * scale, dual.z * scale);
+		glm::floatx8 rw = real.w * scale;
+		glm::floatx8 dw = dual.w * scale;
+		//The operator* of glm::tdualquat and glm::tvec3, the normals only rotate
+		glm::vec3x8 p = glm::wideGather(vpositions + i, n);
+		p += (glm::cross(r, glm::cross(r, p) + p * rw + d) + d * rw - r * dw) * 2.0f;
+		glm::wideScatter(p, vout_positions + i, n);
+		if (normals) {
+			glm::vec3x8 v = glm::wideGather(vnormals + i, n);
+			v += glm::cross(r, glm::cross(r, v) + v * rw) * 2.0f;
+			glm::wideScatter(v, vout_normals + i, n);
+		}
+	}
+}
+
+void skin_matrices(const float* bones, const unsigned short* joints, const float* weights,
+	const float* positions, const float* normals, float* out_positions, float* out_normals, size_t count) {
+	const glm::mat4* palette = reinterpret_cast<const glm::mat4*>(bones);
+	const glm::vec4* vweights = reinterpret_cast<const glm::vec4*>(weights);
+	const glm::vec3* vpositions = reinterpret_cast<const glm::vec3*>(positions);
+	const glm::vec3* vnormals = reinterpret_cast<const glm::vec3*>(normals);
+	glm::vec3* vout_positions = reinterpret_cast<glm::vec3*>(out_positions);
+	glm::vec3* vout_normals = reinterpret_cast<glm::vec3*>(out_normals);
+	for (size_t i = 0; i < count; i += 8) {
+		size_t n = count - i < 8 ? count - i : 8;
+		glm::vec4 blended[4][8];
+		for (size_t l = 0; l < n; ++l) {
+			const unsigned short* joint = joints + 4 * (i + l);
+			const glm::vec4& weight = vweights[i + l];
+			for (int c = 0; c < 4; ++c) {
+				blended[c][l] = palette[joint[0]][c] * weight.x + palette[joint[1]][c] * weight.y
+					+ palette[joint[2]][c] * weight.z + palette[joint[3]][c] * weight.w;
+			}
+		}
+		glm::vec3x8 columns[4];
+		for (int c = 0; c < 4; ++c) {
+			columns[c] = glm::vec3x8(glm::wideGather(blended[c], n));
+		}
+		glm::vec3x8 p = glm::wideGather(vpositions + i, n);
+		glm::wideScatter(columns[0] * p.x + columns[1] * p.y + columns[2] * p.z + columns[3], vout_positions + i, n);
+		if (normals) {
+			glm::vec3x8 v = glm::wideGather(vnormals + i, n);
+			glm::wideScatter(columns[0] * v.x + columns[1] * v.y + columns[2] * v.z, vout_normals + i, n);
+		}
+	}
+}
+
+void perlin_row(const float* origin, int dimensions, float step, size_t count, int octaves, float lacunarity, float gain, float* out) {
+	if (dimensions == 2) {
+		glm::perlinRow(glm::vec2(origin[0], origin[1]), step, count, octaves, lacunarity, gain, out);
+	} else if (dimensions == 3) {
+		glm::perlinRow(glm::vec3(origin[0], origin[1], origin[2]), step, count, octaves, lacunarity, gain, out);
+	} else {
+		glm::perlinRow(glm::vec4(origin[0], origin[1], origin[2], origin[3]), step, count, octaves, lacunarity, gain, out);
+	}
+}
+
+void simplex_row(const float* origin, int dimensions, float step, size_t count, int octaves, float lacunarity, float gain, float* out) {
+	if (dimensions == 2) {
+		glm::simplexRow(glm::vec2(origin[0], origin[1]), step, count, octaves, lacunarity, gain, out);
+	} else if (dimensions == 3) {
+		glm::simplexRow(glm::vec3(origin[0], origin[1], origin[2]), step, count, octaves, lacunarity, gain, out);
+	} else {
+		glm::simplexRow(glm::vec4(origin[0], origin[1], origin[2], origin[3]), step, count, octaves, lacunarity, gain, out);
+	}
+}
+
+void pack_halfs(const float* in, unsigned short* out, size_t count) {
+	glm::packHalfs(in, out, count);
+}
+
+void unpack_halfs(const unsigned short* in, float* out, size_t count) {
+	glm::unpackHalfs(in, out, count);
+}
+
+}//namespace
+
+const MathKernels& MATH_KERNELS_TABLE() {
+	static const MathKernels kernels = {
+		MATH_KERNELS_NAME,
+		multiply_matrices,
+		invert_matrices,
+		transform_points,
+		normalize_vectors,
+		pack_vectors,
+		unpack_vectors,
+		quats_to_mat3,
+		skin_dual_quaternions,
+		skin_matrices,
+		perlin_row,
+		simplex_row,
+		pack_halfs,
+		unpack_halfs,
+	};
+	return kernels;
+}
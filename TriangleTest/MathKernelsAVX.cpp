@@ -0,0 +1,7 @@
+/* The math kernels for AVX CPUs, this file alone is built with /arch:AVX
+(see the project) */
+
+#define MATH_KERNELS_NAMESPACE math_avx
+#define MATH_KERNELS_NAME "AVX"
+#define MATH_KERNELS_TABLE math_kernels_avx
+#include "MathKernels.inl"
@@ -0,0 +1,7 @@
+/* The math kernels for AVX2 and FMA CPUs, this file alone is built with
+/arch:AVX2 (see the project) */
+
+#define MATH_KERNELS_NAMESPACE math_avx2
+#define MATH_KERNELS_NAME "AVX2"
+#define MATH_KERNELS_TABLE math_kernels_avx2
+#include "MathKernels.inl"
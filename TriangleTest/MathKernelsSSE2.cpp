@@ -0,0 +1,7 @@
+/* The math kernels for every x86 CPU, built with the project's default
+instruction set */
+
+#define MATH_KERNELS_NAMESPACE math_sse2
+#define MATH_KERNELS_NAME "SSE2"
+#define MATH_KERNELS_TABLE math_kernels_sse2
+#include "MathKernels.inl"
@@ -0,0 +1,102 @@
+#include "Mesh.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/glm.hpp>
+
+Mesh create_sphere_mesh(unsigned int slices, unsigned int stacks) {
+	const float PI = 3.14159265f;
+	Mesh mesh;
+
+	/* The poles are single vertices, every other ring has slices vertices.
+	The seam is shared so the mesh has no open boundary */
+	Vertex north = { { 0.0f, 1.0f, 0.0f }, { 0.5f, 1.0f, 0.5f } };
+	mesh.vertices.push_back(north);
+	for (unsigned int i = 1; i < stacks; ++i) {
+		float phi = PI * float(i) / float(stacks);
+		for (unsigned int j = 0; j < slices; ++j) {
+			float theta = 2.0f * PI * float(j) / float(slices);
+			glm::vec3 normal(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+			Vertex v = { normal, 0.5f * normal + 0.5f };
+			mesh.vertices.push_back(v);
+		}
+	}
+	Vertex south = { { 0.0f, -1.0f, 0.0f }, { 0.5f, 0.0f, 0.5f } };
+	mesh.vertices.push_back(south);
+
+	const unsigned int south_index = static_cast<unsigned int>(mesh.vertices.size() - 1);
+	//Index of the vertex j in the ring i (rings start at 1)
+	auto ring = [slices](unsigned int i, unsigned int j) { return 1 + (i - 1) * slices + j % slices; };
+
+	for (unsigned int j = 0; j < slices; ++j) {
+		mesh.indices.push_back(0);
+		mesh.indices.push_back(ring(1, j + 1));
+		mesh.indices.push_back(ring(1, j));
+	}
+	for (unsigned int i = 1; i + 1 < stacks; ++i) {
+		for (unsigned int j = 0; j < slices; ++j) {
+			unsigned int a = ring(i, j);
+			unsigned int b = ring(i, j + 1);
+			unsigned int c = ring(i + 1, j);
+			unsigned int d = ring(i + 1, j + 1);
+			mesh.indices.push_back(a);
+			mesh.indices.push_back(b);
+			mesh.indices.push_back(d);
+			mesh.indices.push_back(a);
+			mesh.indices.push_back(d);
+			mesh.indices.push_back(c);
+		}
+	}
+	for (unsigned int j = 0; j < slices; ++j) {
+		mesh.indices.push_back(south_index);
+		mesh.indices.push_back(ring(stacks - 1, j));
+		mesh.indices.push_back(ring(stacks - 1, j + 1));
+	}
+
+	return mesh;
+}
+
+Mesh create_heightmap_mesh(const std::vector<float>& heights, unsigned int columns, unsigned int rows, float relief) {
+	Mesh mesh;
+	if (columns < 2 || rows < 2 || heights.size() < size_t(columns) * rows) {
+		return mesh;
+	}
+	const size_t count = size_t(columns) * rows;
+	const float low = *std::min_element(heights.begin(), heights.begin() + count);
+	const float high = *std::max_element(heights.begin(), heights.begin() + count);
+	const float range = high > low ? high - low : 1.0f;
+	const glm::vec3 water(0.15f, 0.3f, 0.6f);
+	const glm::vec3 grass(0.3f, 0.55f, 0.2f);
+	const glm::vec3 snow(0.95f, 0.95f, 0.95f);
+
+	mesh.vertices.resize(count);
+	for (unsigned int r = 0; r < rows; ++r) {
+		for (unsigned int c = 0; c < columns; ++c) {
+			float height = heights[size_t(r) * columns + c];
+			//0 at the lowest point, 1 at the highest
+			float t = (height - low) / range;
+			Vertex& v = mesh.vertices[size_t(r) * columns + c];
+			v.position = glm::vec3(-1.0f + 2.0f * float(c) / float(columns - 1), relief * height, -1.0f + 2.0f * float(r) / float(rows - 1));
+			v.color = t < 0.5f ? glm::mix(water, grass, 2.0f * t) : glm::mix(grass, snow, 2.0f * t - 1.0f);
+		}
+	}
+
+	mesh.indices.reserve(size_t(columns - 1) * (rows - 1) * 6);
+	for (unsigned int r = 0; r + 1 < rows; ++r) {
+		for (unsigned int c = 0; c + 1 < columns; ++c) {
+			unsigned int a = r * columns + c;
+			unsigned int b = a + 1;
+			unsigned int d = a + columns;
+			unsigned int e = d + 1;
+			//Counter clockwise seen from above
+			mesh.indices.push_back(a);
+			mesh.indices.push_back(d);
+			mesh.indices.push_back(b);
+			mesh.indices.push_back(b);
+			mesh.indices.push_back(d);
+			mesh.indices.push_back(e);
+		}
+	}
+	return mesh;
+}
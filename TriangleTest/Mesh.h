@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+//Vertex layout used by the VBO of the samples
+struct Vertex {
+	glm::vec3 position;
+	glm::vec3 color;
+};
+
+//Indexed triangle list, three indices per triangle
+struct Mesh {
+	std::vector<Vertex> vertices;
+	std::vector<unsigned int> indices;
+};
+
+//Closed UV sphere of radius one, colored by its normal
+Mesh create_sphere_mesh(unsigned int slices, unsigned int stacks);
+
+/* Terrain of columns x rows vertices over [-1, 1] in x and z, row r at
+z = -1 + 2r / (rows - 1). Vertex height is relief * heights[r * columns + c],
+colored from water blue through grass to snow by height */
+Mesh create_heightmap_mesh(const std::vector<float>& heights, unsigned int columns, unsigned int rows, float relief);
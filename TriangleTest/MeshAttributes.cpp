@@ -0,0 +1,247 @@
+#include "MeshAttributes.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+
+#include <glm/glm.hpp>
+
+#include "MathDispatch.h"
+#include "Parallel.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#	define ATTRIBUTES_SSE 1
+#	include <emmintrin.h>
+#else
+#	define ATTRIBUTES_SSE 0
+#endif
+
+namespace {
+
+const size_t TRIANGLE_GRAIN = 16384;
+const size_t VERTEX_GRAIN = 8192;
+//Normals widened to vec4 per packing call
+const size_t PACK_BLOCK = 256;
+
+/* The corners (3 * triangle + k) around every vertex, in compressed rows.
+Built with atomic counters, then every row is sorted so the sums later on
+always add in the same order */
+struct VertexCorners {
+	std::vector<unsigned int> offsets;
+	std::vector<unsigned int> corners;
+};
+
+VertexCorners build_vertex_corners(size_t vertex_count, const std::vector<unsigned int>& indices) {
+	ThreadPool& pool = ThreadPool::shared();
+	const size_t corner_count = indices.size() - indices.size() % 3;
+	std::unique_ptr<std::atomic<unsigned int>[]> counters(new std::atomic<unsigned int>[vertex_count]);
+	pool.parallel_for(vertex_count, VERTEX_GRAIN, [&](size_t begin, size_t end) {
+		for (size_t v = begin; v < end; ++v) {
+			counters[v].store(0, std::memory_order_relaxed);
+		}
+	});
+	pool.parallel_for(corner_count, TRIANGLE_GRAIN, [&](size_t begin, size_t end) {
+		for (size_t c = begin; c < end; ++c) {
+			counters[indices[c]].fetch_add(1, std::memory_order_relaxed);
+		}
+	});
+
+	VertexCorners result;
+	result.offsets.resize(vertex_count + 1);
+	unsigned int total = 0;
+	for (size_t v = 0; v < vertex_count; ++v) {
+		result.offsets[v] = total;
+		total += counters[v].load(std::memory_order_relaxed);
+		//The counter becomes the write cursor of the row
+		counters[v].store(result.offsets[v], std::memory_order_relaxed);
+	}
+	result.offsets[vertex_count] = total;
+
+	result.corners.resize(corner_count);
+	pool.parallel_for(corner_count, TRIANGLE_GRAIN, [&](size_t begin, size_t end) {
+		for (size_t c = begin; c < end; ++c) {
+			result.corners[counters[indices[c]].fetch_add(1, std::memory_order_relaxed)] = static_cast<unsigned int>(c);
+		}
+	});
+	pool.parallel_for(vertex_count, VERTEX_GRAIN, [&](size_t begin, size_t end) {
+		for (size_t v = begin; v < end; ++v) {
+			std::sort(result.corners.begin() + result.offsets[v], result.corners.begin() + result.offsets[v + 1]);
+		}
+	});
+	return result;
+}
+
+/* cross(b - a, c - a) of the triangles [first, end), its length is twice
+the area. SSE does four triangles at once, the positions are gathered into
+one register per component */
+void face_cross_products(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, size_t first, size_t end, glm::vec3* out) {
+	size_t t = first;
+#if ATTRIBUTES_SSE
+	for (; t + 4 <= end; t += 4) {
+		float p[3][3][4];
+		for (int lane = 0; lane < 4; ++lane) {
+			for (int k = 0; k < 3; ++k) {
+				const glm::vec3& position = vertices[indices[3 * (t + lane) + k]].position;
+				p[k][0][lane] = position.x;
+				p[k][1][lane] = position.y;
+				p[k][2][lane] = position.z;
+			}
+		}
+		__m128 ax = _mm_loadu_ps(p[0][0]), ay = _mm_loadu_ps(p[0][1]), az = _mm_loadu_ps(p[0][2]);
+		__m128 ux = _mm_sub_ps(_mm_loadu_ps(p[1][0]), ax);
+		__m128 uy = _mm_sub_ps(_mm_loadu_ps(p[1][1]), ay);
+		__m128 uz = _mm_sub_ps(_mm_loadu_ps(p[1][2]), az);
+		__m128 vx = _mm_sub_ps(_mm_loadu_ps(p[2][0]), ax);
+		__m128 vy = _mm_sub_ps(_mm_loadu_ps(p[2][1]), ay);
+		__m128 vz = _mm_sub_ps(_mm_loadu_ps(p[2][2]), az);
+		float n[3][4];
+		_mm_storeu_ps(n[0], _mm_sub_ps(_mm_mul_ps(uy, vz), _mm_mul_ps(uz, vy)));
+		_mm_storeu_ps(n[1], _mm_sub_ps(_mm_mul_ps(uz, vx), _mm_mul_ps(ux, vz)));
+		_mm_storeu_ps(n[2], _mm_sub_ps(_mm_mul_ps(ux, vy), _mm_mul_ps(uy, vx)));
+		for (int lane = 0; lane < 4; ++lane) {
+			out[t + lane - first] = glm::vec3(n[0][lane], n[1][lane], n[2][lane]);
+		}
+	}
+#endif
+	for (; t < end; ++t) {
+		glm::vec3 a = vertices[indices[3 * t]].position;
+		out[t - first] = glm::cross(vertices[indices[3 * t + 1]].position - a, vertices[indices[3 * t + 2]].position - a);
+	}
+}
+
+//Interior angle of the triangle at one of its corners
+float corner_angle(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, unsigned int corner) {
+	unsigned int base = corner - corner % 3;
+	unsigned int k = corner % 3;
+	glm::vec3 p0 = vertices[indices[corner]].position;
+	glm::vec3 d1 = vertices[indices[base + (k + 1) % 3]].position - p0;
+	glm::vec3 d2 = vertices[indices[base + (k + 2) % 3]].position - p0;
+	float lengths = glm::length(d1) * glm::length(d2);
+	if (lengths == 0.0f) {
+		return 0.0f;
+	}
+	return std::acos(glm::clamp(glm::dot(d1, d2) / lengths, -1.0f, 1.0f));
+}
+
+//Any unit vector perpendicular to n
+glm::vec3 perpendicular(const glm::vec3& n) {
+	glm::vec3 axis = std::fabs(n.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+	return glm::normalize(axis - n * glm::dot(n, axis));
+}
+
+}//namespace
+
+std::vector<glm::vec3> compute_normals(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, NormalWeighting weighting) {
+	ThreadPool& pool = ThreadPool::shared();
+	const size_t triangle_count = indices.size() / 3;
+	std::vector<glm::vec3> faces(triangle_count);
+	pool.parallel_for(triangle_count, TRIANGLE_GRAIN, [&](size_t begin, size_t end) {
+		face_cross_products(vertices, indices, begin, end, faces.data() + begin);
+	});
+
+	/* Every vertex sums the triangles around it. The raw cross product is
+	already weighted by area, the angle weight needs it normalized */
+	VertexCorners corners = build_vertex_corners(vertices.size(), indices);
+	std::vector<glm::vec3> normals(vertices.size());
+	pool.parallel_for(vertices.size(), VERTEX_GRAIN, [&](size_t begin, size_t end) {
+		for (size_t v = begin; v < end; ++v) {
+			glm::vec3 sum(0.0f);
+			for (unsigned int i = corners.offsets[v]; i < corners.offsets[v + 1]; ++i) {
+				unsigned int corner = corners.corners[i];
+				const glm::vec3& face = faces[corner / 3];
+				if (weighting == NORMALS_AREA_WEIGHTED) {
+					sum += face;
+				} else {
+					float length = glm::length(face);
+					if (length > 0.0f) {
+						sum += face * (corner_angle(vertices, indices, corner) / length);
+					}
+				}
+			}
+			normals[v] = sum;
+		}
+		//Vertices without area around them get a zero normal
+		normalize_vectors(&normals[begin], &normals[begin], end - begin);
+	});
+	return normals;
+}
+
+std::vector<glm::vec4> compute_tangents(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+	const std::vector<glm::vec3>& normals, const std::vector<glm::vec2>& uvs) {
+	ThreadPool& pool = ThreadPool::shared();
+	const size_t triangle_count = indices.size() / 3;
+
+	/* Direction of increasing u and v on every triangle. Only the direction
+	matters, the division by the UV area is replaced by its sign */
+	std::vector<glm::vec3> face_tangents(triangle_count);
+	std::vector<glm::vec3> face_bitangents(triangle_count);
+	pool.parallel_for(triangle_count, TRIANGLE_GRAIN, [&](size_t begin, size_t end) {
+		for (size_t t = begin; t < end; ++t) {
+			unsigned int i0 = indices[3 * t], i1 = indices[3 * t + 1], i2 = indices[3 * t + 2];
+			glm::vec3 e1 = vertices[i1].position - vertices[i0].position;
+			glm::vec3 e2 = vertices[i2].position - vertices[i0].position;
+			glm::vec2 d1 = uvs[i1] - uvs[i0];
+			glm::vec2 d2 = uvs[i2] - uvs[i0];
+			float area = d1.x * d2.y - d2.x * d1.y;
+			//Degenerate in UV space, it says nothing about the tangent
+			float sign = area > 0.0f ? 1.0f : (area < 0.0f ? -1.0f : 0.0f);
+			face_tangents[t] = sign * (e1 * d2.y - e2 * d1.y);
+			face_bitangents[t] = sign * (e2 * d1.x - e1 * d2.x);
+		}
+	});
+
+	VertexCorners corners = build_vertex_corners(vertices.size(), indices);
+	std::vector<glm::vec4> tangents(vertices.size());
+	pool.parallel_for(vertices.size(), VERTEX_GRAIN, [&](size_t begin, size_t end) {
+		for (size_t v = begin; v < end; ++v) {
+			const glm::vec3& n = normals[v];
+			glm::vec3 tangent(0.0f);
+			glm::vec3 bitangent(0.0f);
+			for (unsigned int i = corners.offsets[v]; i < corners.offsets[v + 1]; ++i) {
+				unsigned int corner = corners.corners[i];
+				float angle = corner_angle(vertices, indices, corner);
+				/* Remove the normal component and normalize before weighting,
+				as MikkTSpace does per corner */
+				glm::vec3 t = face_tangents[corner / 3] - n * glm::dot(n, face_tangents[corner / 3]);
+				glm::vec3 b = face_bitangents[corner / 3] - n * glm::dot(n, face_bitangents[corner / 3]);
+				float t_length = glm::length(t);
+				float b_length = glm::length(b);
+				if (t_length > 0.0f) {
+					tangent += t * (angle / t_length);
+				}
+				if (b_length > 0.0f) {
+					bitangent += b * (angle / b_length);
+				}
+			}
+			float length = glm::length(tangent);
+			glm::vec3 t = length > 0.0f ? tangent / length : perpendicular(n);
+			float w = glm::dot(glm::cross(n, t), bitangent) < 0.0f ? -1.0f : 1.0f;
+			tangents[v] = glm::vec4(t, w);
+		}
+	});
+	return tangents;
+}
+
+std::vector<glm::uint32> pack_normals(const std::vector<glm::vec3>& normals) {
+	std::vector<glm::uint32> packed(normals.size());
+	ThreadPool::shared().parallel_for(normals.size(), VERTEX_GRAIN, [&](size_t begin, size_t end) {
+		glm::vec4 block[PACK_BLOCK];
+		for (size_t first = begin; first < end; first += PACK_BLOCK) {
+			size_t count = std::min(PACK_BLOCK, end - first);
+			for (size_t i = 0; i < count; ++i) {
+				block[i] = glm::vec4(normals[first + i], 0.0f);
+			}
+			pack_snorm_3x10_1x2(block, &packed[first], count);
+		}
+	});
+	return packed;
+}
+
+std::vector<glm::uint32> pack_tangents(const std::vector<glm::vec4>& tangents) {
+	std::vector<glm::uint32> packed(tangents.size());
+	ThreadPool::shared().parallel_for(tangents.size(), VERTEX_GRAIN, [&](size_t begin, size_t end) {
+		pack_snorm_3x10_1x2(&tangents[begin], &packed[begin], end - begin);
+	});
+	return packed;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/fwd.hpp>
+
+#include "Mesh.h"
+
+//How much every triangle around a vertex counts in its normal
+enum NormalWeighting {
+	NORMALS_AREA_WEIGHTED,
+	NORMALS_ANGLE_WEIGHTED,
+};
+
+/* Smooth vertex normals of an indexed mesh. The face cross products are
+computed four triangles at a time with SSE, then every vertex gathers the
+triangles around it (no scatter, no atomics on floats), both in parallel.
+The result does not depend on the number of threads */
+std::vector<glm::vec3> compute_normals(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+	NormalWeighting weighting = NORMALS_ANGLE_WEIGHTED);
+
+/* Tangents for normal mapping, xyz is the tangent and w (+1 or -1) the sign
+of the bitangent: bitangent = w * cross(normal, tangent). Follows the
+MikkTSpace corner math (triangle tangents projected on the vertex normal,
+weighted by the corner angle); it does not split vertices, so it matches
+MikkTSpace when the mesh is already split at mirrored UV seams */
+std::vector<glm::vec4> compute_tangents(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+	const std::vector<glm::vec3>& normals, const std::vector<glm::vec2>& uvs);
+
+//Normals packed with glm::packSnorm3x10_1x2 (GL_INT_2_10_10_10_REV), w = 0
+std::vector<glm::uint32> pack_normals(const std::vector<glm::vec3>& normals);
+//Tangents packed the same way, the sign goes in the 2 bits w
+std::vector<glm::uint32> pack_tangents(const std::vector<glm::vec4>& tangents);
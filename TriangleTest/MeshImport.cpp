@@ -0,0 +1,744 @@
+#include "MeshImport.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "FastParse.h"
+#include "MappedFile.h"
+#include "Parallel.h"
+
+namespace {
+
+//Text is parsed in chunks of about this size, ending on a newline
+const size_t TEXT_CHUNK_SIZE = 1 << 20;
+//Binary records per task
+const size_t RECORD_GRAIN = 65536;
+
+/* Chunk limits over [begin, end): every chunk but the last ends right after a
+newline. memchr is vectorized by every C library, it is the fast scan */
+std::vector<size_t> split_lines(const char* data, size_t begin, size_t end) {
+	std::vector<size_t> bounds(1, begin);
+	size_t p = begin;
+	while (p < end) {
+		size_t next = std::min(end, p + TEXT_CHUNK_SIZE);
+		if (next < end) {
+			const void* newline = std::memchr(data + next, '\n', end - next);
+			next = newline ? size_t(static_cast<const char*>(newline) - data) + 1 : end;
+		}
+		bounds.push_back(next);
+		p = next;
+	}
+	return bounds;
+}
+
+const char* line_end(const char* p, const char* end) {
+	const void* newline = std::memchr(p, '\n', end - p);
+	return newline ? static_cast<const char*>(newline) : end;
+}
+
+const char* next_line(const char* p, const char* end) {
+	const char* eol = line_end(p, end);
+	return eol < end ? eol + 1 : end;
+}
+
+bool indices_in_range(const Mesh& mesh) {
+	std::atomic<bool> valid(true);
+	const unsigned int vertex_count = static_cast<unsigned int>(mesh.vertices.size());
+	ThreadPool::shared().parallel_for(mesh.indices.size(), RECORD_GRAIN, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			if (mesh.indices[i] >= vertex_count) {
+				valid = false;
+				return;
+			}
+		}
+	});
+	return valid;
+}
+
+void fan_triangulate(const std::vector<long long>& polygon, std::vector<long long>& triangles) {
+	for (size_t k = 1; k + 1 < polygon.size(); ++k) {
+		triangles.push_back(polygon[0]);
+		triangles.push_back(polygon[k]);
+		triangles.push_back(polygon[k + 1]);
+	}
+}
+
+/************************************************************************/
+/* Wavefront OBJ                                                        */
+/************************************************************************/
+
+/* Negative indices count back from the last vertex read. Chunks do not know
+how many vertices came before them, so those indices are stored relative to
+the chunk, far below any valid index, and fixed when the chunks are merged */
+const long long RELATIVE_BIAS = 1LL << 62;
+
+struct ObjChunk {
+	std::vector<glm::vec3> positions;
+	std::vector<glm::vec3> colors;
+	std::vector<long long> indices;
+	bool has_colors;
+	std::string error;
+};
+
+void parse_obj_chunk(const char* p, const char* end, ObjChunk& chunk) {
+	chunk.has_colors = false;
+	std::vector<long long> polygon;
+	for (; p < end; p = next_line(p, end)) {
+		const char* eol = line_end(p, end);
+		const char* q = skip_spaces(p, eol);
+		if (eol - q < 2 || (q[1] != ' ' && q[1] != '\t')) {
+			continue;
+		}
+		if (q[0] == 'v') {
+			glm::vec3 position;
+			q += 2;
+			for (int k = 0; k < 3 && q; ++k) {
+				q = parse_float(q, eol, position[k]);
+			}
+			if (!q) {
+				chunk.error = "bad vertex: " + std::string(p, eol);
+				return;
+			}
+			//Optional color after the position
+			glm::vec3 color(1.0f);
+			const char* c = parse_float(q, eol, color.r);
+			if (c && (c = parse_float(c, eol, color.g)) != nullptr && parse_float(c, eol, color.b)) {
+				chunk.has_colors = true;
+			} else {
+				color = glm::vec3(1.0f);
+			}
+			chunk.positions.push_back(position);
+			chunk.colors.push_back(color);
+		} else if (q[0] == 'f') {
+			polygon.clear();
+			q += 2;
+			long long index;
+			for (const char* next = parse_int(q, eol, index); next; next = parse_int(q, eol, index)) {
+				//Skip the texture and normal indices of v/vt/vn
+				for (q = next; q < eol && *q != ' ' && *q != '\t' && *q != '\r'; ++q) {
+				}
+				if (index > 0) {
+					polygon.push_back(index - 1);
+				} else if (index < 0) {
+					polygon.push_back(static_cast<long long>(chunk.positions.size()) + index - RELATIVE_BIAS);
+				} else {
+					chunk.error = "index 0 in face: " + std::string(p, eol);
+					return;
+				}
+			}
+			fan_triangulate(polygon, chunk.indices);
+		}
+	}
+}
+
+/************************************************************************/
+/* PLY                                                                  */
+/************************************************************************/
+enum PlyFormat {
+	PLY_ASCII,
+	PLY_BINARY_LITTLE_ENDIAN,
+	PLY_BINARY_BIG_ENDIAN,
+};
+
+enum PlyType {
+	PLY_INT8,
+	PLY_UINT8,
+	PLY_INT16,
+	PLY_UINT16,
+	PLY_INT32,
+	PLY_UINT32,
+	PLY_FLOAT32,
+	PLY_FLOAT64,
+	PLY_INVALID,
+};
+
+struct PlyProperty {
+	std::string name;
+	PlyType type;
+	//Lists store a count of count_type, then count values of type
+	bool is_list;
+	PlyType count_type;
+};
+
+struct PlyElement {
+	std::string name;
+	size_t count;
+	std::vector<PlyProperty> properties;
+};
+
+PlyType ply_type(const std::string& name) {
+	if (name == "char" || name == "int8") return PLY_INT8;
+	if (name == "uchar" || name == "uint8") return PLY_UINT8;
+	if (name == "short" || name == "int16") return PLY_INT16;
+	if (name == "ushort" || name == "uint16") return PLY_UINT16;
+	if (name == "int" || name == "int32") return PLY_INT32;
+	if (name == "uint" || name == "uint32") return PLY_UINT32;
+	if (name == "float" || name == "float32") return PLY_FLOAT32;
+	if (name == "double" || name == "float64") return PLY_FLOAT64;
+	return PLY_INVALID;
+}
+
+size_t ply_size(PlyType type) {
+	static const size_t SIZES[] = { 1, 1, 2, 2, 4, 4, 4, 8, 0 };
+	return SIZES[type];
+}
+
+//Colors stored as integers are normalized to [0, 1]
+float ply_color_scale(PlyType type) {
+	switch (type) {
+	case PLY_UINT8: return 1.0f / 255.0f;
+	case PLY_UINT16: return 1.0f / 65535.0f;
+	default: return 1.0f;
+	}
+}
+
+double read_binary(const char* p, PlyType type, bool swap) {
+	unsigned char bytes[8];
+	size_t size = ply_size(type);
+	std::memcpy(bytes, p, size);
+	if (swap) {
+		std::reverse(bytes, bytes + size);
+	}
+	switch (type) {
+	case PLY_INT8: { signed char v; std::memcpy(&v, bytes, 1); return v; }
+	case PLY_UINT8: return bytes[0];
+	case PLY_INT16: { short v; std::memcpy(&v, bytes, 2); return v; }
+	case PLY_UINT16: { unsigned short v; std::memcpy(&v, bytes, 2); return v; }
+	case PLY_INT32: { int v; std::memcpy(&v, bytes, 4); return v; }
+	case PLY_UINT32: { unsigned int v; std::memcpy(&v, bytes, 4); return v; }
+	case PLY_FLOAT32: { float v; std::memcpy(&v, bytes, 4); return v; }
+	case PLY_FLOAT64: { double v; std::memcpy(&v, bytes, 8); return v; }
+	default: return 0.0;
+	}
+}
+
+bool parse_ply_header(const char* data, size_t size, PlyFormat& format, std::vector<PlyElement>& elements, size_t& body, std::string& error) {
+	const char* end = data + size;
+	const char* p = data;
+	if (size < 3 || std::strncmp(data, "ply", 3) != 0) {
+		error = "not a PLY file";
+		return false;
+	}
+	bool has_format = false;
+	for (p = next_line(p, end); p < end; p = next_line(p, end)) {
+		std::istringstream line(std::string(p, line_end(p, end)));
+		std::string keyword;
+		line >> keyword;
+		if (keyword == "format") {
+			std::string name;
+			line >> name;
+			if (name == "ascii") {
+				format = PLY_ASCII;
+			} else if (name == "binary_little_endian") {
+				format = PLY_BINARY_LITTLE_ENDIAN;
+			} else if (name == "binary_big_endian") {
+				format = PLY_BINARY_BIG_ENDIAN;
+			} else {
+				error = "unknown format " + name;
+				return false;
+			}
+			has_format = true;
+		} else if (keyword == "element") {
+			PlyElement element;
+			line >> element.name >> element.count;
+			elements.push_back(element);
+		} else if (keyword == "property") {
+			if (elements.empty()) {
+				error = "property before any element";
+				return false;
+			}
+			PlyProperty property;
+			std::string type;
+			line >> type;
+			property.is_list = type == "list";
+			property.count_type = PLY_INVALID;
+			if (property.is_list) {
+				std::string count_type;
+				line >> count_type >> type;
+				property.count_type = ply_type(count_type);
+			}
+			property.type = ply_type(type);
+			line >> property.name;
+			if (property.type == PLY_INVALID || (property.is_list && property.count_type == PLY_INVALID)) {
+				error = "unknown property type " + type;
+				return false;
+			}
+			elements.back().properties.push_back(property);
+		} else if (keyword == "end_header") {
+			body = size_t(next_line(p, end) - data);
+			if (!has_format) {
+				error = "missing format";
+				return false;
+			}
+			return true;
+		}
+		//comment and obj_info lines are ignored
+	}
+	error = "missing end_header";
+	return false;
+}
+
+//Where the interesting properties of the vertex element are, -1 when missing
+struct PlyVertexLayout {
+	int position[3];
+	int color[3];
+};
+
+PlyVertexLayout vertex_layout(const PlyElement& element) {
+	static const char* NAMES[6] = { "x", "y", "z", "red", "green", "blue" };
+	PlyVertexLayout layout;
+	for (int k = 0; k < 6; ++k) {
+		int& slot = k < 3 ? layout.position[k] : layout.color[k - 3];
+		slot = -1;
+		for (size_t i = 0; i < element.properties.size(); ++i) {
+			if (element.properties[i].name == NAMES[k] && !element.properties[i].is_list) {
+				slot = int(i);
+			}
+		}
+	}
+	return layout;
+}
+
+int face_index_property(const PlyElement& element) {
+	for (size_t i = 0; i < element.properties.size(); ++i) {
+		const PlyProperty& property = element.properties[i];
+		if (property.is_list && (property.name == "vertex_indices" || property.name == "vertex_index")) {
+			return int(i);
+		}
+	}
+	return -1;
+}
+
+//Record size when the element has no lists, 0 otherwise
+size_t fixed_record_size(const PlyElement& element) {
+	size_t size = 0;
+	for (size_t i = 0; i < element.properties.size(); ++i) {
+		if (element.properties[i].is_list) {
+			return 0;
+		}
+		size += ply_size(element.properties[i].type);
+	}
+	return size;
+}
+
+bool host_is_little_endian() {
+	const unsigned short one = 1;
+	unsigned char first;
+	std::memcpy(&first, &one, 1);
+	return first == 1;
+}
+
+/* Walk one record property by property, for elements with lists. Returns
+the end of the record or nullptr when it runs past the data */
+const char* walk_binary_record(const char* p, const char* end, const PlyElement& element, bool swap, int index_property, std::vector<long long>* polygon) {
+	for (size_t k = 0; k < element.properties.size(); ++k) {
+		const PlyProperty& property = element.properties[k];
+		if (!property.is_list) {
+			p += ply_size(property.type);
+			continue;
+		}
+		if (p + ply_size(property.count_type) > end) {
+			return nullptr;
+		}
+		size_t count = size_t(read_binary(p, property.count_type, swap));
+		p += ply_size(property.count_type);
+		size_t item = ply_size(property.type);
+		if (p + count * item > end) {
+			return nullptr;
+		}
+		if (polygon && int(k) == index_property) {
+			polygon->clear();
+			for (size_t i = 0; i < count; ++i) {
+				polygon->push_back(static_cast<long long>(read_binary(p + i * item, property.type, swap)));
+			}
+		}
+		p += count * item;
+	}
+	return p <= end ? p : nullptr;
+}
+
+bool import_ply_binary(const char* data, size_t size, size_t body, bool big_endian, const std::vector<PlyElement>& elements, Mesh& mesh, ImportInfo& info, std::string& error) {
+	ThreadPool& pool = ThreadPool::shared();
+	const bool swap = big_endian == host_is_little_endian();
+	const char* end = data + size;
+	const char* p = data + body;
+
+	for (size_t e = 0; e < elements.size(); ++e) {
+		const PlyElement& element = elements[e];
+		const size_t record = fixed_record_size(element);
+
+		if (element.name == "vertex") {
+			/************************************************************************/
+			/* Fixed size records, every task converts its own range               */
+			/************************************************************************/
+			if (record == 0 || size_t(end - p) / record < element.count) {
+				error = "bad vertex element";
+				return false;
+			}
+			PlyVertexLayout layout = vertex_layout(element);
+			if (layout.position[0] < 0 || layout.position[1] < 0 || layout.position[2] < 0) {
+				error = "vertices without x y z";
+				return false;
+			}
+			info.has_colors = layout.color[0] >= 0 && layout.color[1] >= 0 && layout.color[2] >= 0;
+			size_t offsets[3][2];
+			PlyType types[3][2];
+			for (int k = 0; k < 3; ++k) {
+				for (int c = 0; c < 2; ++c) {
+					int property = c == 0 ? layout.position[k] : layout.color[k];
+					offsets[k][c] = 0;
+					types[k][c] = PLY_INVALID;
+					for (int i = 0; i < property; ++i) {
+						offsets[k][c] += ply_size(element.properties[i].type);
+					}
+					if (property >= 0) {
+						types[k][c] = element.properties[property].type;
+					}
+				}
+			}
+			const bool has_colors = info.has_colors;
+			mesh.vertices.resize(element.count);
+			pool.parallel_for(element.count, RECORD_GRAIN, [&](size_t begin, size_t last) {
+				for (size_t i = begin; i < last; ++i) {
+					const char* r = p + i * record;
+					Vertex& v = mesh.vertices[i];
+					for (int k = 0; k < 3; ++k) {
+						v.position[k] = float(read_binary(r + offsets[k][0], types[k][0], swap));
+						v.color[k] = has_colors ? float(read_binary(r + offsets[k][1], types[k][1], swap)) * ply_color_scale(types[k][1]) : 1.0f;
+					}
+				}
+			});
+			p += element.count * record;
+		} else if (element.name == "face") {
+			int index_property = face_index_property(element);
+			if (index_property < 0) {
+				error = "faces without vertex_indices";
+				return false;
+			}
+			/* Fast path: every face a triangle and no other list, then the
+			records have a fixed size too. Checked in parallel */
+			const PlyProperty& list = element.properties[index_property];
+			size_t prefix = 0;
+			size_t triangle_record = ply_size(list.count_type) + 3 * ply_size(list.type);
+			bool other_lists = false;
+			for (size_t k = 0; k < element.properties.size(); ++k) {
+				if (int(k) == index_property) {
+					continue;
+				}
+				other_lists = other_lists || element.properties[k].is_list;
+				triangle_record += ply_size(element.properties[k].type);
+				if (int(k) < index_property) {
+					prefix += ply_size(element.properties[k].type);
+				}
+			}
+			bool all_triangles = !other_lists && size_t(end - p) / triangle_record >= element.count;
+			if (all_triangles) {
+				std::atomic<bool> triangles(true);
+				pool.parallel_for(element.count, RECORD_GRAIN, [&](size_t begin, size_t last) {
+					for (size_t i = begin; i < last; ++i) {
+						if (read_binary(p + i * triangle_record + prefix, list.count_type, swap) != 3.0) {
+							triangles = false;
+							return;
+						}
+					}
+				});
+				all_triangles = triangles;
+			}
+			if (all_triangles) {
+				mesh.indices.resize(3 * element.count);
+				const size_t item = ply_size(list.type);
+				const char* first = p + prefix + ply_size(list.count_type);
+				pool.parallel_for(element.count, RECORD_GRAIN, [&](size_t begin, size_t last) {
+					for (size_t i = begin; i < last; ++i) {
+						const char* r = first + i * triangle_record;
+						for (int k = 0; k < 3; ++k) {
+							mesh.indices[3 * i + k] = static_cast<unsigned int>(read_binary(r + k * item, list.type, swap));
+						}
+					}
+				});
+				p += element.count * triangle_record;
+			} else {
+				//Mixed polygons, one record after the other
+				std::vector<long long> polygon;
+				std::vector<long long> triangles;
+				for (size_t i = 0; i < element.count; ++i) {
+					p = walk_binary_record(p, end, element, swap, index_property, &polygon);
+					if (!p) {
+						error = "truncated face element";
+						return false;
+					}
+					fan_triangulate(polygon, triangles);
+				}
+				mesh.indices.assign(triangles.begin(), triangles.end());
+			}
+		} else if (record > 0) {
+			if (size_t(end - p) / record < element.count) {
+				error = "truncated element " + element.name;
+				return false;
+			}
+			p += element.count * record;
+		} else {
+			for (size_t i = 0; i < element.count && p; ++i) {
+				p = walk_binary_record(p, end, element, swap, -1, nullptr);
+			}
+			if (!p) {
+				error = "truncated element " + element.name;
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+struct PlyTextChunk {
+	std::vector<unsigned int> indices;
+	std::string error;
+};
+
+bool import_ply_ascii(const char* data, size_t size, size_t body, const std::vector<PlyElement>& elements, Mesh& mesh, ImportInfo& info, std::string& error) {
+	ThreadPool& pool = ThreadPool::shared();
+
+	/* Every line is one record. Count the lines of every chunk first, so each
+	chunk knows the number of its first line and with it the element */
+	std::vector<size_t> bounds = split_lines(data, body, size);
+	const size_t chunk_count = bounds.size() - 1;
+	std::vector<size_t> first_line(chunk_count + 1, 0);
+	pool.parallel_for(chunk_count, 1, [&](size_t begin, size_t last) {
+		for (size_t c = begin; c < last; ++c) {
+			first_line[c + 1] = size_t(std::count(data + bounds[c], data + bounds[c + 1], '\n'));
+		}
+	});
+	//A last record without its newline is still a line, the parse loop walks it
+	if (size > body && data[size - 1] != '\n') {
+		++first_line[chunk_count];
+	}
+	for (size_t c = 0; c < chunk_count; ++c) {
+		first_line[c + 1] += first_line[c];
+	}
+
+	std::vector<size_t> element_first_line(elements.size() + 1, 0);
+	int vertex_element = -1;
+	int face_element = -1;
+	for (size_t e = 0; e < elements.size(); ++e) {
+		element_first_line[e + 1] = element_first_line[e] + elements[e].count;
+		if (elements[e].name == "vertex") {
+			vertex_element = int(e);
+		} else if (elements[e].name == "face") {
+			face_element = int(e);
+		}
+	}
+	if (vertex_element < 0) {
+		error = "no vertex element";
+		return false;
+	}
+	const PlyVertexLayout layout = vertex_layout(elements[vertex_element]);
+	if (layout.position[0] < 0 || layout.position[1] < 0 || layout.position[2] < 0) {
+		error = "vertices without x y z";
+		return false;
+	}
+	info.has_colors = layout.color[0] >= 0 && layout.color[1] >= 0 && layout.color[2] >= 0;
+	float color_scale[3] = { 1.0f, 1.0f, 1.0f };
+	for (int k = 0; k < 3 && info.has_colors; ++k) {
+		color_scale[k] = ply_color_scale(elements[vertex_element].properties[layout.color[k]].type);
+	}
+	const int index_property = face_element >= 0 ? face_index_property(elements[face_element]) : -1;
+	mesh.vertices.assign(elements[vertex_element].count, Vertex());
+
+	std::vector<PlyTextChunk> chunks(chunk_count);
+	pool.parallel_for(chunk_count, 1, [&](size_t begin, size_t last) {
+		std::vector<double> values;
+		std::vector<long long> polygon;
+		std::vector<long long> triangles;
+		for (size_t c = begin; c < last; ++c) {
+			PlyTextChunk& chunk = chunks[c];
+			size_t line = first_line[c];
+			size_t e = 0;
+			const char* chunk_end = data + bounds[c + 1];
+			triangles.clear();
+			for (const char* p = data + bounds[c]; p < chunk_end; p = next_line(p, chunk_end), ++line) {
+				while (e < elements.size() && line >= element_first_line[e + 1]) {
+					++e;
+				}
+				if (e != size_t(vertex_element) && e != size_t(face_element)) {
+					continue;
+				}
+				const PlyElement& element = elements[e];
+				const char* eol = line_end(p, chunk_end);
+				const char* q = p;
+				values.clear();
+				polygon.clear();
+				for (size_t k = 0; k < element.properties.size() && q; ++k) {
+					const PlyProperty& property = element.properties[k];
+					if (!property.is_list) {
+						double value = 0.0;
+						q = parse_double(q, eol, value);
+						values.push_back(value);
+						continue;
+					}
+					long long count = 0;
+					q = parse_int(q, eol, count);
+					for (long long i = 0; i < count && q; ++i) {
+						double value = 0.0;
+						q = parse_double(q, eol, value);
+						if (int(k) == index_property) {
+							polygon.push_back(static_cast<long long>(value));
+						}
+					}
+					values.push_back(0.0);
+				}
+				if (!q) {
+					chunk.error = "bad " + element.name + " line: " + std::string(p, eol);
+					break;
+				}
+				if (e == size_t(vertex_element)) {
+					Vertex& v = mesh.vertices[line - element_first_line[e]];
+					for (int k = 0; k < 3; ++k) {
+						v.position[k] = float(values[layout.position[k]]);
+						v.color[k] = info.has_colors ? float(values[layout.color[k]]) * color_scale[k] : 1.0f;
+					}
+				} else {
+					fan_triangulate(polygon, triangles);
+				}
+			}
+			chunk.indices.assign(triangles.begin(), triangles.end());
+		}
+	});
+
+	if (first_line[chunk_count] < element_first_line[elements.size()]) {
+		error = "truncated file";
+		return false;
+	}
+	std::vector<size_t> index_offsets(chunk_count + 1, 0);
+	for (size_t c = 0; c < chunk_count; ++c) {
+		if (!chunks[c].error.empty()) {
+			error = chunks[c].error;
+			return false;
+		}
+		index_offsets[c + 1] = index_offsets[c] + chunks[c].indices.size();
+	}
+	mesh.indices.resize(index_offsets[chunk_count]);
+	pool.parallel_for(chunk_count, 1, [&](size_t begin, size_t last) {
+		for (size_t c = begin; c < last; ++c) {
+			std::copy(chunks[c].indices.begin(), chunks[c].indices.end(), mesh.indices.begin() + index_offsets[c]);
+		}
+	});
+	return true;
+}
+
+std::string lowercase_extension(const std::string& path) {
+	size_t dot = path.find_last_of('.');
+	std::string extension = dot == std::string::npos ? std::string() : path.substr(dot);
+	for (size_t i = 0; i < extension.size(); ++i) {
+		extension[i] = char(std::tolower(static_cast<unsigned char>(extension[i])));
+	}
+	return extension;
+}
+
+}//namespace
+
+bool import_obj(const char* data, size_t size, Mesh& mesh, ImportInfo& info) {
+	ThreadPool& pool = ThreadPool::shared();
+	std::vector<size_t> bounds = split_lines(data, 0, size);
+	const size_t chunk_count = bounds.size() - 1;
+	std::vector<ObjChunk> chunks(chunk_count);
+	pool.parallel_for(chunk_count, 1, [&](size_t begin, size_t end) {
+		for (size_t c = begin; c < end; ++c) {
+			parse_obj_chunk(data + bounds[c], data + bounds[c + 1], chunks[c]);
+		}
+	});
+
+	/* Where every chunk goes in the merged buffers */
+	std::vector<size_t> vertex_offsets(chunk_count + 1, 0);
+	std::vector<size_t> index_offsets(chunk_count + 1, 0);
+	info.has_colors = false;
+	for (size_t c = 0; c < chunk_count; ++c) {
+		if (!chunks[c].error.empty()) {
+			std::cerr << "OBJ: " << chunks[c].error << std::endl;
+			return false;
+		}
+		vertex_offsets[c + 1] = vertex_offsets[c] + chunks[c].positions.size();
+		index_offsets[c + 1] = index_offsets[c] + chunks[c].indices.size();
+		info.has_colors = info.has_colors || chunks[c].has_colors;
+	}
+	const long long vertex_count = static_cast<long long>(vertex_offsets[chunk_count]);
+	mesh.vertices.resize(vertex_offsets[chunk_count]);
+	mesh.indices.resize(index_offsets[chunk_count]);
+	std::atomic<bool> valid(true);
+	pool.parallel_for(chunk_count, 1, [&](size_t begin, size_t end) {
+		for (size_t c = begin; c < end; ++c) {
+			const ObjChunk& chunk = chunks[c];
+			for (size_t i = 0; i < chunk.positions.size(); ++i) {
+				Vertex& v = mesh.vertices[vertex_offsets[c] + i];
+				v.position = chunk.positions[i];
+				v.color = chunk.colors[i];
+			}
+			for (size_t i = 0; i < chunk.indices.size(); ++i) {
+				long long index = chunk.indices[i];
+				if (index < 0) {
+					index += RELATIVE_BIAS + static_cast<long long>(vertex_offsets[c]);
+				}
+				if (index < 0 || index >= vertex_count) {
+					valid = false;
+					index = 0;
+				}
+				mesh.indices[index_offsets[c] + i] = static_cast<unsigned int>(index);
+			}
+		}
+	});
+	if (!valid) {
+		std::cerr << "OBJ: face index out of range" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool import_ply(const char* data, size_t size, Mesh& mesh, ImportInfo& info) {
+	PlyFormat format = PLY_ASCII;
+	std::vector<PlyElement> elements;
+	size_t body = 0;
+	std::string error;
+	bool ok = parse_ply_header(data, size, format, elements, body, error);
+	if (ok) {
+		mesh.vertices.clear();
+		mesh.indices.clear();
+		ok = format == PLY_ASCII ? import_ply_ascii(data, size, body, elements, mesh, info, error)
+			: import_ply_binary(data, size, body, format == PLY_BINARY_BIG_ENDIAN, elements, mesh, info, error);
+	}
+	if (ok && !indices_in_range(mesh)) {
+		error = "face index out of range";
+		ok = false;
+	}
+	if (!ok) {
+		std::cerr << "PLY: " << error << std::endl;
+	}
+	return ok;
+}
+
+bool import_mesh(const std::string& path, Mesh& mesh, ImportInfo& info, const ImportSettings& settings) {
+	MappedFile file;
+	if (!file.open(path)) {
+		std::cerr << "Can not open " << path << std::endl;
+		return false;
+	}
+	std::string extension = lowercase_extension(path);
+	bool ok;
+	if (extension == ".obj") {
+		ok = import_obj(file.data(), file.size(), mesh, info);
+	} else if (extension == ".ply") {
+		ok = import_ply(file.data(), file.size(), mesh, info);
+	} else {
+		std::cerr << "Unknown mesh format " << path << std::endl;
+		return false;
+	}
+	if (ok && settings.weld) {
+		mesh = weld_vertices(unweld_mesh(mesh), settings.weld_settings);
+	}
+	return ok;
+}
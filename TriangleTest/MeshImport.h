@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "Mesh.h"
+#include "MeshWeld.h"
+
+struct ImportSettings {
+	//Merge duplicated vertices after loading (PLY and STL style soups)
+	bool weld;
+	WeldSettings weld_settings;
+};
+
+const ImportSettings DEFAULT_IMPORT_SETTINGS = { false, DEFAULT_WELD_SETTINGS };
+
+/* What a file held besides the triangles */
+struct ImportInfo {
+	//False when the file had no vertex colors, the vertices are then white
+	bool has_colors;
+};
+
+/* Load a Wavefront OBJ (positions, optional "v x y z r g b" colors and
+polygon faces, fan triangulated) or a PLY (ascii, binary little or big
+endian; x y z, optional red green blue, vertex_indices) picked by the file
+extension. The file is memory mapped and parsed in parallel: text formats in
+newline aligned chunks, binary ones in fixed size records. Prints the reason
+to std::cerr and returns false on failure */
+bool import_mesh(const std::string& path, Mesh& mesh, ImportInfo& info, const ImportSettings& settings = DEFAULT_IMPORT_SETTINGS);
+
+//The parsers alone, over a file already in memory
+bool import_obj(const char* data, size_t size, Mesh& mesh, ImportInfo& info);
+bool import_ply(const char* data, size_t size, Mesh& mesh, ImportInfo& info);
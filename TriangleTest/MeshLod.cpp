@@ -0,0 +1,505 @@
+#include "MeshLod.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <queue>
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+
+namespace {
+
+/************************************************************************/
+/* Quadrics over (x, y, z, r, g, b)                                     */
+/************************************************************************/
+const int DIM = 6;
+//Number of coefficients in the upper triangle of a DIM x DIM matrix
+const int SYM = DIM * (DIM + 1) / 2;
+
+struct Quadric {
+	double a[SYM];
+	double b[DIM];
+	double c;
+	//Sum of the weights, used to turn the error into a mean squared distance
+	double w;
+};
+
+struct Point {
+	double x[DIM];
+};
+
+int sym_index(int i, int j) {
+	return i * DIM - i * (i - 1) / 2 + (j - i);
+}
+
+void quadric_clear(Quadric& q) {
+	std::fill(q.a, q.a + SYM, 0.0);
+	std::fill(q.b, q.b + DIM, 0.0);
+	q.c = 0.0;
+	q.w = 0.0;
+}
+
+void quadric_add(Quadric& q, const Quadric& r) {
+	for (int i = 0; i < SYM; ++i) {
+		q.a[i] += r.a[i];
+	}
+	for (int i = 0; i < DIM; ++i) {
+		q.b[i] += r.b[i];
+	}
+	q.c += r.c;
+	q.w += r.w;
+}
+
+double dot(const Point& p, const Point& q) {
+	double d = 0.0;
+	for (int i = 0; i < DIM; ++i) {
+		d += p.x[i] * q.x[i];
+	}
+	return d;
+}
+
+//Unweighted error: v^T A v + 2 b.v + c
+double quadric_eval(const Quadric& q, const Point& p) {
+	const double* v = p.x;
+	double e = q.c;
+	for (int i = 0; i < DIM; ++i) {
+		e += q.a[sym_index(i, i)] * v[i] * v[i];
+		for (int j = i + 1; j < DIM; ++j) {
+			e += 2.0 * q.a[sym_index(i, j)] * v[i] * v[j];
+		}
+		e += 2.0 * q.b[i] * v[i];
+	}
+	return e;
+}
+
+/* Garland and Heckbert generalized quadric: squared distance to the plane
+spanned by the triangle inside the attribute space */
+bool quadric_from_triangle(Quadric& q, const Point& p0, const Point& p1, const Point& p2, double weight) {
+	Point e1, e2;
+	for (int i = 0; i < DIM; ++i) {
+		e1.x[i] = p1.x[i] - p0.x[i];
+		e2.x[i] = p2.x[i] - p0.x[i];
+	}
+	double l1 = std::sqrt(dot(e1, e1));
+	if (l1 <= 1e-12) {
+		return false;
+	}
+	for (int i = 0; i < DIM; ++i) {
+		e1.x[i] /= l1;
+	}
+	double d = dot(e2, e1);
+	for (int i = 0; i < DIM; ++i) {
+		e2.x[i] -= d * e1.x[i];
+	}
+	double l2 = std::sqrt(dot(e2, e2));
+	if (l2 <= 1e-12) {
+		return false;
+	}
+	for (int i = 0; i < DIM; ++i) {
+		e2.x[i] /= l2;
+	}
+
+	double pe1 = dot(p0, e1);
+	double pe2 = dot(p0, e2);
+	for (int i = 0; i < DIM; ++i) {
+		for (int j = i; j < DIM; ++j) {
+			double identity = (i == j) ? 1.0 : 0.0;
+			q.a[sym_index(i, j)] = weight * (identity - e1.x[i] * e1.x[j] - e2.x[i] * e2.x[j]);
+		}
+		q.b[i] = weight * (pe1 * e1.x[i] + pe2 * e2.x[i] - p0.x[i]);
+	}
+	q.c = weight * (dot(p0, p0) - pe1 * pe1 - pe2 * pe2);
+	q.w = weight;
+	return true;
+}
+
+//Squared distance to a plane of the position subspace
+void quadric_from_plane(Quadric& q, const glm::dvec3& n, double d, double weight) {
+	quadric_clear(q);
+	for (int i = 0; i < 3; ++i) {
+		for (int j = i; j < 3; ++j) {
+			q.a[sym_index(i, j)] = weight * n[i] * n[j];
+		}
+		q.b[i] = weight * d * n[i];
+	}
+	q.c = weight * d * d;
+	q.w = weight;
+}
+
+/************************************************************************/
+/* Edge collapse                                                        */
+/************************************************************************/
+struct Collapse {
+	double cost;
+	unsigned int from;
+	unsigned int to;
+	unsigned int from_version;
+	unsigned int to_version;
+
+	bool operator<(const Collapse& other) const {
+		//Reversed so std::priority_queue pops the cheapest collapse
+		return cost > other.cost;
+	}
+};
+
+unsigned long long edge_key(unsigned int a, unsigned int b) {
+	if (a > b) {
+		std::swap(a, b);
+	}
+	return (static_cast<unsigned long long>(a) << 32) | b;
+}
+
+class Simplifier {
+public:
+	Simplifier(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, float attribute_weight);
+	double run(size_t target_index_count, double target_error);
+	void result(std::vector<unsigned int>& indices) const;
+
+private:
+	glm::dvec3 position(unsigned int v) const;
+	double cost(unsigned int from, unsigned int to) const;
+	bool is_valid(unsigned int from, unsigned int to) const;
+	void collapse(unsigned int from, unsigned int to);
+	void push_edges(unsigned int v);
+	void gather_neighbors(unsigned int v, std::vector<unsigned int>& neighbors) const;
+
+	std::vector<Point> points;
+	std::vector<Quadric> quadrics;
+	std::vector<unsigned int> triangles;
+	std::vector<bool> dead_triangle;
+	std::vector<std::vector<unsigned int> > vertex_triangles;
+	std::vector<bool> dead_vertex;
+	std::vector<bool> boundary;
+	std::vector<unsigned int> version;
+	std::priority_queue<Collapse> heap;
+	size_t alive_triangles;
+};
+
+Simplifier::Simplifier(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, float attribute_weight)
+	: triangles(indices), dead_triangle(indices.size() / 3, false), vertex_triangles(vertices.size()),
+	dead_vertex(vertices.size(), false), boundary(vertices.size(), false), version(vertices.size(), 0),
+	alive_triangles(indices.size() / 3) {
+
+	/* Normalize the positions so errors and weights do not depend on the scale of the mesh */
+	glm::vec3 min_corner(FLT_MAX), max_corner(-FLT_MAX);
+	for (size_t i = 0; i < vertices.size(); ++i) {
+		min_corner = glm::min(min_corner, vertices[i].position);
+		max_corner = glm::max(max_corner, vertices[i].position);
+	}
+	glm::dvec3 center = 0.5 * glm::dvec3(min_corner + max_corner);
+	double radius = 0.5 * glm::length(glm::dvec3(max_corner - min_corner));
+	double scale = radius > 0.0 ? 1.0 / radius : 1.0;
+
+	points.resize(vertices.size());
+	for (size_t i = 0; i < vertices.size(); ++i) {
+		glm::dvec3 p = (glm::dvec3(vertices[i].position) - center) * scale;
+		for (int k = 0; k < 3; ++k) {
+			points[i].x[k] = p[k];
+			points[i].x[k + 3] = attribute_weight * vertices[i].color[k];
+		}
+	}
+
+	/* Vertex quadrics are the area weighted sum of the quadrics of their triangles */
+	quadrics.resize(vertices.size());
+	for (size_t i = 0; i < quadrics.size(); ++i) {
+		quadric_clear(quadrics[i]);
+	}
+	std::unordered_map<unsigned long long, int> edge_count;
+	for (size_t t = 0; t < dead_triangle.size(); ++t) {
+		const unsigned int* tri = &triangles[3 * t];
+		double area = 0.5 * glm::length(glm::cross(position(tri[1]) - position(tri[0]), position(tri[2]) - position(tri[0])));
+		Quadric q;
+		if (quadric_from_triangle(q, points[tri[0]], points[tri[1]], points[tri[2]], area)) {
+			for (int k = 0; k < 3; ++k) {
+				quadric_add(quadrics[tri[k]], q);
+			}
+		}
+		for (int k = 0; k < 3; ++k) {
+			vertex_triangles[tri[k]].push_back(static_cast<unsigned int>(t));
+			++edge_count[edge_key(tri[k], tri[(k + 1) % 3])];
+		}
+	}
+
+	/* Open edges get a constraint plane orthogonal to their triangle so the
+	border of the mesh does not shrink */
+	const double BOUNDARY_WEIGHT = 10.0;
+	for (size_t t = 0; t < dead_triangle.size(); ++t) {
+		const unsigned int* tri = &triangles[3 * t];
+		glm::dvec3 normal = glm::cross(position(tri[1]) - position(tri[0]), position(tri[2]) - position(tri[0]));
+		for (int k = 0; k < 3; ++k) {
+			unsigned int a = tri[k];
+			unsigned int b = tri[(k + 1) % 3];
+			if (edge_count[edge_key(a, b)] != 1) {
+				continue;
+			}
+			glm::dvec3 edge = position(b) - position(a);
+			glm::dvec3 n = glm::cross(edge, normal);
+			double length = glm::length(n);
+			if (length <= 1e-12) {
+				continue;
+			}
+			n /= length;
+			Quadric q;
+			double edge_length2 = glm::dot(edge, edge);
+			quadric_from_plane(q, n, -glm::dot(n, position(a)), BOUNDARY_WEIGHT * edge_length2);
+			quadric_add(quadrics[a], q);
+			quadric_add(quadrics[b], q);
+			boundary[a] = true;
+			boundary[b] = true;
+		}
+	}
+
+	for (unsigned int v = 0; v < vertices.size(); ++v) {
+		push_edges(v);
+	}
+}
+
+glm::dvec3 Simplifier::position(unsigned int v) const {
+	return glm::dvec3(points[v].x[0], points[v].x[1], points[v].x[2]);
+}
+
+double Simplifier::cost(unsigned int from, unsigned int to) const {
+	const Quadric& qf = quadrics[from];
+	const Quadric& qt = quadrics[to];
+	double w = qf.w + qt.w;
+	double e = quadric_eval(qf, points[to]) + quadric_eval(qt, points[to]);
+	return w > 0.0 ? std::max(e, 0.0) / w : 0.0;
+}
+
+void Simplifier::gather_neighbors(unsigned int v, std::vector<unsigned int>& neighbors) const {
+	neighbors.clear();
+	const std::vector<unsigned int>& around = vertex_triangles[v];
+	for (size_t i = 0; i < around.size(); ++i) {
+		if (dead_triangle[around[i]]) {
+			continue;
+		}
+		const unsigned int* tri = &triangles[3 * around[i]];
+		for (int k = 0; k < 3; ++k) {
+			if (tri[k] != v) {
+				neighbors.push_back(tri[k]);
+			}
+		}
+	}
+	std::sort(neighbors.begin(), neighbors.end());
+	neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+}
+
+void Simplifier::push_edges(unsigned int v) {
+	std::vector<unsigned int> neighbors;
+	gather_neighbors(v, neighbors);
+	for (size_t i = 0; i < neighbors.size(); ++i) {
+		unsigned int w = neighbors[i];
+		Collapse forward = { cost(v, w), v, w, version[v], version[w] };
+		Collapse backward = { cost(w, v), w, v, version[w], version[v] };
+		heap.push(forward);
+		heap.push(backward);
+	}
+}
+
+bool Simplifier::is_valid(unsigned int from, unsigned int to) const {
+	//Border vertices may only slide along the border
+	if (boundary[from] && !boundary[to]) {
+		return false;
+	}
+
+	/* Link condition: the edge must have at most two common neighbors
+	(one on the border), otherwise the collapse pinches the surface */
+	std::vector<unsigned int> from_neighbors, to_neighbors, common;
+	gather_neighbors(from, from_neighbors);
+	gather_neighbors(to, to_neighbors);
+	std::set_intersection(from_neighbors.begin(), from_neighbors.end(), to_neighbors.begin(), to_neighbors.end(), std::back_inserter(common));
+	int shared_triangles = 0;
+	const std::vector<unsigned int>& around = vertex_triangles[from];
+	for (size_t i = 0; i < around.size(); ++i) {
+		const unsigned int* tri = &triangles[3 * around[i]];
+		if (!dead_triangle[around[i]] && (tri[0] == to || tri[1] == to || tri[2] == to)) {
+			++shared_triangles;
+		}
+	}
+	if (common.size() > static_cast<size_t>(shared_triangles)) {
+		return false;
+	}
+
+	/* Moving from onto to must not flip any of the remaining triangles */
+	glm::dvec3 target = position(to);
+	for (size_t i = 0; i < around.size(); ++i) {
+		if (dead_triangle[around[i]]) {
+			continue;
+		}
+		const unsigned int* tri = &triangles[3 * around[i]];
+		if (tri[0] == to || tri[1] == to || tri[2] == to) {
+			continue;
+		}
+		glm::dvec3 p[3], q[3];
+		for (int k = 0; k < 3; ++k) {
+			p[k] = position(tri[k]);
+			q[k] = (tri[k] == from) ? target : p[k];
+		}
+		glm::dvec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+		glm::dvec3 after = glm::cross(q[1] - q[0], q[2] - q[0]);
+		if (glm::dot(before, after) <= 0.0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void Simplifier::collapse(unsigned int from, unsigned int to) {
+	std::vector<unsigned int>& around = vertex_triangles[from];
+	std::vector<unsigned int>& target = vertex_triangles[to];
+	for (size_t i = 0; i < around.size(); ++i) {
+		unsigned int t = around[i];
+		if (dead_triangle[t]) {
+			continue;
+		}
+		unsigned int* tri = &triangles[3 * t];
+		if (tri[0] == to || tri[1] == to || tri[2] == to) {
+			dead_triangle[t] = true;
+			--alive_triangles;
+		} else {
+			for (int k = 0; k < 3; ++k) {
+				if (tri[k] == from) {
+					tri[k] = to;
+				}
+			}
+			target.push_back(t);
+		}
+	}
+	around.clear();
+	dead_vertex[from] = true;
+	quadric_add(quadrics[to], quadrics[from]);
+
+	//Drop the dead triangles so the lists do not grow without bound
+	size_t alive = 0;
+	for (size_t i = 0; i < target.size(); ++i) {
+		if (!dead_triangle[target[i]]) {
+			target[alive++] = target[i];
+		}
+	}
+	target.resize(alive);
+
+	//Every queued collapse using 'to' is now stale
+	++version[to];
+	push_edges(to);
+}
+
+double Simplifier::run(size_t target_index_count, double target_error) {
+	double max_cost = 0.0;
+	double max_allowed = target_error * target_error;
+	while (alive_triangles * 3 > target_index_count && !heap.empty()) {
+		Collapse c = heap.top();
+		heap.pop();
+		if (dead_vertex[c.from] || dead_vertex[c.to] || version[c.from] != c.from_version || version[c.to] != c.to_version) {
+			continue;
+		}
+		if (c.cost > max_allowed) {
+			break;
+		}
+		if (!is_valid(c.from, c.to)) {
+			continue;
+		}
+		collapse(c.from, c.to);
+		max_cost = std::max(max_cost, c.cost);
+	}
+	return std::sqrt(max_cost);
+}
+
+void Simplifier::result(std::vector<unsigned int>& indices) const {
+	indices.clear();
+	indices.reserve(alive_triangles * 3);
+	for (size_t t = 0; t < dead_triangle.size(); ++t) {
+		if (!dead_triangle[t]) {
+			indices.insert(indices.end(), triangles.begin() + 3 * t, triangles.begin() + 3 * t + 3);
+		}
+	}
+}
+
+}//namespace
+
+std::vector<unsigned int> simplify_mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+	size_t target_index_count, float target_error, float attribute_weight, float* result_error) {
+
+	Simplifier simplifier(vertices, indices, attribute_weight);
+	double error = simplifier.run(target_index_count, target_error > 0.0f ? target_error : DBL_MAX);
+	if (result_error) {
+		*result_error = static_cast<float>(error);
+	}
+	std::vector<unsigned int> result;
+	simplifier.result(result);
+	return result;
+}
+
+LodChain build_lod_chain(const Mesh& mesh, const std::vector<LodSettings>& settings, float attribute_weight) {
+	LodChain chain;
+	glm::vec3 min_corner(FLT_MAX), max_corner(-FLT_MAX);
+	for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+		min_corner = glm::min(min_corner, mesh.vertices[i].position);
+		max_corner = glm::max(max_corner, mesh.vertices[i].position);
+	}
+	chain.center = 0.5f * (min_corner + max_corner);
+	chain.radius = 0.0f;
+	for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+		chain.radius = std::max(chain.radius, glm::distance(chain.center, mesh.vertices[i].position));
+	}
+	//The simplifier measures errors relative to half the bounding box diagonal
+	float error_scale = 0.5f * glm::distance(min_corner, max_corner);
+
+	/* Level 0 is the full resolution mesh */
+	LodLevel full = { 0, static_cast<unsigned int>(mesh.indices.size()), 0.0f };
+	chain.levels.push_back(full);
+	chain.indices = mesh.indices;
+
+	std::vector<unsigned int> source = mesh.indices;
+	float source_error = 0.0f;
+	for (size_t i = 0; i < settings.size(); ++i) {
+		size_t target = mesh.indices.size();
+		if (settings[i].triangle_ratio > 0.0f) {
+			target = static_cast<size_t>(settings[i].triangle_ratio * (mesh.indices.size() / 3)) * 3;
+		}
+		/* Each level is simplified from the previous one, so its error is only
+		measured against that level: the errors add up to a bound on the
+		distance to the full mesh, which max_error limits */
+		float budget = settings[i].max_error;
+		if (budget > 0.0f) {
+			budget -= source_error;
+			if (budget <= 0.0f) {
+				break;
+			}
+		}
+		float error = 0.0f;
+		std::vector<unsigned int> level = simplify_mesh(mesh.vertices, source, target, budget, attribute_weight, &error);
+		//Stop when the simplifier can not make any more progress
+		if (level.empty() || level.size() >= source.size()) {
+			break;
+		}
+		source_error += error;
+		LodLevel lod = { static_cast<unsigned int>(chain.indices.size()), static_cast<unsigned int>(level.size()), source_error * error_scale };
+		chain.levels.push_back(lod);
+		chain.indices.insert(chain.indices.end(), level.begin(), level.end());
+		source.swap(level);
+	}
+	return chain;
+}
+
+unsigned int select_lod(const LodChain& chain, const glm::mat4& PVM, float viewport_height, float pixel_threshold) {
+	if (chain.levels.empty()) {
+		return 0;
+	}
+	/* Clip w is the view depth of the center. The length of the second row of
+	PVM is the vertical projection scale times the scale of the model */
+	glm::vec4 clip = PVM * glm::vec4(chain.center, 1.0f);
+	glm::vec3 row_y(PVM[0][1], PVM[1][1], PVM[2][1]);
+	glm::vec3 row_w(PVM[0][3], PVM[1][3], PVM[2][3]);
+	float depth = clip.w - chain.radius * glm::length(row_w);
+	if (depth <= 0.0f) {
+		return 0;
+	}
+	float pixels_per_unit = glm::length(row_y) * 0.5f * viewport_height / depth;
+	for (size_t i = chain.levels.size() - 1; i > 0; --i) {
+		if (chain.levels[i].error * pixels_per_unit <= pixel_threshold) {
+			return static_cast<unsigned int>(i);
+		}
+	}
+	return 0;
+}
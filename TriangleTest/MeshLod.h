@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+
+#include "Mesh.h"
+
+//Requested simplification for one level of detail. The level is finished
+//as soon as one of the targets is reached (a zero disables that target)
+struct LodSettings {
+	//Fraction of the triangles of the full resolution mesh to keep
+	float triangle_ratio;
+	//Maximum geometric error against the full mesh, relative to its radius
+	float max_error;
+};
+
+//Range of the chain index buffer that draws one level
+struct LodLevel {
+	unsigned int first_index;
+	unsigned int index_count;
+	//Bound on the geometric error against the full mesh, in object space units
+	float error;
+};
+
+//All the levels share the vertex buffer of the source mesh, the indices
+//of every level are stored one after the other, finest level first
+struct LodChain {
+	std::vector<unsigned int> indices;
+	std::vector<LodLevel> levels;
+	glm::vec3 center;
+	float radius;
+};
+
+/* Quadric edge collapse simplification. Every vertex carries a quadric over
+(position, attribute_weight * color) so collapses that smear colors are
+penalized as much as collapses that move the surface. Collapses are half edge
+collapses, the result only references vertices of the input.
+target_error is relative to the mesh radius, result_error (optional) receives
+the relative error of the returned indices. */
+std::vector<unsigned int> simplify_mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+	size_t target_index_count, float target_error, float attribute_weight, float* result_error);
+
+//Simplify the mesh once per settings entry, each level starting from the previous one
+LodChain build_lod_chain(const Mesh& mesh, const std::vector<LodSettings>& settings, float attribute_weight = 1.0f);
+
+//Coarsest level whose error projects to less than pixel_threshold pixels
+unsigned int select_lod(const LodChain& chain, const glm::mat4& PVM, float viewport_height, float pixel_threshold);
@@ -0,0 +1,235 @@
+#include "MeshWeld.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include <glm/glm.hpp>
+
+#include "Parallel.h"
+
+namespace {
+
+//The top bits of the hash pick the table, the low bits the slot in it
+const unsigned int SHARD_BITS = 6;
+const unsigned int SHARD_COUNT = 1u << SHARD_BITS;
+const unsigned int EMPTY = 0xFFFFFFFFu;
+const size_t QUANTIZE_GRAIN = 16384;
+
+//Position cell in q[0..2], color cell in q[3..5]
+struct CellKey {
+	int q[6];
+};
+
+bool same_cell(const CellKey& a, const CellKey& b) {
+	return a.q[0] == b.q[0] && a.q[1] == b.q[1] && a.q[2] == b.q[2] && a.q[3] == b.q[3] && a.q[4] == b.q[4] && a.q[5] == b.q[5];
+}
+
+/* One multiply per component and no dependency between them, so the loop
+vectorizes, then a murmur style finalizer mixes the sum */
+unsigned int hash_cell(const CellKey& key) {
+	static const unsigned int PRIMES[6] = { 0x9E3779B1u, 0x85EBCA77u, 0xC2B2AE3Du, 0x27D4EB2Fu, 0x165667B1u, 0xD3A2646Cu };
+	unsigned int h = 0;
+	for (int k = 0; k < 6; ++k) {
+		h += static_cast<unsigned int>(key.q[k]) * PRIMES[k];
+	}
+	h ^= h >> 16;
+	h *= 0x85EBCA6Bu;
+	h ^= h >> 13;
+	h *= 0xC2B2AE35u;
+	h ^= h >> 16;
+	return h;
+}
+
+unsigned int shard_of(unsigned int hash) {
+	return hash >> (32 - SHARD_BITS);
+}
+
+int quantize(float value, float inverse_cell) {
+	//Clamped so the neighbour cells do not overflow
+	float q = std::floor(value * inverse_cell + 0.5f);
+	return int(std::max(-1e9f, std::min(q, 1e9f)));
+}
+
+struct Slot {
+	unsigned int hash;
+	unsigned int vertex;
+};
+
+/* Open addressing with linear probing. A cell may hold several vertices
+(farther apart than the tolerance), they sit in the same probe sequence */
+class WeldTable {
+public:
+	void reserve(size_t count) {
+		size_t capacity = 16;
+		while (capacity < 2 * count) {
+			capacity *= 2;
+		}
+		Slot empty = { 0, EMPTY };
+		slots.assign(capacity, empty);
+		mask = capacity - 1;
+	}
+
+	//Lowest vertex in the cell of key closer than tolerance to position, EMPTY if none
+	unsigned int find(unsigned int hash, const CellKey& key, const glm::vec3& position, float tolerance,
+		const std::vector<CellKey>& keys, const std::vector<Vertex>& soup) const {
+		unsigned int found = EMPTY;
+		for (size_t i = hash & mask; slots[i].vertex != EMPTY; i = (i + 1) & mask) {
+			unsigned int v = slots[i].vertex;
+			if (slots[i].hash == hash && v < found && same_cell(keys[v], key) && glm::distance(soup[v].position, position) <= tolerance) {
+				found = v;
+			}
+		}
+		return found;
+	}
+
+	void insert(unsigned int hash, unsigned int vertex) {
+		size_t i = hash & mask;
+		while (slots[i].vertex != EMPTY) {
+			i = (i + 1) & mask;
+		}
+		slots[i].hash = hash;
+		slots[i].vertex = vertex;
+	}
+
+private:
+	std::vector<Slot> slots;
+	size_t mask;
+};
+
+}//namespace
+
+Mesh weld_vertices(const std::vector<Vertex>& soup, const WeldSettings& settings) {
+	Mesh result;
+	const size_t count = soup.size() - soup.size() % 3;
+	if (count == 0) {
+		return result;
+	}
+	ThreadPool& pool = ThreadPool::shared();
+	const float tolerance = std::max(settings.position_tolerance, 0.0f);
+	/* Cells twice the tolerance: a vertex can only have close neighbours in
+	the cells on the side of the border it is nearest to */
+	const float inverse_cell = 1.0f / std::max(2.0f * tolerance, FLT_MIN);
+	const float inverse_color_cell = 1.0f / std::max(settings.color_tolerance, FLT_MIN);
+
+	/************************************************************************/
+	/* Quantize and hash, in parallel                                       */
+	/************************************************************************/
+	std::vector<CellKey> keys(count);
+	std::vector<unsigned int> hashes(count);
+	pool.parallel_for(count, QUANTIZE_GRAIN, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			const Vertex& v = soup[i];
+			CellKey& key = keys[i];
+			key.q[0] = quantize(v.position.x, inverse_cell);
+			key.q[1] = quantize(v.position.y, inverse_cell);
+			key.q[2] = quantize(v.position.z, inverse_cell);
+			key.q[3] = quantize(v.color.r, inverse_color_cell);
+			key.q[4] = quantize(v.color.g, inverse_color_cell);
+			key.q[5] = quantize(v.color.b, inverse_color_cell);
+			hashes[i] = hash_cell(key);
+		}
+	});
+
+	/************************************************************************/
+	/* Every shard fills its table on its own                               */
+	/************************************************************************/
+	//Vertices of every shard in increasing order (counting sort)
+	std::vector<size_t> shard_offsets(SHARD_COUNT + 1, 0);
+	for (size_t i = 0; i < count; ++i) {
+		++shard_offsets[shard_of(hashes[i]) + 1];
+	}
+	for (unsigned int s = 0; s < SHARD_COUNT; ++s) {
+		shard_offsets[s + 1] += shard_offsets[s];
+	}
+	std::vector<unsigned int> shard_vertices(count);
+	std::vector<size_t> fill(shard_offsets.begin(), shard_offsets.end() - 1);
+	for (size_t i = 0; i < count; ++i) {
+		shard_vertices[fill[shard_of(hashes[i])]++] = static_cast<unsigned int>(i);
+	}
+
+	//First vertex of the same cell within tolerance, the vertex itself when it is the first
+	std::vector<unsigned int> remap(count);
+	std::vector<WeldTable> tables(SHARD_COUNT);
+	pool.parallel_for(SHARD_COUNT, 1, [&](size_t begin, size_t end) {
+		for (size_t s = begin; s < end; ++s) {
+			WeldTable& table = tables[s];
+			table.reserve(shard_offsets[s + 1] - shard_offsets[s]);
+			for (size_t k = shard_offsets[s]; k < shard_offsets[s + 1]; ++k) {
+				unsigned int i = shard_vertices[k];
+				unsigned int first = table.find(hashes[i], keys[i], soup[i].position, tolerance, keys, soup);
+				if (first == EMPTY) {
+					table.insert(hashes[i], i);
+					first = i;
+				}
+				remap[i] = first;
+			}
+		}
+	});
+
+	/************************************************************************/
+	/* Close vertices across cell borders, the tables are read only now     */
+	/************************************************************************/
+	std::vector<unsigned int> neighbour(count);
+	pool.parallel_for(count, QUANTIZE_GRAIN, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			neighbour[i] = static_cast<unsigned int>(i);
+			if (remap[i] != i) {
+				continue;
+			}
+			const glm::vec3& position = soup[i].position;
+			int step[3];
+			for (int a = 0; a < 3; ++a) {
+				step[a] = position[a] * inverse_cell >= float(keys[i].q[a]) ? 1 : -1;
+			}
+			for (int corner = 1; corner < 8; ++corner) {
+				CellKey key = keys[i];
+				for (int a = 0; a < 3; ++a) {
+					if (corner & (1 << a)) {
+						key.q[a] += step[a];
+					}
+				}
+				unsigned int hash = hash_cell(key);
+				unsigned int other = tables[shard_of(hash)].find(hash, key, position, tolerance, keys, soup);
+				if (other < neighbour[i]) {
+					neighbour[i] = other;
+				}
+			}
+		}
+	});
+
+	/************************************************************************/
+	/* Follow the merges (always to a lower index) and emit the mesh        */
+	/************************************************************************/
+	std::vector<unsigned int> final_vertex(count);
+	for (size_t i = 0; i < count; ++i) {
+		unsigned int target = remap[i] != i ? remap[i] : neighbour[i];
+		final_vertex[i] = target == i ? static_cast<unsigned int>(i) : final_vertex[target];
+	}
+	//Vertices are numbered when a kept triangle first uses them
+	std::vector<unsigned int> new_index(count, EMPTY);
+	result.indices.reserve(count);
+	for (size_t t = 0; t < count; t += 3) {
+		const unsigned int* corners = &final_vertex[t];
+		if (settings.remove_degenerate && (corners[0] == corners[1] || corners[1] == corners[2] || corners[2] == corners[0])) {
+			continue;
+		}
+		for (int k = 0; k < 3; ++k) {
+			unsigned int v = corners[k];
+			if (new_index[v] == EMPTY) {
+				new_index[v] = static_cast<unsigned int>(result.vertices.size());
+				result.vertices.push_back(soup[v]);
+			}
+			result.indices.push_back(new_index[v]);
+		}
+	}
+	return result;
+}
+
+std::vector<Vertex> unweld_mesh(const Mesh& mesh) {
+	std::vector<Vertex> soup(mesh.indices.size());
+	for (size_t i = 0; i < mesh.indices.size(); ++i) {
+		soup[i] = mesh.vertices[mesh.indices[i]];
+	}
+	return soup;
+}
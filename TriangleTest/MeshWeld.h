@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+
+#include "Mesh.h"
+
+struct WeldSettings {
+	//Vertices closer than this merge
+	float position_tolerance;
+	//Colors must fall in the same cell of this size
+	float color_tolerance;
+	//Drop the triangles that lose an edge when their vertices merge
+	bool remove_degenerate;
+};
+
+const WeldSettings DEFAULT_WELD_SETTINGS = { 1e-5f, 1.0f / 512.0f, true };
+
+/* Turn a triangle soup (every three vertices one triangle) into an indexed
+mesh. Attributes are quantized to cells of the tolerances and hashed into
+open addressing tables (one per shard of the hash, the shards are filled in
+parallel). A vertex then also looks in the neighbouring position cells, so
+close vertices on both sides of a cell border merge too. The first vertex of
+every group is kept, numbered in the order the triangles first use them */
+Mesh weld_vertices(const std::vector<Vertex>& soup, const WeldSettings& settings = DEFAULT_WELD_SETTINGS);
+
+//Triangle soup of an indexed mesh, the inverse of weld_vertices
+std::vector<Vertex> unweld_mesh(const Mesh& mesh);
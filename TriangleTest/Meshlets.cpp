@@ -0,0 +1,200 @@
+#include "Meshlets.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include <glm/glm.hpp>
+
+namespace {
+
+//Below this the normals spread too much for the cone to ever cull
+const float MIN_CONE_DOT = 0.1f;
+
+glm::vec3 meshlet_position(const MeshletMesh& mesh, const Meshlet& meshlet, const std::vector<Vertex>& vertices, unsigned int local) {
+	return vertices[mesh.vertices[meshlet.vertex_offset + local]].position;
+}
+
+MeshletBounds compute_bounds(const MeshletMesh& mesh, const Meshlet& meshlet, const std::vector<Vertex>& vertices) {
+	MeshletBounds bounds;
+
+	/* Sphere around the center of the box */
+	glm::vec3 lo(FLT_MAX);
+	glm::vec3 hi(-FLT_MAX);
+	for (unsigned int i = 0; i < meshlet.vertex_count; ++i) {
+		glm::vec3 p = meshlet_position(mesh, meshlet, vertices, i);
+		lo = glm::min(lo, p);
+		hi = glm::max(hi, p);
+	}
+	glm::vec3 center = 0.5f * (lo + hi);
+	float radius = 0.0f;
+	for (unsigned int i = 0; i < meshlet.vertex_count; ++i) {
+		radius = std::max(radius, glm::distance(center, meshlet_position(mesh, meshlet, vertices, i)));
+	}
+	bounds.sphere = glm::vec4(center, radius);
+
+	/* Cone around the average normal, as wide as the farthest normal */
+	std::vector<glm::vec3> normals;
+	normals.reserve(meshlet.triangle_count);
+	glm::vec3 sum(0.0f);
+	for (unsigned int t = 0; t < meshlet.triangle_count; ++t) {
+		const unsigned char* local = &mesh.indices[meshlet.index_offset + 3 * t];
+		glm::vec3 a = meshlet_position(mesh, meshlet, vertices, local[0]);
+		glm::vec3 b = meshlet_position(mesh, meshlet, vertices, local[1]);
+		glm::vec3 c = meshlet_position(mesh, meshlet, vertices, local[2]);
+		glm::vec3 n = glm::cross(b - a, c - a);
+		float length = glm::length(n);
+		//Degenerate triangles have no facing
+		if (length > 0.0f) {
+			normals.push_back(n / length);
+			sum += normals.back();
+		}
+	}
+	float sum_length = glm::length(sum);
+	if (sum_length == 0.0f) {
+		bounds.cone = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+		return bounds;
+	}
+	glm::vec3 axis = sum / sum_length;
+	float min_dot = 1.0f;
+	for (size_t i = 0; i < normals.size(); ++i) {
+		min_dot = std::min(min_dot, glm::dot(axis, normals[i]));
+	}
+	float cutoff = min_dot <= MIN_CONE_DOT ? 1.0f : std::sqrt(1.0f - min_dot * min_dot);
+	bounds.cone = glm::vec4(axis, cutoff);
+	return bounds;
+}
+
+}//namespace
+
+MeshletMesh build_meshlets(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+	unsigned int max_vertices, unsigned int max_triangles, float cone_weight) {
+	MeshletMesh result;
+	//Local indices are bytes, and a triangle needs three vertices
+	max_vertices = std::max(3u, std::min(max_vertices, 256u));
+	max_triangles = std::max(1u, max_triangles);
+	const size_t triangle_count = indices.size() / 3;
+	const size_t vertex_count = vertices.size();
+
+	/************************************************************************/
+	/* Triangles around every vertex, in compressed rows                    */
+	/************************************************************************/
+	std::vector<unsigned int> adjacency_offset(vertex_count + 1, 0);
+	for (size_t i = 0; i < 3 * triangle_count; ++i) {
+		++adjacency_offset[indices[i] + 1];
+	}
+	for (size_t v = 0; v < vertex_count; ++v) {
+		adjacency_offset[v + 1] += adjacency_offset[v];
+	}
+	std::vector<unsigned int> adjacency(3 * triangle_count);
+	std::vector<unsigned int> fill(adjacency_offset.begin(), adjacency_offset.end() - 1);
+	std::vector<glm::vec3> normals(triangle_count);
+	for (size_t t = 0; t < triangle_count; ++t) {
+		for (int k = 0; k < 3; ++k) {
+			adjacency[fill[indices[3 * t + k]]++] = static_cast<unsigned int>(t);
+		}
+		glm::vec3 a = vertices[indices[3 * t]].position;
+		glm::vec3 n = glm::cross(vertices[indices[3 * t + 1]].position - a, vertices[indices[3 * t + 2]].position - a);
+		float length = glm::length(n);
+		normals[t] = length > 0.0f ? n / length : glm::vec3(0.0f);
+	}
+
+	/************************************************************************/
+	/* Grow the meshlets greedily                                           */
+	/************************************************************************/
+	std::vector<unsigned char> emitted(triangle_count, 0);
+	//Slot of a vertex in the meshlet being built, -1 when it is not in it
+	std::vector<int> local(vertex_count, -1);
+	Meshlet current = { 0, 0, 0, 0 };
+	glm::vec3 cone_sum(0.0f);
+	size_t remaining = triangle_count;
+	size_t cursor = 0;
+
+	while (remaining > 0) {
+		/* Cheapest unused triangle touching the meshlet: fewest new vertices,
+		then the normal closest to the meshlet average */
+		glm::vec3 axis = glm::length(cone_sum) > 0.0f ? glm::normalize(cone_sum) : glm::vec3(0.0f);
+		int best = -1;
+		unsigned int best_new_vertices = 0;
+		float best_cost = FLT_MAX;
+		for (unsigned int i = 0; i < current.vertex_count; ++i) {
+			unsigned int v = result.vertices[current.vertex_offset + i];
+			for (unsigned int a = adjacency_offset[v]; a < adjacency_offset[v + 1]; ++a) {
+				unsigned int t = adjacency[a];
+				if (emitted[t]) {
+					continue;
+				}
+				unsigned int new_vertices = 0;
+				for (int k = 0; k < 3; ++k) {
+					new_vertices += local[indices[3 * t + k]] < 0 ? 1 : 0;
+				}
+				float cost = float(new_vertices) + cone_weight * (1.0f - glm::dot(normals[t], axis));
+				if (cost < best_cost) {
+					best = int(t);
+					best_new_vertices = new_vertices;
+					best_cost = cost;
+				}
+			}
+		}
+
+		bool full = current.vertex_count + best_new_vertices > max_vertices || current.triangle_count >= max_triangles;
+		if (best < 0 || full) {
+			/* Close the meshlet, the next one starts from the best neighbour
+			so it stays next to this one, or from the next unused triangle */
+			if (current.triangle_count > 0) {
+				for (unsigned int i = 0; i < current.vertex_count; ++i) {
+					local[result.vertices[current.vertex_offset + i]] = -1;
+				}
+				result.meshlets.push_back(current);
+			}
+			current.vertex_offset = static_cast<unsigned int>(result.vertices.size());
+			current.index_offset = static_cast<unsigned int>(result.indices.size());
+			current.vertex_count = 0;
+			current.triangle_count = 0;
+			cone_sum = glm::vec3(0.0f);
+			if (best < 0) {
+				while (emitted[cursor]) {
+					++cursor;
+				}
+				best = int(cursor);
+			}
+		}
+
+		for (int k = 0; k < 3; ++k) {
+			unsigned int v = indices[3 * best + k];
+			if (local[v] < 0) {
+				local[v] = int(current.vertex_count++);
+				result.vertices.push_back(v);
+			}
+			result.indices.push_back(static_cast<unsigned char>(local[v]));
+		}
+		++current.triangle_count;
+		cone_sum += normals[best];
+		emitted[best] = 1;
+		--remaining;
+	}
+	if (current.triangle_count > 0) {
+		result.meshlets.push_back(current);
+	}
+
+	result.bounds.reserve(result.meshlets.size());
+	for (size_t i = 0; i < result.meshlets.size(); ++i) {
+		result.bounds.push_back(compute_bounds(result, result.meshlets[i], vertices));
+	}
+	return result;
+}
+
+std::vector<Vertex> meshlet_vertex_buffer(const MeshletMesh& mesh, const std::vector<Vertex>& vertices) {
+	std::vector<Vertex> result(mesh.vertices.size());
+	for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+		result[i] = vertices[mesh.vertices[i]];
+	}
+	return result;
+}
+
+bool meshlet_backfacing(const MeshletBounds& bounds, const glm::vec3& camera_position) {
+	/* The view direction to every point of the sphere must be inside the
+	cone mirrored around its apex, then every triangle faces away */
+	glm::vec3 to_center = glm::vec3(bounds.sphere) - camera_position;
+	return glm::dot(to_center, glm::vec3(bounds.cone)) >= bounds.cone.w * glm::length(to_center) + bounds.sphere.w;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include "Mesh.h"
+
+//Default limits, 64 vertices keep the local indices in one byte
+const unsigned int MESHLET_MAX_VERTICES = 64;
+const unsigned int MESHLET_MAX_TRIANGLES = 124;
+
+/* A small cluster of triangles. Its vertices are [vertex_offset,
+vertex_offset + vertex_count) of MeshletMesh::vertices and its local indices
+[index_offset, index_offset + 3 * triangle_count) of MeshletMesh::indices */
+struct Meshlet {
+	unsigned int vertex_offset;
+	unsigned int index_offset;
+	unsigned int vertex_count;
+	unsigned int triangle_count;
+};
+
+/* Culling data of one meshlet, two vec4 so it can be copied straight into a
+std430 buffer (32 bytes) */
+struct MeshletBounds {
+	//Bounding sphere, center in xyz and radius in w
+	glm::vec4 sphere;
+	/* Normal cone, axis in xyz and in w the sine of the angle between the
+	axis and the most deviating normal. w == 1 never culls */
+	glm::vec4 cone;
+};
+
+struct MeshletMesh {
+	std::vector<Meshlet> meshlets;
+	std::vector<MeshletBounds> bounds;
+	//Index of the source vertex for every meshlet vertex slot
+	std::vector<unsigned int> vertices;
+	//Three local indices per triangle, relative to the meshlet first vertex
+	std::vector<unsigned char> indices;
+};
+
+/* Split an indexed triangle list into meshlets of at most max_vertices
+(<= 256) and max_triangles. Triangles are added greedily, preferring the
+ones that reuse most of the meshlet vertices, then (scaled by cone_weight)
+the ones whose normal is closest to the meshlet cone. Usable offline as well
+as at load time */
+MeshletMesh build_meshlets(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+	unsigned int max_vertices = MESHLET_MAX_VERTICES, unsigned int max_triangles = MESHLET_MAX_TRIANGLES, float cone_weight = 0.5f);
+
+/* Vertices in meshlet order, so every meshlet is a contiguous range and the
+local indices can be drawn directly with base vertex = vertex_offset */
+std::vector<Vertex> meshlet_vertex_buffer(const MeshletMesh& mesh, const std::vector<Vertex>& vertices);
+
+//True when every triangle of the meshlet faces away from the camera
+bool meshlet_backfacing(const MeshletBounds& bounds, const glm::vec3& camera_position);
@@ -0,0 +1,48 @@
+#include "Noise.h"
+
+#include <algorithm>
+
+#include <glm/vec4.hpp>
+
+#include "MathDispatch.h"
+#include "Parallel.h"
+
+namespace {
+
+//Samples per task, whole rows are handed out
+const size_t NOISE_GRAIN = 16384;
+
+std::vector<float> fill_grid(const FractalNoise& noise, unsigned int width, unsigned int height, unsigned int depth, int dimensions, float w) {
+	std::vector<float> grid(size_t(width) * height * depth);
+	if (grid.empty()) {
+		return grid;
+	}
+	const size_t rows = size_t(height) * depth;
+	const float step = noise.frequency / float(width);
+	ThreadPool::shared().parallel_for(rows, std::max<size_t>(1, NOISE_GRAIN / width), [&](size_t begin, size_t end) {
+		for (size_t row = begin; row < end; ++row) {
+			glm::vec4 origin(0.0f, noise.frequency * float(row % height) / float(height),
+				noise.frequency * float(row / height) / float(depth), noise.frequency * w);
+			if (noise.type == NOISE_SIMPLEX) {
+				simplex_row(origin, dimensions, step, width, int(noise.octaves), noise.lacunarity, noise.gain, &grid[row * width]);
+			} else {
+				perlin_row(origin, dimensions, step, width, int(noise.octaves), noise.lacunarity, noise.gain, &grid[row * width]);
+			}
+		}
+	});
+	return grid;
+}
+
+}//namespace
+
+std::vector<float> noise_grid(const FractalNoise& noise, unsigned int width, unsigned int height) {
+	return fill_grid(noise, width, height, 1, 2, 0.0f);
+}
+
+std::vector<float> noise_grid(const FractalNoise& noise, unsigned int width, unsigned int height, unsigned int depth) {
+	return fill_grid(noise, width, height, depth, 3, 0.0f);
+}
+
+std::vector<float> noise_grid(const FractalNoise& noise, unsigned int width, unsigned int height, unsigned int depth, float w) {
+	return fill_grid(noise, width, height, depth, 4, w);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+//Noise summed by the octaves of FractalNoise
+enum NoiseType {
+	NOISE_PERLIN,
+	NOISE_SIMPLEX,
+};
+
+/* Octave o samples the noise at frequency * lacunarity^o and weighs it by
+gain^o: lacunarity 2 and gain 0.5 halve the size and the height of the
+features at each octave. The sum is not normalized, it stays within about
++-1 / (1 - gain) */
+struct FractalNoise {
+	NoiseType type;
+	unsigned int octaves;
+	//Periods of the first octave across the grid
+	float frequency;
+	float lacunarity;
+	float gain;
+};
+
+/* Fractal noise on a width x height grid, x varying fastest: sample (x, y)
+is at frequency * (x / width, y / height). The rows are split over the
+shared thread pool and each one is filled eight samples at a time by the
+kernels of MathDispatch.h, so a heightmap costs a few ns per sample and
+octave. The result does not depend on the number of threads */
+std::vector<float> noise_grid(const FractalNoise& noise, unsigned int width, unsigned int height);
+
+//Same on a width x height x depth grid (a 3D texture), slice z after slice z
+std::vector<float> noise_grid(const FractalNoise& noise, unsigned int width, unsigned int height, unsigned int depth);
+
+/* The 3D grid cut from 4D noise at w, scaled by frequency like the other
+axes. Moving w animates a 3D texture without the drift of a moving slice */
+std::vector<float> noise_grid(const FractalNoise& noise, unsigned int width, unsigned int height, unsigned int depth, float w);
@@ -0,0 +1,101 @@
+#include "Parallel.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned int threads) : job(nullptr), job_count(0), job_grain(1), generation(0), busy_workers(0), stopping(false) {
+	next_chunk = 0;
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	for (unsigned int i = 1; i < threads; ++i) {
+		workers.push_back(std::thread(&ThreadPool::worker_loop, this));
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+	for (size_t i = 0; i < workers.size(); ++i) {
+		workers[i].join();
+	}
+}
+
+ThreadPool& ThreadPool::shared() {
+	static ThreadPool* pool = new ThreadPool();
+	return *pool;
+}
+
+namespace {
+
+/* Created before main, function statics are not thread safe with the v120
+toolset and the jobs of other threads may be the first to ask for the pool */
+ThreadPool& startup_pool = ThreadPool::shared();
+
+}//namespace
+
+void ThreadPool::run_chunks() {
+	const size_t chunks = (job_count + job_grain - 1) / job_grain;
+	for (size_t chunk = next_chunk++; chunk < chunks; chunk = next_chunk++) {
+		size_t begin = chunk * job_grain;
+		(*job)(begin, std::min(begin + job_grain, job_count));
+	}
+}
+
+void ThreadPool::worker_loop() {
+	unsigned int seen = 0;
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			while (!stopping && generation == seen) {
+				wake.wait(lock);
+			}
+			if (stopping) {
+				return;
+			}
+			seen = generation;
+		}
+		run_chunks();
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (--busy_workers == 0) {
+				finished.notify_one();
+			}
+		}
+	}
+}
+
+void ThreadPool::parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) {
+	if (count == 0) {
+		return;
+	}
+	grain = std::max<size_t>(grain, 1);
+	//Not worth waking anybody
+	if (workers.empty() || count <= grain) {
+		for (size_t begin = 0; begin < count; begin += grain) {
+			body(begin, std::min(begin + grain, count));
+		}
+		return;
+	}
+
+	std::lock_guard<std::mutex> submit(submit_mutex);
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		job = &body;
+		job_count = count;
+		job_grain = grain;
+		next_chunk = 0;
+		busy_workers = static_cast<unsigned int>(workers.size());
+		++generation;
+	}
+	wake.notify_all();
+	run_chunks();
+
+	std::unique_lock<std::mutex> lock(mutex);
+	while (busy_workers > 0) {
+		finished.wait(lock);
+	}
+	job = nullptr;
+}
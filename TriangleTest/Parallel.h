@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Persistent worker threads for data parallel loops. The calling thread
+works too, so a pool of size one runs everything inline. parallel_for
+calls from different threads are serialized; calling it from inside a
+loop body is not supported */
+class ThreadPool {
+public:
+	//Zero threads means one per hardware thread
+	explicit ThreadPool(unsigned int threads = 0);
+	~ThreadPool();
+
+	//Threads taking part in a loop, the caller included
+	unsigned int size() const { return static_cast<unsigned int>(workers.size()) + 1; }
+
+	/* Run body(begin, end) over [0, count) in chunks of grain items (the
+	last one may be shorter). Chunk k always starts at k * grain. Returns
+	once every chunk is done */
+	void parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+	//Pool shared by the modules of the program
+	static ThreadPool& shared();
+
+private:
+	ThreadPool(const ThreadPool&);
+	ThreadPool& operator=(const ThreadPool&);
+
+	void worker_loop();
+	void run_chunks();
+
+	std::vector<std::thread> workers;
+	std::mutex submit_mutex;
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable finished;
+	const std::function<void(size_t, size_t)>* job;
+	size_t job_count;
+	size_t job_grain;
+	std::atomic<size_t> next_chunk;
+	unsigned int generation;
+	unsigned int busy_workers;
+	bool stopping;
+};
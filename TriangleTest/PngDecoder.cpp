@@ -0,0 +1,381 @@
+#include "PngDecoder.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+/************************************************************************/
+/* DEFLATE (RFC 1951), canonical Huffman codes decoded bit by bit       */
+/************************************************************************/
+const unsigned short LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+const unsigned char LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+const unsigned short DISTANCE_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+const unsigned char DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+//Order the code length code lengths are stored in
+const unsigned char LENGTH_ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+/* Larger images are refused before anything is allocated: the sizes below
+must not wrap with a 32 bits size_t */
+const unsigned int MAX_DIMENSION = 16384;
+const size_t MAX_IMAGE_BYTES = size_t(1) << 28;
+
+class BitReader {
+public:
+	BitReader(const unsigned char* data, size_t size) : p(data), end(data + size), bits(0), count(0), overrun(false) {
+	}
+
+	unsigned int read(int n) {
+		while (count < n) {
+			unsigned int byte = 0;
+			if (p < end) {
+				byte = *p++;
+			} else {
+				overrun = true;
+			}
+			bits |= byte << count;
+			count += 8;
+		}
+		unsigned int value = bits & ((1u << n) - 1u);
+		bits >>= n;
+		count -= n;
+		return value;
+	}
+
+	//Drop the bits left in the current byte
+	void align() {
+		bits = 0;
+		count = 0;
+	}
+
+	const unsigned char* p;
+	const unsigned char* end;
+	unsigned int bits;
+	int count;
+	bool overrun;
+};
+
+struct Huffman {
+	//Number of codes of every length, and the symbols sorted by code
+	unsigned short counts[16];
+	unsigned short symbols[288];
+};
+
+bool build_huffman(Huffman& h, const unsigned char* lengths, int n) {
+	std::memset(h.counts, 0, sizeof(h.counts));
+	for (int i = 0; i < n; ++i) {
+		++h.counts[lengths[i]];
+	}
+	h.counts[0] = 0;
+	//Over subscribed sets are invalid, incomplete ones are allowed
+	int left = 1;
+	for (int length = 1; length < 16; ++length) {
+		left = 2 * left - h.counts[length];
+		if (left < 0) {
+			return false;
+		}
+	}
+	unsigned short offsets[16];
+	offsets[1] = 0;
+	for (int length = 1; length < 15; ++length) {
+		offsets[length + 1] = offsets[length] + h.counts[length];
+	}
+	for (int i = 0; i < n; ++i) {
+		if (lengths[i] != 0) {
+			h.symbols[offsets[lengths[i]]++] = static_cast<unsigned short>(i);
+		}
+	}
+	return true;
+}
+
+int decode_symbol(BitReader& in, const Huffman& h) {
+	int code = 0;
+	int first = 0;
+	int index = 0;
+	for (int length = 1; length < 16; ++length) {
+		code |= int(in.read(1));
+		int count = h.counts[length];
+		if (code - count < first) {
+			return h.symbols[index + (code - first)];
+		}
+		index += count;
+		first = (first + count) << 1;
+		code <<= 1;
+	}
+	return -1;
+}
+
+bool inflate_codes(BitReader& in, const Huffman& lengths, const Huffman& distances, std::vector<unsigned char>& out) {
+	for (;;) {
+		int symbol = decode_symbol(in, lengths);
+		if (symbol < 0 || in.overrun) {
+			return false;
+		}
+		if (symbol < 256) {
+			out.push_back(static_cast<unsigned char>(symbol));
+			continue;
+		}
+		if (symbol == 256) {
+			return true;
+		}
+		symbol -= 257;
+		if (symbol >= 29) {
+			return false;
+		}
+		size_t length = LENGTH_BASE[symbol] + in.read(LENGTH_EXTRA[symbol]);
+		int distance_symbol = decode_symbol(in, distances);
+		if (distance_symbol < 0 || distance_symbol >= 30) {
+			return false;
+		}
+		size_t distance = DISTANCE_BASE[distance_symbol] + in.read(DISTANCE_EXTRA[distance_symbol]);
+		if (distance > out.size()) {
+			return false;
+		}
+		//Byte by byte, the copy may overlap what it writes
+		size_t from = out.size() - distance;
+		for (size_t i = 0; i < length; ++i) {
+			out.push_back(out[from + i]);
+		}
+	}
+}
+
+bool inflate_dynamic(BitReader& in, std::vector<unsigned char>& out) {
+	int literal_count = int(in.read(5)) + 257;
+	int distance_count = int(in.read(5)) + 1;
+	int code_count = int(in.read(4)) + 4;
+	if (literal_count > 286 || distance_count > 30) {
+		return false;
+	}
+	unsigned char lengths[320];
+	std::memset(lengths, 0, sizeof(lengths));
+	for (int i = 0; i < code_count; ++i) {
+		lengths[LENGTH_ORDER[i]] = static_cast<unsigned char>(in.read(3));
+	}
+	Huffman code_lengths;
+	if (!build_huffman(code_lengths, lengths, 19)) {
+		return false;
+	}
+	int total = literal_count + distance_count;
+	for (int i = 0; i < total;) {
+		int symbol = decode_symbol(in, code_lengths);
+		if (symbol < 0 || in.overrun) {
+			return false;
+		}
+		if (symbol < 16) {
+			lengths[i++] = static_cast<unsigned char>(symbol);
+			continue;
+		}
+		unsigned char repeated = 0;
+		int repeat;
+		if (symbol == 16) {
+			if (i == 0) {
+				return false;
+			}
+			repeated = lengths[i - 1];
+			repeat = 3 + int(in.read(2));
+		} else if (symbol == 17) {
+			repeat = 3 + int(in.read(3));
+		} else {
+			repeat = 11 + int(in.read(7));
+		}
+		if (i + repeat > total) {
+			return false;
+		}
+		for (; repeat > 0; --repeat) {
+			lengths[i++] = repeated;
+		}
+	}
+	Huffman literals;
+	Huffman distances;
+	if (!build_huffman(literals, lengths, literal_count) || !build_huffman(distances, lengths + literal_count, distance_count)) {
+		return false;
+	}
+	return inflate_codes(in, literals, distances, out);
+}
+
+bool inflate_fixed(BitReader& in, std::vector<unsigned char>& out) {
+	unsigned char lengths[288 + 30];
+	std::memset(lengths, 8, 144);
+	std::memset(lengths + 144, 9, 112);
+	std::memset(lengths + 256, 7, 24);
+	std::memset(lengths + 280, 8, 8);
+	std::memset(lengths + 288, 5, 30);
+	Huffman literals;
+	Huffman distances;
+	build_huffman(literals, lengths, 288);
+	build_huffman(distances, lengths + 288, 30);
+	return inflate_codes(in, literals, distances, out);
+}
+
+/************************************************************************/
+/* PNG                                                                  */
+/************************************************************************/
+unsigned int read_be32(const unsigned char* p) {
+	return (unsigned int)(p[0]) << 24 | (unsigned int)(p[1]) << 16 | (unsigned int)(p[2]) << 8 | p[3];
+}
+
+unsigned char paeth(unsigned char a, unsigned char b, unsigned char c) {
+	int p = int(a) + int(b) - int(c);
+	int pa = std::abs(p - int(a));
+	int pb = std::abs(p - int(b));
+	int pc = std::abs(p - int(c));
+	return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+}
+
+//Undo the per row filters in place, rows are stride bytes plus the filter byte
+bool unfilter(std::vector<unsigned char>& data, size_t rows, size_t stride, size_t bpp) {
+	const unsigned char* previous = nullptr;
+	for (size_t y = 0; y < rows; ++y) {
+		unsigned char* row = &data[y * (stride + 1)];
+		unsigned char filter = row[0];
+		unsigned char* pixels = row + 1;
+		for (size_t x = 0; x < stride; ++x) {
+			unsigned char left = x >= bpp ? pixels[x - bpp] : 0;
+			unsigned char up = previous ? previous[x] : 0;
+			unsigned char up_left = previous && x >= bpp ? previous[x - bpp] : 0;
+			switch (filter) {
+			case 0: break;
+			case 1: pixels[x] = static_cast<unsigned char>(pixels[x] + left); break;
+			case 2: pixels[x] = static_cast<unsigned char>(pixels[x] + up); break;
+			case 3: pixels[x] = static_cast<unsigned char>(pixels[x] + ((int(left) + int(up)) >> 1)); break;
+			case 4: pixels[x] = static_cast<unsigned char>(pixels[x] + paeth(left, up, up_left)); break;
+			default: return false;
+			}
+		}
+		previous = pixels;
+	}
+	return true;
+}
+
+}//namespace
+
+bool zlib_inflate(const unsigned char* data, size_t size, std::vector<unsigned char>& out) {
+	if (size < 2 || (data[0] & 0x0F) != 8 || ((data[0] << 8) | data[1]) % 31 != 0 || (data[1] & 0x20) != 0) {
+		return false;
+	}
+	BitReader in(data + 2, size - 2);
+	for (;;) {
+		unsigned int last = in.read(1);
+		unsigned int type = in.read(2);
+		bool ok;
+		if (type == 0) {
+			//Stored block
+			in.align();
+			if (in.end - in.p < 4) {
+				return false;
+			}
+			size_t length = size_t(in.p[0]) | size_t(in.p[1]) << 8;
+			size_t complement = size_t(in.p[2]) | size_t(in.p[3]) << 8;
+			in.p += 4;
+			if ((length ^ 0xFFFF) != complement || size_t(in.end - in.p) < length) {
+				return false;
+			}
+			out.insert(out.end(), in.p, in.p + length);
+			in.p += length;
+			ok = true;
+		} else if (type == 1) {
+			ok = inflate_fixed(in, out);
+		} else if (type == 2) {
+			ok = inflate_dynamic(in, out);
+		} else {
+			ok = false;
+		}
+		if (!ok || in.overrun) {
+			return false;
+		}
+		if (last) {
+			return true;
+		}
+	}
+}
+
+bool decode_png(const unsigned char* data, size_t size, Image& image) {
+	static const unsigned char SIGNATURE[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+	if (size < 8 || std::memcmp(data, SIGNATURE, 8) != 0) {
+		return false;
+	}
+	unsigned int width = 0;
+	unsigned int height = 0;
+	int depth = 0;
+	int color_type = -1;
+	unsigned char palette[256][4];
+	std::memset(palette, 255, sizeof(palette));
+	std::vector<unsigned char> compressed;
+	for (size_t offset = 8; offset + 12 <= size;) {
+		unsigned int length = read_be32(data + offset);
+		const unsigned char* type = data + offset + 4;
+		const unsigned char* chunk = data + offset + 8;
+		if (length > size - offset - 12) {
+			return false;
+		}
+		if (std::memcmp(type, "IHDR", 4) == 0 && length >= 13) {
+			width = read_be32(chunk);
+			height = read_be32(chunk + 4);
+			depth = chunk[8];
+			color_type = chunk[9];
+			//Interlaced images are not supported
+			if (chunk[12] != 0) {
+				return false;
+			}
+		} else if (std::memcmp(type, "PLTE", 4) == 0) {
+			for (unsigned int i = 0; i < length / 3 && i < 256; ++i) {
+				palette[i][0] = chunk[3 * i];
+				palette[i][1] = chunk[3 * i + 1];
+				palette[i][2] = chunk[3 * i + 2];
+			}
+		} else if (std::memcmp(type, "tRNS", 4) == 0 && color_type == 3) {
+			for (unsigned int i = 0; i < length && i < 256; ++i) {
+				palette[i][3] = chunk[i];
+			}
+		} else if (std::memcmp(type, "IDAT", 4) == 0) {
+			compressed.insert(compressed.end(), chunk, chunk + length);
+		} else if (std::memcmp(type, "IEND", 4) == 0) {
+			break;
+		}
+		offset += 12 + size_t(length);
+	}
+
+	static const int CHANNELS[7] = { 1, 0, 3, 1, 2, 0, 4 };
+	if (width == 0 || height == 0 || color_type < 0 || color_type > 6 || CHANNELS[color_type] == 0) {
+		return false;
+	}
+	if (!(depth == 8 || (depth == 16 && color_type != 3))) {
+		return false;
+	}
+	const size_t channels = size_t(CHANNELS[color_type]);
+	const size_t bpp = channels * size_t(depth / 8);
+	const size_t stride = size_t(width) * bpp;
+	if (width > MAX_DIMENSION || height > MAX_DIMENSION || stride + 1 > MAX_IMAGE_BYTES / height || size_t(width) * 4 > MAX_IMAGE_BYTES / height) {
+		return false;
+	}
+
+	std::vector<unsigned char> pixels;
+	pixels.reserve(size_t(height) * (stride + 1));
+	if (!zlib_inflate(compressed.data(), compressed.size(), pixels) || pixels.size() < size_t(height) * (stride + 1)) {
+		return false;
+	}
+	if (!unfilter(pixels, height, stride, bpp)) {
+		return false;
+	}
+
+	image.width = width;
+	image.height = height;
+	image.rgba.resize(size_t(width) * height * 4);
+	const size_t step = size_t(depth / 8);
+	for (size_t y = 0; y < height; ++y) {
+		const unsigned char* row = &pixels[y * (stride + 1) + 1];
+		unsigned char* out = &image.rgba[y * width * 4];
+		for (size_t x = 0; x < width; ++x, out += 4) {
+			//The high byte comes first in 16 bits samples
+			const unsigned char* in = row + x * bpp;
+			switch (color_type) {
+			case 0: out[0] = out[1] = out[2] = in[0]; out[3] = 255; break;
+			case 2: out[0] = in[0]; out[1] = in[step]; out[2] = in[2 * step]; out[3] = 255; break;
+			case 3: std::memcpy(out, palette[in[0]], 4); break;
+			case 4: out[0] = out[1] = out[2] = in[0]; out[3] = in[step]; break;
+			case 6: out[0] = in[0]; out[1] = in[step]; out[2] = in[2 * step]; out[3] = in[3 * step]; break;
+			}
+		}
+	}
+	return true;
+}
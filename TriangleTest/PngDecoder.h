@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/* Decoded image, rows top to bottom, four bytes per pixel */
+struct Image {
+	unsigned int width;
+	unsigned int height;
+	std::vector<unsigned char> rgba;
+};
+
+/* Decode a PNG held in memory: gray, gray alpha, RGB, RGBA with 8 or 16 bits
+(16 bits keep the high byte) and 8 bits palettes, not interlaced, up to
+16384 pixels a side and 256 MB. Returns false on anything else */
+bool decode_png(const unsigned char* data, size_t size, Image& image);
+
+/* Raw DEFLATE stream inside a zlib wrapper, appended to out */
+bool zlib_inflate(const unsigned char* data, size_t size, std::vector<unsigned char>& out);
@@ -0,0 +1,161 @@
+#include "RenderQueue.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+const unsigned int PASS_BITS = 4;
+const unsigned int PROGRAM_BITS = 8;
+const unsigned int VERTEX_ARRAY_BITS = 12;
+const unsigned int MATERIAL_BITS = 16;
+const unsigned int DEPTH_BITS = 24;
+
+//Position of the lowest bit of every field for one key order
+struct KeyLayout {
+	unsigned int pass;
+	unsigned int program;
+	unsigned int vertex_array;
+	unsigned int material;
+	unsigned int depth;
+};
+
+/* Pass on top, then either the state fields with the depth below them, or
+the depth with the state below it */
+const KeyLayout STATE_LAYOUT = { 60, 52, 40, 24, 0 };
+const KeyLayout DEPTH_LAYOUT = { 60, 28, 16, 0, 36 };
+
+const KeyLayout& layout_of(DrawKeyOrder order) {
+	return order == SORT_BY_STATE ? STATE_LAYOUT : DEPTH_LAYOUT;
+}
+
+std::uint64_t mask(unsigned int bits) {
+	return (std::uint64_t(1) << bits) - 1;
+}
+
+std::uint64_t field(unsigned int value, unsigned int bits, unsigned int shift) {
+	return (std::uint64_t(value) & mask(bits)) << shift;
+}
+
+unsigned int extract(std::uint64_t key, unsigned int bits, unsigned int shift) {
+	return static_cast<unsigned int>((key >> shift) & mask(bits));
+}
+
+}//namespace
+
+std::uint64_t encode_draw_key(const DrawKeyFields& fields, DrawKeyOrder order) {
+	const KeyLayout& layout = layout_of(order);
+	unsigned int depth = fields.depth;
+	//Far to near is near to far with the depth flipped
+	if (order == SORT_BACK_TO_FRONT) {
+		depth = static_cast<unsigned int>(mask(DEPTH_BITS)) - (depth & static_cast<unsigned int>(mask(DEPTH_BITS)));
+	}
+	return field(fields.pass, PASS_BITS, layout.pass) |
+		field(fields.program, PROGRAM_BITS, layout.program) |
+		field(fields.vertex_array, VERTEX_ARRAY_BITS, layout.vertex_array) |
+		field(fields.material, MATERIAL_BITS, layout.material) |
+		field(depth, DEPTH_BITS, layout.depth);
+}
+
+DrawKeyFields decode_draw_key(std::uint64_t key, DrawKeyOrder order) {
+	const KeyLayout& layout = layout_of(order);
+	DrawKeyFields fields;
+	fields.pass = extract(key, PASS_BITS, layout.pass);
+	fields.program = extract(key, PROGRAM_BITS, layout.program);
+	fields.vertex_array = extract(key, VERTEX_ARRAY_BITS, layout.vertex_array);
+	fields.material = extract(key, MATERIAL_BITS, layout.material);
+	fields.depth = extract(key, DEPTH_BITS, layout.depth);
+	if (order == SORT_BACK_TO_FRONT) {
+		fields.depth = static_cast<unsigned int>(mask(DEPTH_BITS)) - fields.depth;
+	}
+	return fields;
+}
+
+unsigned int quantize_depth(float view_depth) {
+	/* The bits of a positive float sort like its value, keep the exponent
+	and the top 15 bits of the mantissa */
+	view_depth = std::max(view_depth, 0.0f);
+	std::uint32_t bits;
+	std::memcpy(&bits, &view_depth, sizeof(bits));
+	return bits >> (32 - DEPTH_BITS);
+}
+
+RenderQueue::RenderQueue(DrawKeyOrder order) : order(order) {
+}
+
+void RenderQueue::push(const DrawKeyFields& fields, unsigned int payload) {
+	push(encode_draw_key(fields, order), payload);
+}
+
+void RenderQueue::push(std::uint64_t key, unsigned int payload) {
+	RenderItem item = { key, payload };
+	queue.push_back(item);
+}
+
+void RenderQueue::sort() {
+	const size_t count = queue.size();
+	if (count < 2) {
+		return;
+	}
+
+	/* Histograms of the eight bytes in one read of the keys */
+	static const int RADIX_PASSES = 8;
+	std::vector<size_t> histograms(RADIX_PASSES * 256, 0);
+	for (size_t i = 0; i < count; ++i) {
+		std::uint64_t key = queue[i].key;
+		for (int pass = 0; pass < RADIX_PASSES; ++pass) {
+			++histograms[pass * 256 + ((key >> (8 * pass)) & 0xFF)];
+		}
+	}
+
+	scratch.resize(count);
+	std::vector<RenderItem>* source = &queue;
+	std::vector<RenderItem>* destination = &scratch;
+	for (int pass = 0; pass < RADIX_PASSES; ++pass) {
+		size_t* histogram = &histograms[pass * 256];
+		//Every key has the same byte here, this pass would not move anything
+		unsigned int first_byte = static_cast<unsigned int>(((*source)[0].key >> (8 * pass)) & 0xFF);
+		if (histogram[first_byte] == count) {
+			continue;
+		}
+		size_t offset = 0;
+		for (int b = 0; b < 256; ++b) {
+			size_t n = histogram[b];
+			histogram[b] = offset;
+			offset += n;
+		}
+		const RenderItem* in = source->data();
+		RenderItem* out = destination->data();
+		for (size_t i = 0; i < count; ++i) {
+			out[histogram[(in[i].key >> (8 * pass)) & 0xFF]++] = in[i];
+		}
+		std::swap(source, destination);
+	}
+	if (source != &queue) {
+		queue.swap(scratch);
+	}
+}
+
+unsigned int RenderQueue::submit(DrawSubmitter& submitter) const {
+	unsigned int binds = 0;
+	DrawKeyFields bound = { 0, 0, 0, 0, 0 };
+	for (size_t i = 0; i < queue.size(); ++i) {
+		DrawKeyFields fields = decode_draw_key(queue[i].key, order);
+		bool first = i == 0;
+		if (first || fields.program != bound.program) {
+			submitter.set_program(fields.program);
+			++binds;
+		}
+		if (first || fields.vertex_array != bound.vertex_array) {
+			submitter.set_vertex_array(fields.vertex_array);
+			++binds;
+		}
+		if (first || fields.material != bound.material) {
+			submitter.set_material(fields.material);
+			++binds;
+		}
+		bound = fields;
+		submitter.draw(queue[i].payload);
+	}
+	return binds;
+}
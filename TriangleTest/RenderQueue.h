@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/* What a draw needs bound, and how far it is. The widths are the bits every
+field gets in the key, larger values are truncated */
+struct DrawKeyFields {
+	//4 bits: shadow, opaque, transparent... drawn in increasing order
+	unsigned int pass;
+	//8 bits
+	unsigned int program;
+	//12 bits: vertex array, or the buffers bound without VAOs
+	unsigned int vertex_array;
+	//16 bits
+	unsigned int material;
+	//24 bits, see quantize_depth()
+	unsigned int depth;
+};
+
+/* Order of the fields inside the key, the pass always comes first.
+SORT_BY_STATE groups draws sharing a program, then buffers, then material,
+so the fewest binds happen. The depth orders favour early-z (opaque) or
+correct blending (transparent) */
+enum DrawKeyOrder {
+	SORT_BY_STATE,
+	SORT_FRONT_TO_BACK,
+	SORT_BACK_TO_FRONT,
+};
+
+std::uint64_t encode_draw_key(const DrawKeyFields& fields, DrawKeyOrder order);
+DrawKeyFields decode_draw_key(std::uint64_t key, DrawKeyOrder order);
+
+//24 bits that sort like the view depth, negative depths become zero
+unsigned int quantize_depth(float view_depth);
+
+struct RenderItem {
+	std::uint64_t key;
+	//What to draw, usually an index into the caller's array of draws
+	unsigned int payload;
+};
+
+//Receives the sorted draws, a bind only when its value differs from the previous draw
+class DrawSubmitter {
+public:
+	virtual ~DrawSubmitter() {}
+	virtual void set_program(unsigned int program) = 0;
+	virtual void set_vertex_array(unsigned int vertex_array) = 0;
+	virtual void set_material(unsigned int material) = 0;
+	virtual void draw(unsigned int payload) = 0;
+};
+
+/* Draws of one frame as 64 bits keys plus a payload. sort() is an LSD radix
+sort (8 bits per pass, the passes where every key has the same byte are
+skipped) so the cost is linear in the number of draws */
+class RenderQueue {
+public:
+	explicit RenderQueue(DrawKeyOrder order = SORT_BY_STATE);
+
+	void clear() { queue.clear(); }
+	void push(const DrawKeyFields& fields, unsigned int payload);
+	//For keys built by the caller
+	void push(std::uint64_t key, unsigned int payload);
+
+	void sort();
+
+	/* Walk the sorted draws, reporting the state changes. Returns how many
+	binds were issued */
+	unsigned int submit(DrawSubmitter& submitter) const;
+
+	const std::vector<RenderItem>& items() const { return queue; }
+	DrawKeyOrder key_order() const { return order; }
+
+private:
+	DrawKeyOrder order;
+	std::vector<RenderItem> queue;
+	std::vector<RenderItem> scratch;
+};
@@ -0,0 +1,84 @@
+#include "Skinning.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "MathDispatch.h"
+#include "Parallel.h"
+
+namespace {
+
+//Vertices per task, a multiple of the eight the kernels work on
+const size_t SKIN_GRAIN = 8192;
+//Bones further than this from a vertex, in bone spacings, do not move it
+const float CHAIN_REACH = 1.5f;
+
+static_assert(sizeof(glm::fdualquat) == 8 * sizeof(float), "The bones must match the std430 layout of the shader");
+static_assert(sizeof(glm::u16vec4) == 4 * sizeof(unsigned short), "Joints are read as four unsigned shorts");
+
+}//namespace
+
+void skin_dual_quaternions(const SkinnedMesh& mesh, const glm::fdualquat* bones, glm::vec3* out_positions, glm::vec3* out_normals) {
+	const glm::vec3* normals = out_normals && !mesh.normals.empty() ? mesh.normals.data() : nullptr;
+	ThreadPool::shared().parallel_for(mesh.positions.size(), SKIN_GRAIN, [&](size_t begin, size_t end) {
+		skin_dual_quaternions(bones, &mesh.joints[begin], &mesh.weights[begin], &mesh.positions[begin],
+			normals ? normals + begin : nullptr, out_positions + begin, normals ? out_normals + begin : nullptr, end - begin);
+	});
+}
+
+void skin_matrices(const SkinnedMesh& mesh, const glm::mat4* bones, glm::vec3* out_positions, glm::vec3* out_normals) {
+	const glm::vec3* normals = out_normals && !mesh.normals.empty() ? mesh.normals.data() : nullptr;
+	ThreadPool::shared().parallel_for(mesh.positions.size(), SKIN_GRAIN, [&](size_t begin, size_t end) {
+		skin_matrices(bones, &mesh.joints[begin], &mesh.weights[begin], &mesh.positions[begin],
+			normals ? normals + begin : nullptr, out_positions + begin, normals ? out_normals + begin : nullptr, end - begin);
+	});
+}
+
+glm::mat4 bone_matrix(const glm::fdualquat& bone) {
+	glm::mat4 m = glm::mat4_cast(bone.real);
+	//The translation is twice the vector part of dual * conjugate(real)
+	glm::quat t = bone.dual * glm::conjugate(bone.real);
+	m[3] = glm::vec4(2.0f * t.x, 2.0f * t.y, 2.0f * t.z, 1.0f);
+	return m;
+}
+
+SkinnedMesh bind_to_bone_chain(const std::vector<Vertex>& vertices, const std::vector<glm::vec3>& normals, unsigned int bone_count) {
+	SkinnedMesh mesh;
+	mesh.positions.resize(vertices.size());
+	mesh.normals = normals;
+	mesh.joints.resize(vertices.size());
+	mesh.weights.resize(vertices.size());
+	const float spacing = 2.0f / float(bone_count);
+	const int last_bone = int(bone_count) - 1;
+	for (size_t i = 0; i < vertices.size(); ++i) {
+		mesh.positions[i] = vertices[i].position;
+		/* Position along the chain in bones, bone b is centered on b. The
+		four bones around it get a weight falling with the distance */
+		float s = (vertices[i].position.y + 1.0f) / spacing - 0.5f;
+		int first = int(std::floor(s)) - 1;
+		glm::vec4 weights(0.0f);
+		for (int k = 0; k < 4; ++k) {
+			int bone = first + k;
+			weights[k] = std::max(0.0f, 1.0f - std::abs(s - float(bone)) / CHAIN_REACH);
+			mesh.joints[i][k] = glm::uint16(glm::clamp(bone, 0, last_bone));
+		}
+		mesh.weights[i] = weights / (weights.x + weights.y + weights.z + weights.w);
+	}
+	return mesh;
+}
+
+std::vector<glm::fdualquat> pose_bone_chain(unsigned int bone_count, float twist, float bend) {
+	std::vector<glm::fdualquat> bones(bone_count);
+	const float spacing = 2.0f / float(bone_count);
+	for (unsigned int i = 0; i < bone_count; ++i) {
+		float share = float(i + 1) / float(bone_count);
+		glm::quat rotation = glm::angleAxis(bend * share, glm::vec3(0.0f, 0.0f, 1.0f)) * glm::angleAxis(twist * share, glm::vec3(0.0f, 1.0f, 0.0f));
+		//Turn around the center: p' = R (p - c) + c
+		glm::vec3 center(0.0f, -1.0f + (float(i) + 0.5f) * spacing, 0.0f);
+		bones[i] = glm::fdualquat(rotation, center - rotation * center);
+	}
+	return bones;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/gtc/type_precision.hpp>
+#include <glm/gtx/dual_quaternion.hpp>
+
+#include "Mesh.h"
+
+/* Bind pose of a skinned mesh, one array per attribute. The CPU path reads
+them in place and GpuSkinner uploads the same arrays as vertex attributes,
+so both paths share one layout */
+struct SkinnedMesh {
+	std::vector<glm::vec3> positions;
+	std::vector<glm::vec3> normals;
+	//Four bones per vertex, unused ones have weight zero. The weights of a vertex must not all be zero
+	std::vector<glm::u16vec4> joints;
+	std::vector<glm::vec4> weights;
+};
+
+/* Bones are unit dual quaternions, real part then dual part and x, y, z, w
+in each: 32 bytes against 64 for a matrix. The vertex shader of GpuSkinner
+reads the same bytes as std430 struct Bone { vec4 real; vec4 dual; } */
+
+/* Dual quaternion linear blending (DLB): the bones of a vertex are summed by
+weight, each on the side of the first one, then normalized. Twists keep
+their volume where blended matrices collapse. Eight vertices at a time with
+the kernels of MathDispatch.h, split over the shared thread pool.
+out_normals may be null, out_positions may be mesh.positions */
+void skin_dual_quaternions(const SkinnedMesh& mesh, const glm::fdualquat* bones, glm::vec3* out_positions, glm::vec3* out_normals);
+
+/* Linear blend skinning of the same mesh with skinning matrices, the
+classic method to compare with. The normals go through the blended matrix
+and are not normalized again */
+void skin_matrices(const SkinnedMesh& mesh, const glm::mat4* bones, glm::vec3* out_positions, glm::vec3* out_normals);
+
+//Skinning matrix of a unit dual quaternion
+glm::mat4 bone_matrix(const glm::fdualquat& bone);
+
+/* Chain of bone_count bones along y, their centers evenly spread over
+[-1, 1]. Every vertex is weighted between the bones nearest to its height */
+SkinnedMesh bind_to_bone_chain(const std::vector<Vertex>& vertices, const std::vector<glm::vec3>& normals, unsigned int bone_count);
+
+/* Pose of that chain: bone i turns around its center by its share of the
+twist (around y) and of the bend (around z), the top bone by all of it */
+std::vector<glm::fdualquat> pose_bone_chain(unsigned int bone_count, float twist, float bend);
@@ -0,0 +1,178 @@
+#include "Transforms.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include <glm/glm.hpp>
+
+#include "MathDispatch.h"
+#include "Parallel.h"
+
+namespace {
+
+//Nodes per task, smaller levels are updated on the calling thread
+const size_t UPDATE_GRAIN = 1024;
+//Nodes whose rotation is converted, and children multiplied by their parent, per call
+const size_t MULTIPLY_BATCH = 64;
+
+//T * R * S without building the three matrices
+glm::mat4 compose(const glm::vec3& t, const glm::mat3& R, const glm::vec3& s) {
+	return glm::mat4(glm::vec4(R[0] * s.x, 0.0f), glm::vec4(R[1] * s.y, 0.0f), glm::vec4(R[2] * s.z, 0.0f), glm::vec4(t, 1.0f));
+}
+
+template <typename T>
+void permute(std::vector<T>& values, const std::vector<unsigned int>& order) {
+	std::vector<T> sorted(values.size());
+	for (size_t i = 0; i < order.size(); ++i) {
+		sorted[i] = values[order[i]];
+	}
+	values.swap(sorted);
+}
+
+}//namespace
+
+TransformHierarchy::TransformHierarchy() : first_dirty_level(0), unsorted(false) {
+}
+
+unsigned int TransformHierarchy::add(unsigned int parent, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale) {
+	unsigned int slot = static_cast<unsigned int>(slots.size());
+	unsigned int parent_slot = parent == NO_PARENT ? NO_PARENT : slots[parent];
+	translations.push_back(translation);
+	rotations.push_back(rotation);
+	scales.push_back(scale);
+	parents.push_back(parent_slot);
+	depths.push_back(parent == NO_PARENT ? 0 : depths[parent_slot] + 1);
+	dirty.push_back(1);
+	worlds.push_back(glm::mat4(1.0f));
+	slots.push_back(slot);
+	unsorted = true;
+	return slot;
+}
+
+void TransformHierarchy::set_translation(unsigned int handle, const glm::vec3& translation) {
+	translations[slots[handle]] = translation;
+	mark_dirty(slots[handle]);
+}
+
+void TransformHierarchy::set_rotation(unsigned int handle, const glm::quat& rotation) {
+	rotations[slots[handle]] = rotation;
+	mark_dirty(slots[handle]);
+}
+
+void TransformHierarchy::set_scale(unsigned int handle, const glm::vec3& scale) {
+	scales[slots[handle]] = scale;
+	mark_dirty(slots[handle]);
+}
+
+void TransformHierarchy::mark_dirty(unsigned int slot) {
+	dirty[slot] = 1;
+	first_dirty_level = std::min<size_t>(first_dirty_level, depths[slot]);
+}
+
+void TransformHierarchy::sort_by_depth() {
+	/* Stable, so the nodes of a level keep the order they were added in */
+	const size_t count = slots.size();
+	std::vector<unsigned int> order(count);
+	for (size_t i = 0; i < count; ++i) {
+		order[i] = static_cast<unsigned int>(i);
+	}
+	std::stable_sort(order.begin(), order.end(), [this](unsigned int a, unsigned int b) {
+		return depths[a] < depths[b];
+	});
+	std::vector<unsigned int> new_slot(count);
+	for (size_t i = 0; i < count; ++i) {
+		new_slot[order[i]] = static_cast<unsigned int>(i);
+	}
+
+	permute(translations, order);
+	permute(rotations, order);
+	permute(scales, order);
+	permute(parents, order);
+	permute(depths, order);
+	permute(dirty, order);
+	permute(worlds, order);
+	for (size_t i = 0; i < count; ++i) {
+		if (parents[i] != NO_PARENT) {
+			parents[i] = new_slot[parents[i]];
+		}
+	}
+	for (size_t h = 0; h < count; ++h) {
+		slots[h] = new_slot[slots[h]];
+	}
+
+	level_offsets.clear();
+	for (size_t i = 0; i < count; ++i) {
+		while (level_offsets.size() <= depths[i]) {
+			level_offsets.push_back(i);
+		}
+	}
+	level_offsets.push_back(count);
+	first_dirty_level = 0;
+	unsorted = false;
+}
+
+size_t TransformHierarchy::update() {
+	if (unsorted) {
+		sort_by_depth();
+	}
+	const size_t levels = level_offsets.empty() ? 0 : level_offsets.size() - 1;
+	if (first_dirty_level >= levels) {
+		return 0;
+	}
+
+	/* A node is recomputed when it or its parent is dirty, and it becomes
+	dirty itself so the level below sees it */
+	std::atomic<size_t> recomputed(0);
+	for (size_t level = first_dirty_level; level < levels; ++level) {
+		const size_t first = level_offsets[level];
+		ThreadPool::shared().parallel_for(level_offsets[level + 1] - first, UPDATE_GRAIN, [&](size_t begin, size_t end) {
+			//Rotations gathered for quats_to_mat3, then parent and local matrices for multiply_matrices
+			glm::quat rotations_batch[MULTIPLY_BATCH];
+			glm::mat3 bases[MULTIPLY_BATCH];
+			glm::mat4 parent_worlds[MULTIPLY_BATCH];
+			glm::mat4 locals[MULTIPLY_BATCH];
+			size_t targets[MULTIPLY_BATCH];
+			size_t child_targets[MULTIPLY_BATCH];
+			size_t batched = 0;
+			auto flush = [&]() {
+				quats_to_mat3(rotations_batch, bases, batched);
+				size_t children = 0;
+				for (size_t k = 0; k < batched; ++k) {
+					size_t i = targets[k];
+					glm::mat4 local = compose(translations[i], bases[k], scales[i]);
+					if (parents[i] == NO_PARENT) {
+						worlds[i] = local;
+						continue;
+					}
+					parent_worlds[children] = worlds[parents[i]];
+					locals[children] = local;
+					child_targets[children++] = i;
+				}
+				multiply_matrices(parent_worlds, locals, locals, children);
+				for (size_t k = 0; k < children; ++k) {
+					worlds[child_targets[k]] = locals[k];
+				}
+				batched = 0;
+			};
+			size_t n = 0;
+			for (size_t i = first + begin; i < first + end; ++i) {
+				unsigned int parent = parents[i];
+				if (!dirty[i] && (parent == NO_PARENT || !dirty[parent])) {
+					continue;
+				}
+				dirty[i] = 1;
+				++n;
+				rotations_batch[batched] = rotations[i];
+				targets[batched++] = i;
+				if (batched == MULTIPLY_BATCH) {
+					flush();
+				}
+			}
+			flush();
+			recomputed += n;
+		});
+	}
+	std::fill(dirty.begin() + level_offsets[first_dirty_level], dirty.end(), 0);
+	first_dirty_level = levels;
+	return recomputed;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+/* Local translation, rotation and scale of every node of a scene, stored as
+structure of arrays sorted by depth in the hierarchy, so parents always come
+before their children. update() walks the levels in order and recomputes,
+one level at a time in parallel, only the nodes that changed and everything
+below them. The world matrices end up in one contiguous array.
+Nodes are addressed by handles, which survive the reordering */
+class TransformHierarchy {
+public:
+	static const unsigned int NO_PARENT = 0xFFFFFFFFu;
+
+	TransformHierarchy();
+
+	//New node below parent (NO_PARENT for a root), returns its handle
+	unsigned int add(unsigned int parent, const glm::vec3& translation = glm::vec3(0.0f),
+		const glm::quat& rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f), const glm::vec3& scale = glm::vec3(1.0f));
+
+	void set_translation(unsigned int handle, const glm::vec3& translation);
+	void set_rotation(unsigned int handle, const glm::quat& rotation);
+	void set_scale(unsigned int handle, const glm::vec3& scale);
+	const glm::vec3& translation(unsigned int handle) const { return translations[slots[handle]]; }
+	const glm::quat& rotation(unsigned int handle) const { return rotations[slots[handle]]; }
+	const glm::vec3& scale(unsigned int handle) const { return scales[slots[handle]]; }
+
+	/* Bring the world matrices up to date, returns how many were recomputed.
+	Costs nothing when no node changed since the last call */
+	size_t update();
+
+	//World matrix of a node as of the last update()
+	const glm::mat4& world(unsigned int handle) const { return worlds[slots[handle]]; }
+
+	/* Every world matrix in depth order, ready to upload. slot() tells where
+	a node is, it changes only when nodes are added */
+	const glm::mat4* world_matrices() const { return worlds.data(); }
+	unsigned int slot(unsigned int handle) const { return slots[handle]; }
+	size_t size() const { return slots.size(); }
+
+private:
+	void mark_dirty(unsigned int slot);
+	void sort_by_depth();
+
+	//Indexed by slot
+	std::vector<glm::vec3> translations;
+	std::vector<glm::quat> rotations;
+	std::vector<glm::vec3> scales;
+	std::vector<unsigned int> parents;
+	std::vector<unsigned int> depths;
+	std::vector<unsigned char> dirty;
+	std::vector<glm::mat4> worlds;
+	//First slot of every depth, plus the end
+	std::vector<size_t> level_offsets;
+	//Slot of every handle
+	std::vector<unsigned int> slots;
+	//Shallowest depth holding a dirty node, depth count when there is none
+	size_t first_dirty_level;
+	//Added nodes sit at the end until the next update sorts them
+	bool unsorted;
+};
@@ -1,26 +1,60 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include <GL/glew.h>
 #include <GL/freeglut.h>
 
-#define GLM_FORCE_PURE
-#define GLM_FORCE_RADIANS
+//GLM_FORCE_RADIANS is set in the project, every source file must agree on it
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include "Mesh.h"
+#include "Bvh.h"
+#include "CookedAssets.h"
+#include "CpuCulling.h"
+#include "Frustum.h"
+#include "GeometryPool.h"
+#include "Gltf.h"
+#include "GpuCulling.h"
+#include "GpuSkinning.h"
+#include "IndexPacking.h"
+#include "Instances.h"
+#include "MathDispatch.h"
+#include "MeshAttributes.h"
+#include "MeshImport.h"
+#include "MeshLod.h"
+#include "Meshlets.h"
+#include "MeshWeld.h"
+#include "Noise.h"
+#include "Parallel.h"
+#include "RenderQueue.h"
+#include "Skinning.h"
+#include "Transforms.h"
+#include "VertexCache.h"
+
 // Define a helpful macro for handling offsets into buffer objects
 #define BUFFER_OFFSET( offset )   ((GLvoid*) (offset))
 #define OFFSET_OF(type, member) ((GLvoid*)(offsetof(type, member)))
 //Math constant equal two PI
 const float TAU = 6.28318f;
-
-struct Vertex {
-	glm::vec3 position;
-	glm::vec3 color;
-};
+//Constant matrices and camera inputs, built by the compiler when it supports C++14 constexpr
+GLM_CONSTEXPR_CXX14 const glm::mat4 identity(1.0f);
+GLM_CONSTEXPR_CXX14 const glm::vec3 camera_up(0.0f, 1.0f, 0.0f);
+GLM_CONSTEXPR_CXX14 const glm::vec3 camera_eye(0.0f, 0.0f, 0.0f);
+const float camera_fovy = TAU / 8.0f;
+const float camera_z_near = 0.01f;
+const float camera_z_far = 10000.0f;
+//Bones of the skinning demo chain
+const unsigned int SKIN_BONE_COUNT = 16;
+//Heightmap samples along each side of the terrain demo, and its height for noise one
+const unsigned int TERRAIN_SIZE = 512;
+const float TERRAIN_RELIEF = 0.25f;
 
 GLint window = 0;
 // Location for shader variables
@@ -31,12 +65,115 @@ GLint a_color_loc = -1;
 GLuint vertex_shader;
 GLuint fragment_shader;
 GLuint program;
+// Instanced program, the model matrix and the tint come from the instance buffer
+GLuint instanced_program;
+GLint u_PV_location = -1;
+GLint a_inst_position_loc = -1;
+GLint a_inst_color_loc = -1;
+GLint a_model_row_loc[3] = { -1, -1, -1 };
+GLint a_instance_color_loc = -1;
+// glTF program, lit from the camera and tinted by the material base color and texture
+GLuint gltf_program = 0;
+GLint u_gltf_PVM_location = -1;
+GLint u_gltf_M_location = -1;
+GLint u_base_color_location = -1;
+GLint u_base_texture_location = -1;
+GLint a_gltf_position_loc = -1;
+GLint a_gltf_normal_loc = -1;
+GLint a_gltf_color_loc = -1;
+GLint a_gltf_texcoord_loc = -1;
 
 //Global variables for the program logic
 int nTriangles;
+float camera_distance;
+//Command line options
+bool lod_demo = false;
+float lod_pixel_error = 1.0f;
+//Number of copies drawn with one instanced call, zero disables instancing
+unsigned int instance_count = 0;
+//Number of objects drawn from the geometry pool with one multi draw, zero disables it
+unsigned int pool_object_count = 0;
+//Cull the pool objects on the GPU, optionally against last frame depth
+bool gpu_culling = false;
+bool depth_pyramid_culling = false;
+//Cull the pool objects on the CPU and upload only the visible commands
+bool cpu_culling = false;
+//Build the demo sphere from a triangle soup through the welder
+bool weld_demo = false;
+//Color the demo sphere by generated smooth normals
+bool normals_demo = false;
+//Draw the pool objects front to back, sorted through the render queue
+bool sort_draws = false;
+//Draw a dense sphere as meshlets, culled by frustum and normal cone
+bool meshlet_demo = false;
+//OBJ, PLY or glTF file drawn instead of the demo sphere
+std::string mesh_path;
+//The file is a glTF scene
+bool gltf_demo = false;
+//The file was written by the AssetCooker
+bool cooked_demo = false;
+//Twist and bend the demo mesh with a chain of bones, in the vertex shader unless cpu_skinning
+bool skinning_demo = false;
+bool cpu_skinning = false;
+//Draw a heightmap of fractal noise generated at startup
+bool terrain_demo = false;
+//Level of detail chain of the demo mesh
+LodChain lod_chain;
+//Drawn range of the index buffer, the LOD level when there are several
+unsigned int current_lod;
 //Manage the Vertex Buffer Object
 GLuint vbo;
 GLuint indexBuffer;
+//Index type and draw calls of indexBuffer, per range
+IndexLayout index_layout;
+//Cooked meshes are quantized
+bool quantized_vertices = false;
+//Maps the quantized positions back into the unit sphere
+glm::mat4 dequantize(1.0f);
+//Only changes with the window shape, see reshape
+glm::mat4 projection(1.0f);
+GLuint instanceBuffer = 0;
+//Meshlet vertices and their byte sized local indices
+MeshletMesh meshlet_mesh;
+GLuint meshletVbo = 0;
+GLuint meshletIbo = 0;
+//Many different meshes sharing one VBO/IBO, drawn through indirect commands (one per meshlet in the meshlet demo)
+GeometryPool geometry_pool;
+GLuint indirectBuffer = 0;
+std::vector<DrawElementsIndirectCommand> draw_commands;
+GpuCuller gpu_culler;
+//Copy of the depth buffer the occlusion pyramid is built from
+GLuint depthTexture = 0;
+BoundingSpheres object_bounds;
+FrustumCuller cpu_culler;
+std::vector<unsigned int> visible_objects;
+std::vector<DrawElementsIndirectCommand> visible_commands;
+size_t visible_count = 0;
+RenderQueue render_queue(SORT_FRONT_TO_BACK);
+double cull_milliseconds = 0.0;
+//Scene transforms, the drawn mesh hangs from model_node
+TransformHierarchy scene;
+unsigned int model_node;
+//Loaded glTF scene, its nodes hang from gltf_root below model_node
+GltfScene gltf_scene;
+unsigned int gltf_root;
+//Bound in place of textures still loading
+GLuint whiteTexture = 0;
+//Hierarchy over the drawn mesh for mouse picking, and the matrix of the last frame
+Bvh mesh_bvh;
+glm::mat4 last_PVM;
+//Skinning demo, the pose angles change with the keyboard
+SkinnedMesh skinned_mesh;
+GpuSkinner gpu_skinner;
+float skin_twist = 0.0f;
+float skin_bend = 0.0f;
+//The CPU path skins into these and uploads them to vbo with the bind pose colors
+std::vector<Vertex> skinned_vertices;
+std::vector<glm::vec3> skinned_positions;
+std::vector<glm::vec3> skinned_normals;
+double skin_milliseconds = 0.0;
+//Terrain demo, n switches the noise between Perlin and simplex
+FractalNoise terrain_noise = { NOISE_PERLIN, 8, 4.0f, 2.0f, 0.5f };
 
 void create_glut_window();
 void init_program();
@@ -44,13 +181,38 @@ void init_OpenGL();
 void create_primitives();
 void create_glut_callbacks();
 void exit_glut();
+void parse_arguments(int argc, char* argv[]);
+void upload_mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const std::vector<IndexRange>& ranges = std::vector<IndexRange>());
+bool load_cooked_mesh(const std::string& path);
+void create_instances();
+void create_geometry_pool();
+void create_meshlets(const Mesh& mesh);
+void create_skinned_mesh(const Mesh& mesh);
+void update_skinning();
+Mesh create_terrain_mesh();
+Mesh create_demo_mesh();
+GLuint create_program(const std::string& vertex_shader_src, const std::string& fragment_shader_src);
+void draw_mesh(const glm::mat4& PVM);
+void draw_indexed(unsigned int range, GLsizei instances);
+void draw_instances(const glm::mat4& PV);
+void draw_geometry_pool(const glm::mat4& PV);
+void draw_meshlets(const glm::mat4& PVM, const glm::vec3& camera_position);
+void draw_gltf(const glm::mat4& PV);
+void bind_gltf_attribute(GLint location, const GltfAttribute& attribute, const glm::vec4& fallback);
+void bind_instanced_attributes(GLuint vertex_buffer, GLuint instance_buffer);
+void update_depth_pyramid();
+void unbind_instanced_attributes();
 
 //Glut callback functions
 void display();
 void reshape(int new_window_width, int new_window_height);
+void keyboard(unsigned char key, int mouse_x, int mouse_y);
+void mouse(int button, int state, int mouse_x, int mouse_y);
 
 int main(int argc, char* argv[]) {
 	glutInit(&argc, argv);
+	//glutInit removed its own options, the rest are ours
+	parse_arguments(argc, argv);
 
 	create_glut_window();
 	init_OpenGL();
@@ -69,11 +231,105 @@ void exit_glut() {
 	glDeleteShader(vertex_shader);
 	glDeleteShader(fragment_shader);
 	glDeleteProgram(program);
+	if (instance_count > 0 || pool_object_count > 0) {
+		glDeleteProgram(instanced_program);
+		glDeleteBuffers(1, &instanceBuffer);
+	}
+	if (pool_object_count > 0) {
+		geometry_pool.destroy();
+		glDeleteBuffers(1, &indirectBuffer);
+	}
+	if (gpu_culling) {
+		gpu_culler.destroy();
+		glDeleteTextures(1, &depthTexture);
+	}
+	if (meshlet_demo) {
+		glDeleteBuffers(1, &meshletVbo);
+		glDeleteBuffers(1, &meshletIbo);
+		glDeleteBuffers(1, &indirectBuffer);
+	}
+	if (gltf_program != 0) {
+		gltf_scene.destroy();
+		glDeleteProgram(gltf_program);
+		glDeleteTextures(1, &whiteTexture);
+	}
+	if (skinning_demo && !cpu_skinning) {
+		gpu_skinner.destroy();
+	}
 	/* Delete window (freeglut) */
 	glutDestroyWindow(window);
 	exit(EXIT_SUCCESS);
 }
 
+void parse_arguments(int argc, char* argv[]) {
+	using std::string;
+	for (int i = 1; i < argc; ++i) {
+		string option = argv[i];
+		if (option == "--lod") {
+			lod_demo = true;
+		} else if (option == "--lod-error" && i + 1 < argc) {
+			lod_demo = true;
+			lod_pixel_error = float(std::atof(argv[++i]));
+		} else if (option == "--instances" && i + 1 < argc) {
+			int count = std::atoi(argv[++i]);
+			instance_count = count > 0 ? static_cast<unsigned int>(count) : 0;
+		} else if (option == "--mdi" && i + 1 < argc) {
+			int count = std::atoi(argv[++i]);
+			pool_object_count = count > 0 ? static_cast<unsigned int>(count) : 0;
+		} else if (option == "--gpu-cull") {
+			gpu_culling = true;
+		} else if (option == "--cpu-cull") {
+			cpu_culling = true;
+		} else if (option == "--hiz") {
+			gpu_culling = true;
+			depth_pyramid_culling = true;
+		} else if (option == "--weld") {
+			weld_demo = true;
+		} else if (option == "--normals") {
+			normals_demo = true;
+		} else if (option == "--sort") {
+			sort_draws = true;
+		} else if (option == "--meshlets") {
+			meshlet_demo = true;
+		} else if (option == "--skinning") {
+			skinning_demo = true;
+		} else if (option == "--cpu-skinning") {
+			skinning_demo = true;
+			cpu_skinning = true;
+		} else if (option == "--terrain") {
+			terrain_demo = true;
+		} else if (option == "--load" && i + 1 < argc) {
+			mesh_path = argv[++i];
+		} else {
+			std::cerr << "Unknown option " << option << std::endl;
+			std::cerr << "Usage: " << argv[0] << " [--load file.obj|.ply|.gltf|.glb|.sbm] [--weld] [--normals] [--lod] [--lod-error pixels] [--instances count] [--mdi objects [--sort] | --meshlets | --skinning | --cpu-skinning | --terrain] [--cpu-cull | --gpu-cull [--hiz]]" << std::endl;
+		}
+	}
+	//glTF scenes have their own loader and program
+	string extension = mesh_path.substr(mesh_path.find_last_of('.') + 1);
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return char(std::tolower(static_cast<unsigned char>(c))); });
+	gltf_demo = !mesh_path.empty() && (extension == "gltf" || extension == "glb");
+	//Cooked meshes are drawn straight from their file, with the LODs it holds
+	cooked_demo = !mesh_path.empty() && extension == "sbm";
+	if (gltf_demo || cooked_demo) {
+		meshlet_demo = false;
+		skinning_demo = false;
+		terrain_demo = false;
+	}
+	if (meshlet_demo) {
+		skinning_demo = false;
+	}
+	if (meshlet_demo || skinning_demo) {
+		terrain_demo = false;
+	}
+	//The meshlet, skinning, terrain, glTF and cooked demos draw their mesh alone
+	if (meshlet_demo || skinning_demo || terrain_demo || gltf_demo || cooked_demo) {
+		lod_demo = false;
+		instance_count = 0;
+		pool_object_count = 0;
+	}
+}
+
 void create_glut_window() {
 	glutInitDisplayMode(GLUT_RGBA | GLUT_DOUBLE | GLUT_DEPTH);
 	glutInitWindowSize(512, 512);
@@ -83,8 +339,16 @@ void create_glut_window() {
 void init_program() {
 	/* Initialize global variables for program control */
 	nTriangles = 1;
+	camera_distance = 3.0f;
+	current_lod = 0;
+	model_node = scene.add(TransformHierarchy::NO_PARENT);
 	/* Then, create primitives */
 	create_primitives();
+	if (pool_object_count > 0) {
+		create_geometry_pool();
+	} else if (instance_count > 0) {
+		create_instances();
+	}
 }
 
 void init_OpenGL() {
@@ -107,6 +371,17 @@ void init_OpenGL() {
 	cout << "Using GLSL version: " << glGetString(GL_SHADING_LANGUAGE_VERSION) << endl;
 	int ver = glutGet(GLUT_VERSION);
 	cout << "Using freeglut version: " << ver / 10000 << "." << (ver / 100) % 100 << "." << ver % 100 << endl;
+	cout << "Using " << math_kernels().name << " math kernels" << endl;
+	//The pool objects are told apart by the first instance of their commands
+	if (pool_object_count > 0 && !multi_draw_supported()) {
+		cerr << "--mdi is off, drawing the mesh alone" << endl;
+		pool_object_count = 0;
+	}
+	//The visible meshlets are drawn with the same indirect commands
+	if (meshlet_demo && !multi_draw_supported()) {
+		cerr << "--meshlets is off, drawing the mesh alone" << endl;
+		meshlet_demo = false;
+	}
 
 	/************************************************************************/
 	/*                   OpenGL program creation                            */
@@ -176,6 +451,98 @@ void init_OpenGL() {
 	a_position_loc = glGetAttribLocation(program, "Position");
 	a_color_loc = glGetAttribLocation(program, "Color");
 
+	/* The instanced program rebuilds the model matrix from three rows
+	stored per instance, so one draw call renders every copy. The geometry
+	pool uses it too, baseInstance of each command selects the object */
+	if (instance_count > 0 || pool_object_count > 0) {
+		string instanced_vertex_shader_src =
+			"#version 330\n"
+			"in vec3 Position;\n"
+			"in vec3 Color;\n"
+			"in vec4 ModelRow0;\n"
+			"in vec4 ModelRow1;\n"
+			"in vec4 ModelRow2;\n"
+			"in vec4 InstanceColor;\n"
+			"\n"
+			"uniform mat4 PV;\n"
+			"\n"
+			"out vec4 vColor;\n"
+			"\n"
+			"void main(void) {\n"
+			"\tvec4 p = vec4(Position, 1.0);\n"
+			"\tvec4 world = vec4(dot(ModelRow0, p), dot(ModelRow1, p), dot(ModelRow2, p), 1.0);\n"
+			"\tgl_Position = PV * world;\n"
+			"\tvColor = vec4(Color * InstanceColor.rgb, 1.0);\n"
+			"}\n";
+
+		instanced_program = create_program(instanced_vertex_shader_src, fragment_shader_src);
+		u_PV_location = glGetUniformLocation(instanced_program, "PV");
+		a_inst_position_loc = glGetAttribLocation(instanced_program, "Position");
+		a_inst_color_loc = glGetAttribLocation(instanced_program, "Color");
+		a_model_row_loc[0] = glGetAttribLocation(instanced_program, "ModelRow0");
+		a_model_row_loc[1] = glGetAttribLocation(instanced_program, "ModelRow1");
+		a_model_row_loc[2] = glGetAttribLocation(instanced_program, "ModelRow2");
+		a_instance_color_loc = glGetAttribLocation(instanced_program, "InstanceColor");
+	}
+
+	/* glTF vertices may lack normals, colors or texture coordinates, the
+	draw sets a constant value for the missing ones */
+	if (gltf_demo) {
+		string gltf_vertex_shader_src =
+			"#version 330\n"
+			"in vec3 Position;\n"
+			"in vec3 Normal;\n"
+			"in vec4 Color;\n"
+			"in vec2 TexCoord;\n"
+			"\n"
+			"uniform mat4 PVM;\n"
+			"uniform mat4 M;\n"
+			"\n"
+			"out vec4 vColor;\n"
+			"out vec2 vTexCoord;\n"
+			"\n"
+			"void main(void) {\n"
+			"\tgl_Position = PVM * vec4(Position, 1.0);\n"
+			"\t//The light sits at the camera, on the z axis\n"
+			"\tvec3 n = normalize(mat3(M) * Normal);\n"
+			"\tvColor = vec4(Color.rgb * (0.3 + 0.7 * abs(n.z)), Color.a);\n"
+			"\tvTexCoord = TexCoord;\n"
+			"}\n";
+
+		string gltf_fragment_shader_src =
+			"#version 330\n"
+			"\n"
+			"in vec4 vColor;\n"
+			"in vec2 vTexCoord;\n"
+			"\n"
+			"uniform vec4 BaseColor;\n"
+			"uniform sampler2D BaseTexture;\n"
+			"\n"
+			"out vec4 fragcolor;\n"
+			"\n"
+			"void main(void) {\n"
+			"\tfragcolor = vColor * BaseColor * texture(BaseTexture, vTexCoord);\n"
+			"}\n";
+
+		gltf_program = create_program(gltf_vertex_shader_src, gltf_fragment_shader_src);
+		u_gltf_PVM_location = glGetUniformLocation(gltf_program, "PVM");
+		u_gltf_M_location = glGetUniformLocation(gltf_program, "M");
+		u_base_color_location = glGetUniformLocation(gltf_program, "BaseColor");
+		u_base_texture_location = glGetUniformLocation(gltf_program, "BaseTexture");
+		a_gltf_position_loc = glGetAttribLocation(gltf_program, "Position");
+		a_gltf_normal_loc = glGetAttribLocation(gltf_program, "Normal");
+		a_gltf_color_loc = glGetAttribLocation(gltf_program, "Color");
+		a_gltf_texcoord_loc = glGetAttribLocation(gltf_program, "TexCoord");
+
+		const unsigned char white[4] = { 255, 255, 255, 255 };
+		glGenTextures(1, &whiteTexture);
+		glBindTexture(GL_TEXTURE_2D, whiteTexture);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
 	//Activate anti-alias
 	glEnable(GL_LINE_SMOOTH);
 	glEnable(GL_POLYGON_SMOOTH);
@@ -189,20 +556,216 @@ void init_OpenGL() {
 
 }
 
+GLuint create_program(const std::string& vertex_shader_src, const std::string& fragment_shader_src) {
+	using std::cerr;
+	using std::endl;
+
+	GLuint vertex = glCreateShader(GL_VERTEX_SHADER);
+	const char* start = &vertex_shader_src[0];
+	glShaderSource(vertex, 1, &start, nullptr);
+
+	GLuint fragment = glCreateShader(GL_FRAGMENT_SHADER);
+	start = &fragment_shader_src[0];
+	glShaderSource(fragment, 1, &start, nullptr);
+
+	int status;
+	glCompileShader(vertex);
+	glGetShaderiv(vertex, GL_COMPILE_STATUS, &status);
+	if (status == GL_FALSE) {
+		cerr << "Vertex shader was not compiled!!" << endl;
+	}
+	glCompileShader(fragment);
+	glGetShaderiv(fragment, GL_COMPILE_STATUS, &status);
+	if (status == GL_FALSE) {
+		cerr << "Fragment shader was not compiled!!" << endl;
+	}
+	GLuint new_program = glCreateProgram();
+	glAttachShader(new_program, vertex);
+	glAttachShader(new_program, fragment);
+	glLinkProgram(new_program);
+	glGetProgramiv(new_program, GL_LINK_STATUS, &status);
+	if (status == GL_FALSE) {
+		cerr << "OpenGL program was not linked!!" << endl;
+	}
+	// Delete the shaders as the program has them now
+	glDeleteShader(vertex);
+	glDeleteShader(fragment);
+
+	return new_program;
+}
+
 void create_primitives() {
-	const unsigned int nVertex = 3;
-	const unsigned int nIndices = 3;
-	nTriangles = 1;
+	if (cooked_demo) {
+		if (load_cooked_mesh(mesh_path)) {
+			return;
+		}
+		//Draw the triangle instead
+		cooked_demo = false;
+		mesh_path.clear();
+	}
+	if (meshlet_demo) {
+		Mesh sphere = create_demo_mesh();
+		create_meshlets(sphere);
+		mesh_bvh.build(sphere.vertices, sphere.indices);
+		nTriangles = int(sphere.indices.size() / 3);
+		return;
+	}
+	if (skinning_demo) {
+		Mesh mesh = create_demo_mesh();
+		create_skinned_mesh(mesh);
+		nTriangles = int(mesh.indices.size() / 3);
+		//Picks against the bind pose
+		mesh_bvh.build(mesh.vertices, mesh.indices);
+		return;
+	}
+	if (terrain_demo) {
+		Mesh terrain = create_terrain_mesh();
+		upload_mesh(terrain.vertices, terrain.indices);
+		nTriangles = int(terrain.indices.size() / 3);
+		mesh_bvh.build(terrain.vertices, terrain.indices);
+		//Tilted toward the camera, which looks along -z
+		scene.set_rotation(model_node, glm::angleAxis(TAU / 10.0f, glm::vec3(1.0f, 0.0f, 0.0f)));
+		std::cout << "n switches between Perlin and simplex noise" << std::endl;
+		return;
+	}
+	if (lod_demo) {
+		/* A dense sphere and its simplified versions */
+		Mesh sphere = create_demo_mesh();
+		std::vector<LodSettings> settings = {
+			{ 0.5f, 0.0f },
+			{ 0.25f, 0.0f },
+			{ 0.1f, 0.0f },
+			{ 0.03f, 0.0f },
+			{ 0.01f, 0.0f },
+		};
+		lod_chain = build_lod_chain(sphere, settings);
+		std::vector<IndexRange> ranges;
+		for (size_t i = 0; i < lod_chain.levels.size(); ++i) {
+			std::cout << "LOD " << i << ": " << lod_chain.levels[i].index_count / 3 << " triangles, error " << lod_chain.levels[i].error << std::endl;
+			IndexRange range = { lod_chain.levels[i].first_index, lod_chain.levels[i].index_count };
+			ranges.push_back(range);
+		}
+		//Nearby vertices for nearby triangles, what a 16 bits split needs
+		if (sphere.vertices.size() > 65536) {
+			optimize_vertex_fetch(sphere.vertices, lod_chain.indices);
+		}
+		upload_mesh(sphere.vertices, lod_chain.indices, ranges);
+		nTriangles = lod_chain.levels[0].index_count / 3;
+		//Pick against the full detail level
+		mesh_bvh.build(sphere.vertices, std::vector<unsigned int>(lod_chain.indices.begin(), lod_chain.indices.begin() + lod_chain.levels[0].index_count));
+		return;
+	}
 
-	Vertex points[nVertex] = {
+	if (gltf_demo) {
+		gltf_root = scene.add(model_node);
+		if (gltf_scene.load(mesh_path, scene, gltf_root)) {
+			std::cout << "Loaded " << gltf_scene.draw_nodes().size() << " glTF nodes with " << gltf_scene.primitives().size() << " primitives" << std::endl;
+			/* Centered and scaled to the unit sphere, where the demo sphere is */
+			scene.update();
+			glm::vec3 low;
+			glm::vec3 high;
+			if (gltf_scene.bounds(scene, low, high)) {
+				float radius = 0.5f * glm::length(high - low);
+				float scale = radius > 0.0f ? 1.0f / radius : 1.0f;
+				scene.set_scale(gltf_root, glm::vec3(scale));
+				scene.set_translation(gltf_root, -scale * 0.5f * (low + high));
+			}
+			return;
+		}
+		//Draw the triangle instead
+		gltf_demo = false;
+		mesh_path.clear();
+	}
+	if (!mesh_path.empty()) {
+		Mesh mesh = create_demo_mesh();
+		if (mesh.vertices.size() > 65536) {
+			optimize_vertex_fetch(mesh.vertices, mesh.indices);
+		}
+		upload_mesh(mesh.vertices, mesh.indices);
+		nTriangles = int(mesh.indices.size() / 3);
+		mesh_bvh.build(mesh.vertices, mesh.indices);
+		return;
+	}
+
+	Mesh triangle;
+	triangle.vertices = {
 		{ { -1.0f, -1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, }, //0
 		{ { 1.0f, -1.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, }, //1
 		{ { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } }, //2
 	};
-
-	unsigned short indices[nIndices] = {
+	triangle.indices = {
 		0, 1, 2,
 	};
+	nTriangles = 1;
+
+	upload_mesh(triangle.vertices, triangle.indices);
+	mesh_bvh.build(triangle.vertices, triangle.indices);
+}
+
+Mesh create_demo_mesh() {
+	Mesh mesh;
+	bool has_colors = true;
+	if (!mesh_path.empty()) {
+		ImportInfo info;
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		if (import_mesh(mesh_path, mesh, info) && !mesh.indices.empty()) {
+			std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+			std::cout << "Loaded " << mesh.vertices.size() << " vertices and " << mesh.indices.size() / 3 << " triangles in "
+				<< std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+			has_colors = info.has_colors;
+			/* Centered and scaled to the unit mesh, where the demo mesh is */
+			glm::vec3 low = mesh.vertices[0].position;
+			glm::vec3 high = low;
+			for (size_t i = 1; i < mesh.vertices.size(); ++i) {
+				low = glm::min(low, mesh.vertices[i].position);
+				high = glm::max(high, mesh.vertices[i].position);
+			}
+			glm::vec3 center = 0.5f * (low + high);
+			float radius = 0.0f;
+			for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+				radius = glm::max(radius, glm::length(mesh.vertices[i].position - center));
+			}
+			float scale = radius > 0.0f ? 1.0f / radius : 1.0f;
+			for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+				mesh.vertices[i].position = scale * (mesh.vertices[i].position - center);
+			}
+		} else {
+			mesh = Mesh();
+		}
+	}
+	if (mesh.indices.empty()) {
+		mesh = create_sphere_mesh(256, 128);
+	}
+	if (weld_demo) {
+		/* What a loader without index data hands over, welded back */
+		std::vector<Vertex> soup = unweld_mesh(mesh);
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		mesh = weld_vertices(soup);
+		std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+		std::cout << "Welded " << soup.size() << " vertices into " << mesh.vertices.size() << " in "
+			<< std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+	}
+	//Files without colors are colored by their normals
+	if (normals_demo || !has_colors) {
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		std::vector<glm::vec3> normals = compute_normals(mesh.vertices, mesh.indices);
+		std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+		std::cout << "Generated " << normals.size() << " normals in " << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+		for (size_t i = 0; i < normals.size(); ++i) {
+			mesh.vertices[i].color = 0.5f * normals[i] + 0.5f;
+		}
+	}
+	return mesh;
+}
+
+void upload_mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const std::vector<IndexRange>& ranges) {
+	//16 bits indices, split into base vertex draws when the mesh is bigger than that
+	std::vector<unsigned char> packed_indices;
+	index_layout = pack_indices(indices, vertices.size(), ranges, packed_indices);
+	if (vertices.size() > 65536) {
+		std::cout << "Drawing " << vertices.size() << " vertices with " << 8 * index_layout.index_size << " bits indices in "
+			<< index_layout.chunks.size() << " draws" << std::endl;
+	}
 
 	//Create the buffers
 	glGenBuffers(1, &vbo);
@@ -211,58 +774,589 @@ void create_primitives() {
 	//Send data to GPU
 	//First send the vertices
 	glBindBuffer(GL_ARRAY_BUFFER, vbo);
-	glBufferData(GL_ARRAY_BUFFER, nVertex * sizeof(Vertex), points, GL_STATIC_DRAW);
+	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 	//Now, the indices
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, nIndices * sizeof(unsigned short), indices, GL_STATIC_DRAW);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, packed_indices.size(), packed_indices.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+bool load_cooked_mesh(const std::string& path) {
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	CookedMeshFile file;
+	if (!file.open(path) || file.header().index_count == 0 || file.header().lod_count == 0) {
+		return false;
+	}
+	const CookedMeshHeader& header = file.header();
+
+	/* The blocks go to the GPU as they are in the file */
+	glGenBuffers(1, &vbo);
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, header.vertex_count * sizeof(CookedVertex), file.vertices(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glGenBuffers(1, &indexBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, GLsizeiptr(header.index_count) * header.index_size, file.indices(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	quantized_vertices = true;
+
+	/* Normalized positions are in [0, 1], back to the mesh box and then
+	centered and scaled to the unit sphere, where the demo sphere is */
+	glm::vec3 box_min(header.box_min[0], header.box_min[1], header.box_min[2]);
+	glm::vec3 box_size(header.box_size[0], header.box_size[1], header.box_size[2]);
+	glm::vec3 center(header.center[0], header.center[1], header.center[2]);
+	float scale = header.radius > 0.0f ? 1.0f / header.radius : 1.0f;
+	dequantize = glm::scale(identity, glm::vec3(scale)) * glm::translate(identity, box_min - center) * glm::scale(identity, box_size);
+
+	//The errors were measured on the source mesh, they scale with it
+	lod_chain.levels.resize(header.lod_count);
+	index_layout.index_size = header.index_size;
+	index_layout.chunks.clear();
+	index_layout.range_chunks.assign(1, 0);
+	for (unsigned int i = 0; i < header.lod_count; ++i) {
+		LodLevel level = { file.lods()[i].first_index, file.lods()[i].index_count, scale * file.lods()[i].error };
+		lod_chain.levels[i] = level;
+		//The cooker picked the index type, one draw per level
+		IndexChunk chunk = { level.first_index, level.index_count, 0 };
+		index_layout.chunks.push_back(chunk);
+		index_layout.range_chunks.push_back(i + 1);
+	}
+	lod_chain.center = glm::vec3(0.0f);
+	lod_chain.radius = 1.0f;
+	lod_demo = header.lod_count > 1;
+	nTriangles = int(lod_chain.levels[0].index_count / 3);
+	std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+	std::cout << "Loaded " << header.vertex_count << " cooked vertices and " << header.lod_count << " LODs in "
+		<< std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+
+	/* Picking needs positions on the CPU, the full detail level is enough */
+	std::vector<Vertex> vertices(header.vertex_count);
+	for (unsigned int i = 0; i < header.vertex_count; ++i) {
+		const unsigned short* q = file.vertices()[i].position;
+		vertices[i].position = glm::vec3(q[0], q[1], q[2]) / 65535.0f;
+		vertices[i].color = glm::vec3(1.0f);
+	}
+	if (!vertices.empty()) {
+		transform_points(dequantize, &vertices[0].position, sizeof(Vertex), &vertices[0].position, sizeof(Vertex), vertices.size());
+	}
+	std::vector<unsigned int> indices(lod_chain.levels[0].index_count);
+	for (size_t i = 0; i < indices.size(); ++i) {
+		size_t k = lod_chain.levels[0].first_index + i;
+		indices[i] = header.index_size == 2 ? static_cast<const unsigned short*>(file.indices())[k] : static_cast<const unsigned int*>(file.indices())[k];
+	}
+	mesh_bvh.build(vertices, indices);
+	return true;
+}
+
+void create_instances() {
+	const float spacing = 3.0f;
+	std::vector<Instance> instances = create_instance_grid(instance_count, spacing);
+
+	glGenBuffers(1, &instanceBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+	glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(Instance), instances.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	//Back up far enough to see the whole grid
+	camera_distance = glm::max(camera_distance, 2.5f * instance_grid_radius(instance_count, spacing));
+	std::cout << "Drawing " << instance_count << " instances of " << nTriangles << " triangles" << std::endl;
+}
+
+void create_geometry_pool() {
+	/* A library of different meshes, all of them living in the same buffers */
+	std::vector<Mesh> library;
+	GLuint total_vertices = 0;
+	GLuint total_indices = 0;
+	for (unsigned int k = 0; k < 16; ++k) {
+		library.push_back(create_sphere_mesh(3 + 2 * k, 2 + k));
+		total_vertices += GLuint(library.back().vertices.size());
+		total_indices += GLuint(library.back().indices.size());
+	}
+	geometry_pool.create(total_vertices, total_indices);
+	std::vector<int> handles;
+	for (size_t i = 0; i < library.size(); ++i) {
+		handles.push_back(geometry_pool.add_mesh(library[i]));
+	}
+
+	/* One command per object, baseInstance fetches its transform and tint */
+	const float spacing = 3.0f;
+	std::vector<Instance> objects = create_instance_grid(pool_object_count, spacing);
+	draw_commands.clear();
+	for (unsigned int i = 0; i < pool_object_count; ++i) {
+		draw_commands.push_back(geometry_pool.draw_command(handles[i % handles.size()], 1, i));
+	}
+	upload_draw_commands(indirectBuffer, draw_commands);
+
+	/* The culler keeps its own copy of the commands next to the bounds */
+	if (gpu_culling && !gpu_culler.create()) {
+		gpu_culling = false;
+		depth_pyramid_culling = false;
+	}
+	if ((cpu_culling || sort_draws) && !gpu_culling) {
+		object_bounds.resize(pool_object_count);
+		for (unsigned int i = 0; i < pool_object_count; ++i) {
+			glm::vec3 center(objects[i].model_rows[0].w, objects[i].model_rows[1].w, objects[i].model_rows[2].w);
+			object_bounds.set(i, center, 1.0f);
+		}
+		visible_commands.reserve(pool_object_count);
+		if (cpu_culling) {
+			std::cout << "CPU culling with " << FrustumCuller::kernel_name() << " on " << ThreadPool::shared().size() << " threads" << std::endl;
+		}
+	}
+	if (gpu_culling) {
+		//The GPU writes the commands, the CPU can not sort them
+		cpu_culling = false;
+		sort_draws = false;
+		std::vector<CullObject> cull_objects(pool_object_count);
+		for (unsigned int i = 0; i < pool_object_count; ++i) {
+			//The pool meshes are unit spheres and the transforms do not scale
+			glm::vec3 center(objects[i].model_rows[0].w, objects[i].model_rows[1].w, objects[i].model_rows[2].w);
+			cull_objects[i].sphere = glm::vec4(center, 1.0f);
+			cull_objects[i].cone = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+			cull_objects[i].command = draw_commands[i];
+		}
+		gpu_culler.set_objects(cull_objects);
+	}
+
+	glGenBuffers(1, &instanceBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+	glBufferData(GL_ARRAY_BUFFER, objects.size() * sizeof(Instance), objects.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	camera_distance = glm::max(camera_distance, 2.5f * instance_grid_radius(pool_object_count, spacing));
+	std::cout << "Drawing " << pool_object_count << " objects using " << geometry_pool.mesh_count() << " meshes with one multi draw" << std::endl;
+}
+
+void create_meshlets(const Mesh& mesh) {
+	meshlet_mesh = build_meshlets(mesh.vertices, mesh.indices);
+	std::vector<Vertex> meshlet_vertices = meshlet_vertex_buffer(meshlet_mesh, mesh.vertices);
+
+	/* Vertices in meshlet order and byte indices local to each meshlet, the
+	command of a meshlet adds its first vertex as base vertex */
+	glGenBuffers(1, &meshletVbo);
+	glBindBuffer(GL_ARRAY_BUFFER, meshletVbo);
+	glBufferData(GL_ARRAY_BUFFER, meshlet_vertices.size() * sizeof(Vertex), meshlet_vertices.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glGenBuffers(1, &meshletIbo);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshletIbo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, meshlet_mesh.indices.size(), meshlet_mesh.indices.data(), GL_STATIC_DRAW);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+	draw_commands.clear();
+	for (size_t i = 0; i < meshlet_mesh.meshlets.size(); ++i) {
+		const Meshlet& meshlet = meshlet_mesh.meshlets[i];
+		DrawElementsIndirectCommand command = { 3 * meshlet.triangle_count, 1, meshlet.index_offset, GLint(meshlet.vertex_offset), 0 };
+		draw_commands.push_back(command);
+	}
+	upload_draw_commands(indirectBuffer, draw_commands);
+
+	/* The GPU culler tests the cones too, without it the CPU culls */
+	if (gpu_culling && !gpu_culler.create()) {
+		gpu_culling = false;
+		depth_pyramid_culling = false;
+	}
+	cpu_culling = !gpu_culling;
+	if (gpu_culling) {
+		std::vector<CullObject> cull_objects(draw_commands.size());
+		for (size_t i = 0; i < draw_commands.size(); ++i) {
+			cull_objects[i].sphere = meshlet_mesh.bounds[i].sphere;
+			cull_objects[i].cone = meshlet_mesh.bounds[i].cone;
+			cull_objects[i].command = draw_commands[i];
+		}
+		gpu_culler.set_objects(cull_objects);
+	} else {
+		visible_commands.reserve(draw_commands.size());
+	}
+	std::cout << "Drawing " << mesh.indices.size() / 3 << " triangles as " << meshlet_mesh.meshlets.size() << " meshlets ("
+		<< meshlet_vertices.size() << " meshlet vertices for " << mesh.vertices.size() << " vertices)" << std::endl;
+}
+
+void create_skinned_mesh(const Mesh& mesh) {
+	skinned_mesh = bind_to_bone_chain(mesh.vertices, compute_normals(mesh.vertices, mesh.indices), SKIN_BONE_COUNT);
+	/* Skinned in the vertex shader when it can read the bones, the CPU
+	skins the VBO of the plain program otherwise */
+	if (!cpu_skinning && !gpu_skinner.create()) {
+		cpu_skinning = true;
+	}
+	if (cpu_skinning) {
+		skinned_vertices = mesh.vertices;
+		for (size_t i = 0; i < skinned_vertices.size(); ++i) {
+			skinned_vertices[i].color = 0.5f * skinned_mesh.normals[i] + 0.5f;
+		}
+		skinned_positions.resize(skinned_vertices.size());
+		upload_mesh(skinned_vertices, mesh.indices);
+	} else {
+		gpu_skinner.set_mesh(skinned_mesh, mesh.indices);
+	}
+	std::cout << "Skinning " << mesh.vertices.size() << " vertices with " << SKIN_BONE_COUNT << " bones on the " << (cpu_skinning ? "CPU" : "GPU")
+		<< ", t and b twist and bend them" << std::endl;
+	update_skinning();
+}
+
+void update_skinning() {
+	std::vector<glm::fdualquat> bones = pose_bone_chain(SKIN_BONE_COUNT, skin_twist, skin_bend);
+	if (!cpu_skinning) {
+		gpu_skinner.set_bones(bones);
+		return;
+	}
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	skin_dual_quaternions(skinned_mesh, bones.data(), skinned_positions.data(), nullptr);
+	std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+	skin_milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+	for (size_t i = 0; i < skinned_vertices.size(); ++i) {
+		skinned_vertices[i].position = skinned_positions[i];
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, skinned_vertices.size() * sizeof(Vertex), skinned_vertices.data());
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+Mesh create_terrain_mesh() {
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	std::vector<float> heights = noise_grid(terrain_noise, TERRAIN_SIZE, TERRAIN_SIZE);
+	std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+	std::cout << "Generated " << TERRAIN_SIZE << " x " << TERRAIN_SIZE << " samples of " << terrain_noise.octaves << " octaves of "
+		<< (terrain_noise.type == NOISE_SIMPLEX ? "simplex" : "Perlin") << " noise in " << std::chrono::duration<double, std::milli>(end - start).count()
+		<< " ms" << std::endl;
+	return create_heightmap_mesh(heights, TERRAIN_SIZE, TERRAIN_SIZE, TERRAIN_RELIEF);
 }
 
 void create_glut_callbacks() {
 	glutDisplayFunc(display);
 	glutReshapeFunc(reshape);
+	glutKeyboardFunc(keyboard);
+	glutMouseFunc(mouse);
 }
 
 void reshape(int new_window_width, int new_window_height) {
 	glViewport(0, 0, new_window_width, new_window_height);
+	//A minimized window has no height
+	if (new_window_height > 0) {
+		float aspect = float(new_window_width) / float(new_window_height);
+		projection = glm::perspective(camera_fovy, aspect, camera_z_near, camera_z_far);
+	}
+}
+
+void keyboard(unsigned char key, int mouse_x, int mouse_y) {
+	switch (key) {
+	case 27:
+		exit_glut();
+		break;
+	case '+':
+		camera_distance = glm::max(1.5f, camera_distance / 1.25f);
+		break;
+	case '-':
+		camera_distance = camera_distance * 1.25f;
+		break;
+	case 'r':
+		//Spin the model a bit around the vertical axis
+		scene.set_rotation(model_node, glm::angleAxis(TAU / 24.0f, glm::vec3(0.0f, 1.0f, 0.0f)) * scene.rotation(model_node));
+		break;
+	case 't':
+		if (skinning_demo) {
+			skin_twist += TAU / 16.0f;
+			update_skinning();
+		}
+		break;
+	case 'b':
+		if (skinning_demo) {
+			skin_bend += TAU / 32.0f;
+			update_skinning();
+		}
+		break;
+	case 'n':
+		if (terrain_demo) {
+			terrain_noise.type = terrain_noise.type == NOISE_PERLIN ? NOISE_SIMPLEX : NOISE_PERLIN;
+			//Same grid, only the vertices change
+			Mesh terrain = create_terrain_mesh();
+			glBindBuffer(GL_ARRAY_BUFFER, vbo);
+			glBufferSubData(GL_ARRAY_BUFFER, 0, terrain.vertices.size() * sizeof(Vertex), terrain.vertices.data());
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			mesh_bvh.build(terrain.vertices, terrain.indices);
+		}
+		break;
+	case 'c':
+		if (gpu_culling) {
+			std::cout << gpu_culler.read_visible_count() << " of " << draw_commands.size() << " objects passed the GPU culling" << std::endl;
+		}
+		if (cpu_culling) {
+			std::cout << visible_count << " of " << draw_commands.size() << " objects passed the CPU culling in " << cull_milliseconds << " ms" << std::endl;
+		}
+		if (skinning_demo && cpu_skinning) {
+			std::cout << "Skinned " << skinned_positions.size() << " vertices in " << skin_milliseconds << " ms" << std::endl;
+		}
+		break;
+	}
+	glutPostRedisplay();
+}
+
+void mouse(int button, int state, int mouse_x, int mouse_y) {
+	//Picking only makes sense when a single mesh is drawn
+	if (button != GLUT_LEFT_BUTTON || state != GLUT_DOWN || instance_count > 0 || pool_object_count > 0) {
+		return;
+	}
+	/* GLUT counts pixels from the top, OpenGL from the bottom */
+	int width = glutGet(GLUT_WINDOW_WIDTH);
+	int height = glutGet(GLUT_WINDOW_HEIGHT);
+	glm::vec4 viewport(0.0f, 0.0f, float(width), float(height));
+	Ray ray = make_pick_ray(last_PVM, float(mouse_x) + 0.5f, float(height - mouse_y) - 0.5f, viewport);
+	RayHit hit;
+	if (mesh_bvh.intersect(ray, hit)) {
+		std::cout << "Picked triangle " << hit.triangle << " at distance " << hit.t << std::endl;
+	} else {
+		std::cout << "Nothing picked" << std::endl;
+	}
 }
 
 void display() {
 
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	glUseProgram(program);
 
 	/************************************************************************/
 	/* Calculate  Model View Projection Matrices                            */
 	/************************************************************************/
-	//Identity matrix
-	glm::mat4 I(1.0f);
-	//Model
-	glm::mat4 M = I;
-	//View
-	glm::vec3 camera_up = glm::vec3(0.0f, 1.0f, 0.0f);
-	glm::vec3 camera_position = glm::vec3(0.0f, 0.0f, 3.0f);
-	glm::vec3 camera_eye = glm::vec3(0.0f, 0.0f, 0.0f);
+	//Model, only the nodes that changed are recomputed
+	scene.update();
+	glm::mat4 M = scene.world(model_node);
+	//View, the camera distance is the only input that changes
+	glm::vec3 camera_position = glm::vec3(0.0f, 0.0f, camera_distance);
 	glm::mat4 V = glm::lookAt(camera_position, camera_eye, camera_up);
-	//Projection
-	GLfloat aspect = (float)glutGet(GLUT_WINDOW_WIDTH) / (float)glutGet(GLUT_WINDOW_HEIGHT);
-	GLfloat fovy = TAU / 8.0f;
-	GLfloat zNear = 0.01f;
-	GLfloat zFar = 10000.0f;
-	glm::mat4 P = glm::perspective(fovy, aspect, zNear, zFar);
+	//Projection, rebuilt by reshape
+	const glm::mat4& P = projection;
+
+	/************************************************************************/
+	/* Pick the level of detail from its projected error                    */
+	/************************************************************************/
+	if (lod_demo) {
+		unsigned int lod = select_lod(lod_chain, P * V * M, float(glutGet(GLUT_WINDOW_HEIGHT)), lod_pixel_error);
+		if (lod != current_lod) {
+			current_lod = lod;
+			std::cout << "Using LOD " << lod << std::endl;
+		}
+		nTriangles = lod_chain.levels[lod].index_count / 3;
+	}
+
+	if (pool_object_count > 0) {
+		draw_geometry_pool(P * V);
+	} else if (instance_count > 0) {
+		draw_instances(P * V);
+	} else if (gltf_demo) {
+		gltf_scene.poll_textures();
+		draw_gltf(P * V);
+	} else if (skinning_demo && !cpu_skinning) {
+		last_PVM = P * V * M;
+		gpu_skinner.draw(last_PVM);
+	} else if (meshlet_demo) {
+		last_PVM = P * V * M;
+		//The meshlet bounds are in model space
+		draw_meshlets(last_PVM, glm::vec3(glm::inverse(M) * glm::vec4(camera_position, 1.0f)));
+	} else {
+		last_PVM = P * V * M;
+		draw_mesh(last_PVM);
+	}
+
+	//Next frame tests occlusion against this frame depth
+	if (depth_pyramid_culling) {
+		update_depth_pyramid();
+	}
+
+	glutSwapBuffers();
+}
+
+void update_depth_pyramid() {
+	int width = glutGet(GLUT_WINDOW_WIDTH);
+	int height = glutGet(GLUT_WINDOW_HEIGHT);
+	if (depthTexture == 0) {
+		glGenTextures(1, &depthTexture);
+		glBindTexture(GL_TEXTURE_2D, depthTexture);
+		//No mipmaps, texelFetch needs a complete texture
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+	glBindTexture(GL_TEXTURE_2D, depthTexture);
+	glCopyTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, 0, 0, width, height, 0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	gpu_culler.build_depth_pyramid(depthTexture, width, height);
+}
+
+void draw_mesh(const glm::mat4& PVM) {
+	glUseProgram(program);
 
 	/************************************************************************/
 	/* Send uniform values to shader                                        */
 	/************************************************************************/
 	if (u_PVM_location != -1) {
-		glUniformMatrix4fv(u_PVM_location, 1, GL_FALSE, glm::value_ptr(P * V * M));
+		glm::mat4 vertex_PVM = PVM * dequantize;
+		glUniformMatrix4fv(u_PVM_location, 1, GL_FALSE, glm::value_ptr(vertex_PVM));
 	}
 
 	/************************************************************************/
 	/* Bind buffer object and their corresponding attributes                */
 	/************************************************************************/
 	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	if (quantized_vertices) {
+		//Normalized integers, the shader still sees floats
+		if (a_position_loc != -1) {
+			glEnableVertexAttribArray(a_position_loc);
+			glVertexAttribPointer(a_position_loc, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(CookedVertex), OFFSET_OF(CookedVertex, position));
+		}
+		if (a_color_loc != -1) {
+			glEnableVertexAttribArray(a_color_loc);
+			glVertexAttribPointer(a_color_loc, 3, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(CookedVertex), OFFSET_OF(CookedVertex, color));
+		}
+	} else {
+		if (a_position_loc != -1) {
+			glEnableVertexAttribArray(a_position_loc);
+			glVertexAttribPointer(a_position_loc, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), OFFSET_OF(Vertex, position));
+		}
+		if (a_color_loc != -1) {
+			glEnableVertexAttribArray(a_color_loc);
+			glVertexAttribPointer(a_color_loc, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), OFFSET_OF(Vertex, color));
+		}
+	}
+	//Bind the index buffer
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+
+	/* Draw */
+	draw_indexed(current_lod, 0);
+
+	/* Unbind and clean */
+	if (a_position_loc != -1) {
+		glDisableVertexAttribArray(a_position_loc);
+	}
+	if (a_color_loc != -1) {
+		glDisableVertexAttribArray(a_color_loc);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	glUseProgram(0);
+}
+
+void draw_indexed(unsigned int range, GLsizei instances) {
+	/* One call per chunk of the range, the base vertex brings its 16 bits
+	indices back to the whole vertex buffer */
+	GLenum index_type = index_layout.index_size == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+	for (unsigned int i = index_layout.range_chunks[range]; i < index_layout.range_chunks[range + 1]; ++i) {
+		const IndexChunk& chunk = index_layout.chunks[i];
+		GLvoid* offset = BUFFER_OFFSET(size_t(chunk.first_index) * index_layout.index_size);
+		if (instances > 0) {
+			glDrawElementsInstancedBaseVertex(GL_TRIANGLES, GLsizei(chunk.index_count), index_type, offset, instances, GLint(chunk.base_vertex));
+		} else {
+			glDrawElementsBaseVertex(GL_TRIANGLES, GLsizei(chunk.index_count), index_type, offset, GLint(chunk.base_vertex));
+		}
+	}
+}
+
+void draw_instances(const glm::mat4& PV) {
+	glUseProgram(instanced_program);
+
+	if (u_PV_location != -1) {
+		glUniformMatrix4fv(u_PV_location, 1, GL_FALSE, glm::value_ptr(PV));
+	}
+	bind_instanced_attributes(vbo, instanceBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+
+	/* Draw every copy at once */
+	draw_indexed(current_lod, instance_count);
+
+	/* Unbind and clean */
+	unbind_instanced_attributes();
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	glUseProgram(0);
+}
+
+/* Turns the sorted draws into indirect commands. The pool draws share the
+program and the buffers and a mesh is only a range of them, so the binds
+reported by the queue need no GL call */
+class IndirectSubmitter : public DrawSubmitter {
+public:
+	explicit IndirectSubmitter(std::vector<DrawElementsIndirectCommand>& commands) : commands(commands) {
+		commands.clear();
+	}
+	void set_program(unsigned int) {}
+	void set_vertex_array(unsigned int) {}
+	void set_material(unsigned int) {}
+	void draw(unsigned int payload) {
+		commands.push_back(draw_commands[payload]);
+	}
+
+private:
+	std::vector<DrawElementsIndirectCommand>& commands;
+};
+
+void draw_geometry_pool(const glm::mat4& PV) {
+	glUseProgram(instanced_program);
+
+	if (u_PV_location != -1) {
+		glUniformMatrix4fv(u_PV_location, 1, GL_FALSE, glm::value_ptr(PV));
+	}
+	bind_instanced_attributes(geometry_pool.vertex_buffer(), instanceBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry_pool.index_buffer());
+
+	/* Every object of every mesh in one call */
+	if (gpu_culling) {
+		//The pool objects have no cones, the camera position is not used
+		gpu_culler.cull(PV, glm::vec3(0.0f), depth_pyramid_culling);
+		gpu_culler.draw();
+	} else if (cpu_culling || sort_draws) {
+		if (cpu_culling) {
+			std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+			visible_count = cpu_culler.cull(object_bounds, PV, visible_objects);
+			std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+			cull_milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+		} else {
+			visible_count = draw_commands.size();
+			visible_objects.resize(visible_count);
+			for (size_t i = 0; i < visible_count; ++i) {
+				visible_objects[i] = static_cast<unsigned int>(i);
+			}
+		}
+
+		/* Near objects first so the depth test rejects the fragments behind
+		them. Clip w is the view depth */
+		if (sort_draws) {
+			render_queue.clear();
+			for (size_t i = 0; i < visible_count; ++i) {
+				unsigned int object = visible_objects[i];
+				glm::vec4 clip = PV * glm::vec4(object_bounds.x()[object], object_bounds.y()[object], object_bounds.z()[object], 1.0f);
+				DrawKeyFields fields = { 0, 0, 0, static_cast<unsigned int>(object % geometry_pool.mesh_count()), quantize_depth(clip.w) };
+				render_queue.push(fields, object);
+			}
+			render_queue.sort();
+			IndirectSubmitter submitter(visible_commands);
+			render_queue.submit(submitter);
+		} else {
+			visible_commands.resize(visible_count);
+			for (size_t i = 0; i < visible_count; ++i) {
+				visible_commands[i] = draw_commands[visible_objects[i]];
+			}
+		}
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+		glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, visible_count * sizeof(DrawElementsIndirectCommand), visible_commands.data());
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		multi_draw(indirectBuffer, GLsizei(visible_count));
+	} else {
+		multi_draw(indirectBuffer, GLsizei(draw_commands.size()));
+	}
+
+	/* Unbind and clean */
+	unbind_instanced_attributes();
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	glUseProgram(0);
+}
+
+void draw_meshlets(const glm::mat4& PVM, const glm::vec3& camera_position) {
+	glUseProgram(program);
+
+	if (u_PVM_location != -1) {
+		glUniformMatrix4fv(u_PVM_location, 1, GL_FALSE, glm::value_ptr(PVM));
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, meshletVbo);
 	if (a_position_loc != -1) {
 		glEnableVertexAttribArray(a_position_loc);
 		glVertexAttribPointer(a_position_loc, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), OFFSET_OF(Vertex, position));
@@ -271,11 +1365,32 @@ void display() {
 		glEnableVertexAttribArray(a_color_loc);
 		glVertexAttribPointer(a_color_loc, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), OFFSET_OF(Vertex, color));
 	}
-	//Bind the index buffer
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshletIbo);
 
-	/* Draw */
-	glDrawElements(GL_TRIANGLES, 3 * nTriangles, GL_UNSIGNED_SHORT, BUFFER_OFFSET(0 * sizeof(unsigned short)));
+	/* Only the meshlets inside the frustum that face the camera */
+	if (gpu_culling) {
+		gpu_culler.cull(PVM, camera_position, depth_pyramid_culling);
+		gpu_culler.draw(GL_UNSIGNED_BYTE);
+	} else {
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		glm::vec4 planes[6];
+		extract_frustum_planes(PVM, planes);
+		visible_commands.clear();
+		for (size_t i = 0; i < meshlet_mesh.bounds.size(); ++i) {
+			const MeshletBounds& bounds = meshlet_mesh.bounds[i];
+			if (sphere_in_frustum(planes, glm::vec3(bounds.sphere), bounds.sphere.w) && !meshlet_backfacing(bounds, camera_position)) {
+				visible_commands.push_back(draw_commands[i]);
+			}
+		}
+		visible_count = visible_commands.size();
+		std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+		cull_milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+		glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, visible_count * sizeof(DrawElementsIndirectCommand), visible_commands.data());
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		multi_draw(indirectBuffer, GLsizei(visible_count), GL_UNSIGNED_BYTE);
+	}
 
 	/* Unbind and clean */
 	if (a_position_loc != -1) {
@@ -284,10 +1399,126 @@ void display() {
 	if (a_color_loc != -1) {
 		glDisableVertexAttribArray(a_color_loc);
 	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	glUseProgram(0);
+}
+
+void draw_gltf(const glm::mat4& PV) {
+	glUseProgram(gltf_program);
+	glActiveTexture(GL_TEXTURE0);
+	if (u_base_texture_location != -1) {
+		glUniform1i(u_base_texture_location, 0);
+	}
 
+	/* Every node with a mesh, every primitive with the layout of its file */
+	const std::vector<GltfPrimitive>& primitives = gltf_scene.primitives();
+	const std::vector<GltfDrawNode>& nodes = gltf_scene.draw_nodes();
+	for (size_t n = 0; n < nodes.size(); ++n) {
+		const glm::mat4& M = scene.world(nodes[n].node);
+		if (u_gltf_PVM_location != -1) {
+			glUniformMatrix4fv(u_gltf_PVM_location, 1, GL_FALSE, glm::value_ptr(PV * M));
+		}
+		if (u_gltf_M_location != -1) {
+			glUniformMatrix4fv(u_gltf_M_location, 1, GL_FALSE, glm::value_ptr(M));
+		}
+		for (size_t p = nodes[n].first_primitive; p < nodes[n].first_primitive + nodes[n].primitive_count; ++p) {
+			const GltfPrimitive& primitive = primitives[p];
+			bind_gltf_attribute(a_gltf_position_loc, primitive.position, glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+			bind_gltf_attribute(a_gltf_normal_loc, primitive.normal, glm::vec4(0.0f, 0.0f, 1.0f, 0.0f));
+			bind_gltf_attribute(a_gltf_color_loc, primitive.color, glm::vec4(1.0f));
+			bind_gltf_attribute(a_gltf_texcoord_loc, primitive.texcoord, glm::vec4(0.0f));
+			if (u_base_color_location != -1) {
+				glUniform4fv(u_base_color_location, 1, glm::value_ptr(primitive.base_color));
+			}
+			GLuint texture = primitive.texcoord.buffer != 0 ? gltf_scene.texture(primitive.texture) : 0;
+			glBindTexture(GL_TEXTURE_2D, texture != 0 ? texture : whiteTexture);
+
+			if (primitive.index_buffer != 0) {
+				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, primitive.index_buffer);
+				glDrawElements(primitive.mode, primitive.count, primitive.index_type, BUFFER_OFFSET(primitive.index_offset));
+			} else {
+				glDrawArrays(primitive.mode, 0, primitive.count);
+			}
+		}
+	}
+
+	/* Unbind and clean */
+	GLint locations[4] = { a_gltf_position_loc, a_gltf_normal_loc, a_gltf_color_loc, a_gltf_texcoord_loc };
+	for (int i = 0; i < 4; ++i) {
+		if (locations[i] != -1) {
+			glDisableVertexAttribArray(locations[i]);
+		}
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 	glUseProgram(0);
+}
 
-	glutSwapBuffers();
+void bind_gltf_attribute(GLint location, const GltfAttribute& attribute, const glm::vec4& fallback) {
+	if (location == -1) {
+		return;
+	}
+	if (attribute.buffer == 0) {
+		//Missing in the file, every vertex gets the fallback
+		glDisableVertexAttribArray(location);
+		glVertexAttrib4fv(location, glm::value_ptr(fallback));
+		return;
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, attribute.buffer);
+	glEnableVertexAttribArray(location);
+	glVertexAttribPointer(location, attribute.components, attribute.type, attribute.normalized, attribute.stride, BUFFER_OFFSET(attribute.offset));
+}
+
+void bind_instanced_attributes(GLuint vertex_buffer, GLuint instance_buffer) {
+	/************************************************************************/
+	/* Per vertex attributes come from the mesh buffer                      */
+	/************************************************************************/
+	glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+	if (a_inst_position_loc != -1) {
+		glEnableVertexAttribArray(a_inst_position_loc);
+		glVertexAttribPointer(a_inst_position_loc, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), OFFSET_OF(Vertex, position));
+	}
+	if (a_inst_color_loc != -1) {
+		glEnableVertexAttribArray(a_inst_color_loc);
+		glVertexAttribPointer(a_inst_color_loc, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), OFFSET_OF(Vertex, color));
+	}
+
+	/************************************************************************/
+	/* Per instance attributes advance once per copy (divisor 1)            */
+	/************************************************************************/
+	glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+	for (int r = 0; r < 3; ++r) {
+		if (a_model_row_loc[r] != -1) {
+			glEnableVertexAttribArray(a_model_row_loc[r]);
+			glVertexAttribPointer(a_model_row_loc[r], 4, GL_FLOAT, GL_FALSE, sizeof(Instance), BUFFER_OFFSET(offsetof(Instance, model_rows) + r * sizeof(glm::vec4)));
+			glVertexAttribDivisor(a_model_row_loc[r], 1);
+		}
+	}
+	if (a_instance_color_loc != -1) {
+		glEnableVertexAttribArray(a_instance_color_loc);
+		glVertexAttribPointer(a_instance_color_loc, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance), OFFSET_OF(Instance, color));
+		glVertexAttribDivisor(a_instance_color_loc, 1);
+	}
+}
+
+void unbind_instanced_attributes() {
+	//The divisors must not leak into the other draws
+	for (int r = 0; r < 3; ++r) {
+		if (a_model_row_loc[r] != -1) {
+			glVertexAttribDivisor(a_model_row_loc[r], 0);
+			glDisableVertexAttribArray(a_model_row_loc[r]);
+		}
+	}
+	if (a_instance_color_loc != -1) {
+		glVertexAttribDivisor(a_instance_color_loc, 0);
+		glDisableVertexAttribArray(a_instance_color_loc);
+	}
+	if (a_inst_position_loc != -1) {
+		glDisableVertexAttribArray(a_inst_position_loc);
+	}
+	if (a_inst_color_loc != -1) {
+		glDisableVertexAttribArray(a_inst_color_loc);
+	}
 }
\ No newline at end of file
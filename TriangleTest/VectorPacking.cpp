@@ -0,0 +1,73 @@
+#include "VectorPacking.h"
+
+#include <algorithm>
+
+#include "MathDispatch.h"
+#include "Parallel.h"
+
+namespace {
+
+//Smallest part, whole 32 bytes lines of every format
+const size_t PACK_GRAIN = 16384;
+
+//One part per thread, vectors are cheap enough that more parts only cost
+size_t pack_grain(size_t count) {
+	size_t threads = ThreadPool::shared().size();
+	size_t part = (count + threads - 1) / threads;
+	return std::max(PACK_GRAIN, (part + PACK_GRAIN - 1) / PACK_GRAIN * PACK_GRAIN);
+}
+
+}//namespace
+
+void pack_array(PackFormat format, const void* in, void* out, size_t count) {
+	const size_t vector_size = pack_components(format) * sizeof(float);
+	const size_t size = packed_size(format);
+	ThreadPool::shared().parallel_for(count, pack_grain(count), [&](size_t begin, size_t end) {
+		pack_vectors(format, static_cast<const char*>(in) + begin * vector_size, static_cast<char*>(out) + begin * size, end - begin);
+	});
+}
+
+void unpack_array(PackFormat format, const void* in, void* out, size_t count) {
+	const size_t vector_size = pack_components(format) * sizeof(float);
+	const size_t size = packed_size(format);
+	ThreadPool::shared().parallel_for(count, pack_grain(count), [&](size_t begin, size_t end) {
+		unpack_vectors(format, static_cast<const char*>(in) + begin * size, static_cast<char*>(out) + begin * vector_size, end - begin);
+	});
+}
+
+size_t pack_components(PackFormat format) {
+	switch (format) {
+	case PACK_UNORM_1X8:
+	case PACK_SNORM_1X8:
+	case PACK_UNORM_1X16:
+	case PACK_SNORM_1X16:
+		return 1;
+	case PACK_UNORM_2X8:
+	case PACK_SNORM_2X8:
+	case PACK_UNORM_2X16:
+	case PACK_SNORM_2X16:
+		return 2;
+	case PACK_F2X11_1X10:
+		return 3;
+	default:
+		return 4;
+	}
+}
+
+size_t packed_size(PackFormat format) {
+	switch (format) {
+	case PACK_UNORM_1X8:
+	case PACK_SNORM_1X8:
+		return 1;
+	case PACK_UNORM_2X8:
+	case PACK_SNORM_2X8:
+	case PACK_UNORM_1X16:
+	case PACK_SNORM_1X16:
+		return 2;
+	case PACK_UNORM_4X16:
+	case PACK_SNORM_4X16:
+		return 8;
+	default:
+		return 4;
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+
+#include "MathKernels.h"
+
+/* Vertex attributes and readbacks of render targets to the packed formats
+of glm/gtc/packing.hpp and back. The array is split over the shared thread
+pool, one part per thread, and each part goes through the kernels of
+MathDispatch.h, eight components or vectors at a time. Every CPU gives the
+bits of the glm function of the format, clamps and NaNs included. in and
+out must not overlap */
+void pack_array(PackFormat format, const void* in, void* out, size_t count);
+void unpack_array(PackFormat format, const void* in, void* out, size_t count);
+
+//Components per unpacked vector, floats or ints of 4 bytes each
+size_t pack_components(PackFormat format);
+
+//Bytes per packed vector: 1 to 8
+size_t packed_size(PackFormat format);
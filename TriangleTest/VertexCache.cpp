@@ -0,0 +1,185 @@
+#include "VertexCache.h"
+
+#include <cmath>
+
+namespace {
+
+//Cache size the scores model, larger than any real hardware one
+const int CACHE_SIZE = 32;
+const int MAX_VALENCE = 32;
+
+/* Precomputed vertex scores: by position in the cache, and by the number of
+triangles still to emit (vertices with few left are finished first) */
+struct ScoreTable {
+	float cache[CACHE_SIZE];
+	float valence[MAX_VALENCE + 1];
+
+	ScoreTable() {
+		for (int i = 0; i < CACHE_SIZE; ++i) {
+			//The last triangle's vertices all score the same, it does not matter which went first
+			cache[i] = i < 3 ? 0.75f : std::pow(1.0f - float(i - 3) / float(CACHE_SIZE - 3), 1.5f);
+		}
+		valence[0] = 0.0f;
+		for (int i = 1; i <= MAX_VALENCE; ++i) {
+			valence[i] = 2.0f / std::sqrt(float(i));
+		}
+	}
+
+	float score(int cache_position, unsigned int live_triangles) const {
+		if (live_triangles == 0) {
+			return -1.0f;
+		}
+		float s = cache_position >= 0 ? cache[cache_position] : 0.0f;
+		return s + valence[live_triangles < unsigned(MAX_VALENCE) ? live_triangles : MAX_VALENCE];
+	}
+};
+
+}//namespace
+
+std::vector<unsigned int> optimize_vertex_cache(const std::vector<unsigned int>& indices, size_t vertex_count) {
+	const ScoreTable table;
+	const size_t triangle_count = indices.size() / 3;
+
+	/************************************************************************/
+	/* Triangles of every vertex, the live ones first                       */
+	/************************************************************************/
+	std::vector<unsigned int> live(vertex_count, 0);
+	for (size_t i = 0; i < 3 * triangle_count; ++i) {
+		++live[indices[i]];
+	}
+	std::vector<size_t> offsets(vertex_count + 1, 0);
+	for (size_t v = 0; v < vertex_count; ++v) {
+		offsets[v + 1] = offsets[v] + live[v];
+	}
+	std::vector<unsigned int> adjacency(3 * triangle_count);
+	{
+		std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+		for (size_t i = 0; i < 3 * triangle_count; ++i) {
+			adjacency[cursor[indices[i]]++] = static_cast<unsigned int>(i / 3);
+		}
+	}
+
+	std::vector<int> cache_position(vertex_count, -1);
+	std::vector<float> vertex_score(vertex_count);
+	for (size_t v = 0; v < vertex_count; ++v) {
+		vertex_score[v] = table.score(-1, live[v]);
+	}
+	std::vector<unsigned char> emitted(triangle_count, 0);
+
+	std::vector<unsigned int> result;
+	result.reserve(3 * triangle_count);
+	unsigned int cache[CACHE_SIZE + 3];
+	int cache_count = 0;
+	size_t next_unemitted = 0;
+	long long best = -1;
+	for (size_t emitted_count = 0; emitted_count < triangle_count; ++emitted_count) {
+		/* Nothing in the cache is worth it, restart from the first triangle
+		left. Cheaper than a search over every triangle and just as good */
+		if (best < 0) {
+			while (emitted[next_unemitted]) {
+				++next_unemitted;
+			}
+			best = static_cast<long long>(next_unemitted);
+		}
+		const size_t t = size_t(best);
+		emitted[t] = 1;
+		const unsigned int* corners = &indices[3 * t];
+
+		//Take the triangle out of the live lists of its vertices
+		for (int k = 0; k < 3; ++k) {
+			unsigned int v = corners[k];
+			result.push_back(v);
+			unsigned int* list = &adjacency[offsets[v]];
+			for (unsigned int i = 0; i < live[v]; ++i) {
+				if (list[i] == t) {
+					list[i] = list[live[v] - 1];
+					list[live[v] - 1] = static_cast<unsigned int>(t);
+					--live[v];
+					break;
+				}
+			}
+		}
+
+		/* The triangle's vertices move to the front, the others shift back.
+		The cache briefly holds CACHE_SIZE + 3 entries so the ones pushed
+		out still get their scores lowered */
+		unsigned int new_cache[CACHE_SIZE + 3];
+		int new_count = 0;
+		for (int k = 0; k < 3; ++k) {
+			bool duplicate = false;
+			for (int i = 0; i < new_count; ++i) {
+				duplicate = duplicate || new_cache[i] == corners[k];
+			}
+			if (!duplicate) {
+				new_cache[new_count++] = corners[k];
+			}
+		}
+		for (int i = 0; i < cache_count; ++i) {
+			unsigned int v = cache[i];
+			if (v != corners[0] && v != corners[1] && v != corners[2]) {
+				new_cache[new_count++] = v;
+			}
+		}
+		for (int i = 0; i < new_count; ++i) {
+			unsigned int v = new_cache[i];
+			cache_position[v] = i < CACHE_SIZE ? i : -1;
+			vertex_score[v] = table.score(cache_position[v], live[v]);
+		}
+
+		//Only triangles touching the cache changed, the next one is among them
+		best = -1;
+		float best_score = -1.0f;
+		for (int i = 0; i < new_count; ++i) {
+			unsigned int v = new_cache[i];
+			const unsigned int* list = &adjacency[offsets[v]];
+			for (unsigned int j = 0; j < live[v]; ++j) {
+				unsigned int u = list[j];
+				float s = vertex_score[indices[3 * u]] + vertex_score[indices[3 * u + 1]] + vertex_score[indices[3 * u + 2]];
+				if (s > best_score) {
+					best_score = s;
+					best = u;
+				}
+			}
+		}
+		cache_count = new_count < CACHE_SIZE ? new_count : CACHE_SIZE;
+		for (int i = 0; i < cache_count; ++i) {
+			cache[i] = new_cache[i];
+		}
+	}
+	return result;
+}
+
+void optimize_vertex_fetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices) {
+	const unsigned int UNUSED = 0xFFFFFFFFu;
+	std::vector<unsigned int> remap(vertices.size(), UNUSED);
+	std::vector<Vertex> reordered;
+	reordered.reserve(vertices.size());
+	for (size_t i = 0; i < indices.size(); ++i) {
+		unsigned int& index = remap[indices[i]];
+		if (index == UNUSED) {
+			index = static_cast<unsigned int>(reordered.size());
+			reordered.push_back(vertices[indices[i]]);
+		}
+		indices[i] = index;
+	}
+	vertices.swap(reordered);
+}
+
+float average_cache_miss_ratio(const std::vector<unsigned int>& indices, size_t vertex_count, unsigned int cache_size) {
+	if (indices.size() < 3) {
+		return 0.0f;
+	}
+	//Time stamp of every vertex entering the FIFO, a vertex is a hit while fewer than cache_size entered after it
+	std::vector<size_t> entered(vertex_count, 0);
+	size_t clock = 0;
+	size_t misses = 0;
+	for (size_t i = 0; i < indices.size(); ++i) {
+		unsigned int v = indices[i];
+		if (entered[v] == 0 || clock - entered[v] >= cache_size) {
+			++misses;
+			++clock;
+			entered[v] = clock;
+		}
+	}
+	return float(misses) / float(indices.size() / 3);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Mesh.h"
+
+/* Reorder triangles so consecutive ones share vertices while they are still
+in the post transform cache (Forsyth, "Linear-Speed Vertex Cache
+Optimisation"). Returns the reordered indices, the same triangles with the
+same winding */
+std::vector<unsigned int> optimize_vertex_cache(const std::vector<unsigned int>& indices, size_t vertex_count);
+
+/* Renumber the vertices in the order the indices first use them, so the
+vertex fetch walks memory forward. Vertices no index uses are dropped */
+void optimize_vertex_fetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+
+//Transformed vertices per triangle with a FIFO cache of cache_size entries: 3 is the worst, 0.5 the best possible
+float average_cache_miss_ratio(const std::vector<unsigned int>& indices, size_t vertex_count, unsigned int cache_size = 16);
@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx
+/// @file glm/detail/batch_simd.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// Instruction set and shared kernels of the extensions working on arrays and
+/// SIMD registers (GLM_GTX_batch_transform, GLM_GTX_wide).
+/// They only exchange plain floats with the rest of GLM, so unlike it they use
+/// the instruction set the compiler targets even when GLM_FORCE_PURE is
+/// defined. Define GLM_FORCE_BATCH_PURE to keep them scalar.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "setup.hpp"
+
+#define GLM_BATCH_SCALAR	0
+#define GLM_BATCH_SSE2		1
+#define GLM_BATCH_AVX2		2
+
+#if defined(GLM_FORCE_BATCH_PURE)
+#	define GLM_BATCH_ARCH GLM_BATCH_SCALAR
+#elif defined(__AVX2__) && (defined(__FMA__) || (GLM_COMPILER & GLM_COMPILER_VC))
+	// /arch:AVX2 lets Visual C++ use FMA but does not define __FMA__
+#	define GLM_BATCH_ARCH GLM_BATCH_AVX2
+#	include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define GLM_BATCH_ARCH GLM_BATCH_SSE2
+#	include <emmintrin.h>
+#else
+#	define GLM_BATCH_ARCH GLM_BATCH_SCALAR
+#endif
+
+namespace glm{
+namespace detail
+{
+#	if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+	GLM_FUNC_QUALIFIER __m128 batch_madd(__m128 a, __m128 b, __m128 c)
+	{
+		return _mm_fmadd_ps(a, b, c);
+	}
+#	elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+	GLM_FUNC_QUALIFIER __m128 batch_madd(__m128 a, __m128 b, __m128 c)
+	{
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+	}
+#	endif
+
+#	if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+	// Four packed vec3 (12 floats) to x, y and z registers and back
+	GLM_FUNC_QUALIFIER void batch_deinterleave4(float const * p, __m128 & x, __m128 & y, __m128 & z)
+	{
+		__m128 a = _mm_loadu_ps(p);		// x0 y0 z0 x1
+		__m128 b = _mm_loadu_ps(p + 4);	// y1 z1 x2 y2
+		__m128 c = _mm_loadu_ps(p + 8);	// z2 x3 y3 z3
+		__m128 t = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2));	// x2 y2 z2 x3
+		__m128 u = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));	// y0 z0 y1 z1
+		__m128 v = _mm_shuffle_ps(b, c, _MM_SHUFFLE(3, 2, 3, 3));	// y2 y2 y3 z3
+		__m128 w = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 0));	// z2 z3 z3 z3
+		x = _mm_shuffle_ps(a, t, _MM_SHUFFLE(3, 0, 3, 0));
+		y = _mm_shuffle_ps(u, v, _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm_shuffle_ps(u, w, _MM_SHUFFLE(1, 0, 3, 1));
+	}
+
+	GLM_FUNC_QUALIFIER void batch_interleave4(__m128 x, __m128 y, __m128 z, float * p)
+	{
+		__m128 low = _mm_unpacklo_ps(x, y);							// x0 y0 x1 y1
+		__m128 high = _mm_unpackhi_ps(x, y);						// x2 y2 x3 y3
+		__m128 p0 = _mm_shuffle_ps(z, low, _MM_SHUFFLE(2, 2, 0, 0));	// z0 z0 x1 x1
+		__m128 q = _mm_shuffle_ps(low, z, _MM_SHUFFLE(1, 1, 3, 3));	// y1 y1 z1 z1
+		__m128 r = _mm_shuffle_ps(z, high, _MM_SHUFFLE(2, 2, 2, 2));	// z2 z2 x3 x3
+		__m128 s = _mm_shuffle_ps(high, z, _MM_SHUFFLE(3, 3, 3, 3));	// y3 y3 z3 z3
+		_mm_storeu_ps(p, _mm_shuffle_ps(low, p0, _MM_SHUFFLE(2, 0, 1, 0)));
+		_mm_storeu_ps(p + 4, _mm_shuffle_ps(q, high, _MM_SHUFFLE(1, 0, 2, 0)));
+		_mm_storeu_ps(p + 8, _mm_shuffle_ps(r, s, _MM_SHUFFLE(2, 0, 2, 0)));
+	}
+#	endif
+
+#	if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+	// Eight packed vec3 (24 floats) to x, y and z registers and back, lane i is vec3 i
+	GLM_FUNC_QUALIFIER void batch_deinterleave8(float const * p, __m256 & x, __m256 & y, __m256 & z)
+	{
+		__m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 12), 1);
+		__m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+		__m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+		__m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+		__m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+		x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+		y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+		z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+	}
+
+	GLM_FUNC_QUALIFIER void batch_interleave8(__m256 x, __m256 y, __m256 z, float * p)
+	{
+		__m256 xy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+		__m256 yz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+		__m256 zx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+		__m256 r03 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+		__m256 r14 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+		__m256 r25 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+		_mm_storeu_ps(p, _mm256_castps256_ps128(r03));
+		_mm_storeu_ps(p + 4, _mm256_castps256_ps128(r14));
+		_mm_storeu_ps(p + 8, _mm256_castps256_ps128(r25));
+		_mm_storeu_ps(p + 12, _mm256_extractf128_ps(r03, 1));
+		_mm_storeu_ps(p + 16, _mm256_extractf128_ps(r14, 1));
+		_mm_storeu_ps(p + 20, _mm256_extractf128_ps(r25, 1));
+	}
+#	endif
+}//namespace detail
+}//namespace glm
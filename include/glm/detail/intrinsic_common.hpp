@@ -34,6 +34,13 @@
 #	error "SSE2 instructions not supported or enabled"
 #else
 
+// FMA3 shipped with AVX2. Visual C++ uses it under /arch:AVX2 but does not define __FMA__
+#if (GLM_ARCH & GLM_ARCH_AVX2) && (defined(__FMA__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_HAS_FMA 1
+#else
+#	define GLM_HAS_FMA 0
+#endif
+
 namespace glm{
 namespace detail
 {
@@ -71,6 +78,12 @@ namespace detail
 
 	__m128 sse_mix_ps(__m128 v1, __m128 v2, __m128 a);
 
+	//a * b + c, rounded once when GLM_HAS_FMA
+	__m128 sse_fma_ps(__m128 a, __m128 b, __m128 c);
+
+	//c - a * b, rounded once when GLM_HAS_FMA
+	__m128 sse_fnma_ps(__m128 a, __m128 b, __m128 c);
+
 	__m128 sse_stp_ps(__m128 edge, __m128 x);
 
 	__m128 sse_ssp_ps(__m128 edge0, __m128 edge1, __m128 x);
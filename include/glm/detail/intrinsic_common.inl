@@ -261,6 +261,24 @@ GLM_FUNC_QUALIFIER __m128 sse_mix_ps(__m128 v1, __m128 v2, __m128 a)
 	return add0;
 }
 
+GLM_FUNC_QUALIFIER __m128 sse_fma_ps(__m128 a, __m128 b, __m128 c)
+{
+#	if GLM_HAS_FMA
+		return _mm_fmadd_ps(a, b, c);
+#	else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER __m128 sse_fnma_ps(__m128 a, __m128 b, __m128 c)
+{
+#	if GLM_HAS_FMA
+		return _mm_fnmadd_ps(a, b, c);
+#	else
+		return _mm_sub_ps(c, _mm_mul_ps(a, b));
+#	endif
+}
+
 GLM_FUNC_QUALIFIER __m128 sse_stp_ps(__m128 edge, __m128 x)
 {
 	__m128 cmp = _mm_cmple_ps(x, edge);
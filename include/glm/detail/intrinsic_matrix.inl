@@ -73,16 +73,23 @@ GLM_FUNC_QUALIFIER __m128 sse_mul_ps(__m128 const m[4], __m128 v)
 	__m128 v2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
 	__m128 v3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
 
-	__m128 m0 = _mm_mul_ps(m[0], v0);
-	__m128 m1 = _mm_mul_ps(m[1], v1);
-	__m128 m2 = _mm_mul_ps(m[2], v2);
-	__m128 m3 = _mm_mul_ps(m[3], v3);
+#	if GLM_HAS_FMA
+		__m128 m3 = _mm_mul_ps(m[3], v3);
+		__m128 f2 = _mm_fmadd_ps(m[2], v2, m3);
+		__m128 f1 = _mm_fmadd_ps(m[1], v1, f2);
+		return _mm_fmadd_ps(m[0], v0, f1);
+#	else
+		__m128 m0 = _mm_mul_ps(m[0], v0);
+		__m128 m1 = _mm_mul_ps(m[1], v1);
+		__m128 m2 = _mm_mul_ps(m[2], v2);
+		__m128 m3 = _mm_mul_ps(m[3], v3);
 
-	__m128 a0 = _mm_add_ps(m0, m1);
-	__m128 a1 = _mm_add_ps(m2, m3);
-	__m128 a2 = _mm_add_ps(a0, a1);
+		__m128 a0 = _mm_add_ps(m0, m1);
+		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a2 = _mm_add_ps(a0, a1);
 
-	return a2;
+		return a2;
+#	endif
 }
 
 GLM_FUNC_QUALIFIER __m128 sse_mul_ps(__m128 v, __m128 const m[4])
@@ -114,78 +121,45 @@ GLM_FUNC_QUALIFIER __m128 sse_mul_ps(__m128 v, __m128 const m[4])
 
 GLM_FUNC_QUALIFIER void sse_mul_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4])
 {
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[0] = a2;
-	}
-
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[1] = a2;
-	}
-
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[2] = a2;
-	}
-
-	{
-		//(__m128&)_mm_shuffle_epi32(__m128i&)in2[0], _MM_SHUFFLE(3, 3, 3, 3))
-		__m128 e0 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[3] = a2;
-	}
+	// Every input is read before out is written, out may be in1 or in2
+#	if GLM_ARCH & GLM_ARCH_AVX
+		// Two columns of the result per 256 bits register: the columns of in1
+		// in both halves, the elements of two columns of in2 broadcast in theirs
+		__m256 const c0 = _mm256_broadcast_ps(&in1[0]);
+		__m256 const c1 = _mm256_broadcast_ps(&in1[1]);
+		__m256 const c2 = _mm256_broadcast_ps(&in1[2]);
+		__m256 const c3 = _mm256_broadcast_ps(&in1[3]);
+		__m256 const e01 = _mm256_insertf128_ps(_mm256_castps128_ps256(in2[0]), in2[1], 1);
+		__m256 const e23 = _mm256_insertf128_ps(_mm256_castps128_ps256(in2[2]), in2[3], 1);
+
+		__m256 r[2];
+		for(int i = 0; i < 2; ++i)
+		{
+			__m256 const e = i == 0 ? e01 : e23;
+#			if GLM_HAS_FMA
+				__m256 f3 = _mm256_mul_ps(c3, _mm256_permute_ps(e, _MM_SHUFFLE(3, 3, 3, 3)));
+				__m256 f2 = _mm256_fmadd_ps(c2, _mm256_permute_ps(e, _MM_SHUFFLE(2, 2, 2, 2)), f3);
+				__m256 f1 = _mm256_fmadd_ps(c1, _mm256_permute_ps(e, _MM_SHUFFLE(1, 1, 1, 1)), f2);
+				r[i] = _mm256_fmadd_ps(c0, _mm256_permute_ps(e, _MM_SHUFFLE(0, 0, 0, 0)), f1);
+#			else
+				__m256 m0 = _mm256_mul_ps(c0, _mm256_permute_ps(e, _MM_SHUFFLE(0, 0, 0, 0)));
+				__m256 m1 = _mm256_mul_ps(c1, _mm256_permute_ps(e, _MM_SHUFFLE(1, 1, 1, 1)));
+				__m256 m2 = _mm256_mul_ps(c2, _mm256_permute_ps(e, _MM_SHUFFLE(2, 2, 2, 2)));
+				__m256 m3 = _mm256_mul_ps(c3, _mm256_permute_ps(e, _MM_SHUFFLE(3, 3, 3, 3)));
+				r[i] = _mm256_add_ps(_mm256_add_ps(m0, m1), _mm256_add_ps(m2, m3));
+#			endif
+		}
+
+		out[0] = _mm256_castps256_ps128(r[0]);
+		out[1] = _mm256_extractf128_ps(r[0], 1);
+		out[2] = _mm256_castps256_ps128(r[1]);
+		out[3] = _mm256_extractf128_ps(r[1], 1);
+#	else
+		__m128 const a[4] = {in1[0], in1[1], in1[2], in1[3]};
+		__m128 const b[4] = {in2[0], in2[1], in2[2], in2[3]};
+		for(int i = 0; i < 4; ++i)
+			out[i] = sse_mul_ps(a, b[i]);
+#	endif
 }
 
 GLM_FUNC_QUALIFIER void sse_transpose_ps(__m128 const in[4], __m128 out[4])
@@ -565,8 +539,7 @@ GLM_FUNC_QUALIFIER void sse_inverse_ps(__m128 const in[4], __m128 out[4])
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac0 = _mm_sub_ps(Mul00, Mul01);
+		Fac0 = sse_fnma_ps(Swp02, Swp03, Mul00);
 	}
 
 	__m128 Fac1;
@@ -585,8 +558,7 @@ GLM_FUNC_QUALIFIER void sse_inverse_ps(__m128 const in[4], __m128 out[4])
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac1 = _mm_sub_ps(Mul00, Mul01);
+		Fac1 = sse_fnma_ps(Swp02, Swp03, Mul00);
 	}
 
 
@@ -606,8 +578,7 @@ GLM_FUNC_QUALIFIER void sse_inverse_ps(__m128 const in[4], __m128 out[4])
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
 
 		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac2 = _mm_sub_ps(Mul00, Mul01);
+		Fac2 = sse_fnma_ps(Swp02, Swp03, Mul00);
     }
 
 	__m128 Fac3;
@@ -626,8 +597,7 @@ GLM_FUNC_QUALIFIER void sse_inverse_ps(__m128 const in[4], __m128 out[4])
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(3, 3, 3, 3));
 
 		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac3 = _mm_sub_ps(Mul00, Mul01);
+		Fac3 = sse_fnma_ps(Swp02, Swp03, Mul00);
 	}
 
 	__m128 Fac4;
@@ -646,8 +616,7 @@ GLM_FUNC_QUALIFIER void sse_inverse_ps(__m128 const in[4], __m128 out[4])
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(2, 2, 2, 2));
 
 		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac4 = _mm_sub_ps(Mul00, Mul01);
+		Fac4 = sse_fnma_ps(Swp02, Swp03, Mul00);
 	}
 
 	__m128 Fac5;
@@ -666,8 +635,7 @@ GLM_FUNC_QUALIFIER void sse_inverse_ps(__m128 const in[4], __m128 out[4])
 		__m128 Swp03 = _mm_shuffle_ps(in[2], in[1], _MM_SHUFFLE(1, 1, 1, 1));
 
 		__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-		__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-		Fac5 = _mm_sub_ps(Mul00, Mul01);
+		Fac5 = sse_fnma_ps(Swp02, Swp03, Mul00);
 	}
 
 	__m128 SignA = _mm_set_ps( 1.0f,-1.0f, 1.0f,-1.0f);
@@ -707,10 +675,8 @@ GLM_FUNC_QUALIFIER void sse_inverse_ps(__m128 const in[4], __m128 out[4])
 	// + (Vec1[2] * Fac0[2] - Vec2[2] * Fac1[2] + Vec3[2] * Fac2[2]),
 	// - (Vec1[3] * Fac0[3] - Vec2[3] * Fac1[3] + Vec3[3] * Fac2[3]),
 	__m128 Mul00 = _mm_mul_ps(Vec1, Fac0);
-	__m128 Mul01 = _mm_mul_ps(Vec2, Fac1);
-	__m128 Mul02 = _mm_mul_ps(Vec3, Fac2);
-	__m128 Sub00 = _mm_sub_ps(Mul00, Mul01);
-	__m128 Add00 = _mm_add_ps(Sub00, Mul02);
+	__m128 Sub00 = sse_fnma_ps(Vec2, Fac1, Mul00);
+	__m128 Add00 = sse_fma_ps(Vec3, Fac2, Sub00);
 	__m128 Inv0 = _mm_mul_ps(SignB, Add00);
 
 	// col1
@@ -719,10 +685,8 @@ GLM_FUNC_QUALIFIER void sse_inverse_ps(__m128 const in[4], __m128 out[4])
 	// - (Vec0[0] * Fac0[2] - Vec2[2] * Fac3[2] + Vec3[2] * Fac4[2]),
 	// + (Vec0[0] * Fac0[3] - Vec2[3] * Fac3[3] + Vec3[3] * Fac4[3]),
 	__m128 Mul03 = _mm_mul_ps(Vec0, Fac0);
-	__m128 Mul04 = _mm_mul_ps(Vec2, Fac3);
-	__m128 Mul05 = _mm_mul_ps(Vec3, Fac4);
-	__m128 Sub01 = _mm_sub_ps(Mul03, Mul04);
-	__m128 Add01 = _mm_add_ps(Sub01, Mul05);
+	__m128 Sub01 = sse_fnma_ps(Vec2, Fac3, Mul03);
+	__m128 Add01 = sse_fma_ps(Vec3, Fac4, Sub01);
 	__m128 Inv1 = _mm_mul_ps(SignA, Add01);
 
 	// col2
@@ -731,10 +695,8 @@ GLM_FUNC_QUALIFIER void sse_inverse_ps(__m128 const in[4], __m128 out[4])
 	// + (Vec0[0] * Fac1[2] - Vec1[2] * Fac3[2] + Vec3[2] * Fac5[2]),
 	// - (Vec0[0] * Fac1[3] - Vec1[3] * Fac3[3] + Vec3[3] * Fac5[3]),
 	__m128 Mul06 = _mm_mul_ps(Vec0, Fac1);
-	__m128 Mul07 = _mm_mul_ps(Vec1, Fac3);
-	__m128 Mul08 = _mm_mul_ps(Vec3, Fac5);
-	__m128 Sub02 = _mm_sub_ps(Mul06, Mul07);
-	__m128 Add02 = _mm_add_ps(Sub02, Mul08);
+	__m128 Sub02 = sse_fnma_ps(Vec1, Fac3, Mul06);
+	__m128 Add02 = sse_fma_ps(Vec3, Fac5, Sub02);
 	__m128 Inv2 = _mm_mul_ps(SignB, Add02);
 
 	// col3
@@ -743,10 +705,8 @@ GLM_FUNC_QUALIFIER void sse_inverse_ps(__m128 const in[4], __m128 out[4])
 	// - (Vec1[0] * Fac2[2] - Vec1[2] * Fac4[2] + Vec2[2] * Fac5[2]),
 	// + (Vec1[0] * Fac2[3] - Vec1[3] * Fac4[3] + Vec2[3] * Fac5[3]));
 	__m128 Mul09 = _mm_mul_ps(Vec0, Fac2);
-	__m128 Mul10 = _mm_mul_ps(Vec1, Fac4);
-	__m128 Mul11 = _mm_mul_ps(Vec2, Fac5);
-	__m128 Sub03 = _mm_sub_ps(Mul09, Mul10);
-	__m128 Add03 = _mm_add_ps(Sub03, Mul11);
+	__m128 Sub03 = sse_fnma_ps(Vec1, Fac4, Mul09);
+	__m128 Add03 = sse_fma_ps(Vec2, Fac5, Sub03);
 	__m128 Inv3 = _mm_mul_ps(SignA, Add03);
 
 	__m128 Row0 = _mm_shuffle_ps(Inv0, Inv1, _MM_SHUFFLE(0, 0, 0, 0));
@@ -705,6 +705,17 @@
 #	define GLM_HAS_CONSTEXPR_PARTIAL (GLM_HAS_CONSTEXPR || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC2015)))
 #endif
 
+// N3652, constexpr functions with local variables, loops and assignments
+#if GLM_COMPILER & (GLM_COMPILER_LLVM | GLM_COMPILER_APPLE_CLANG)
+#	define GLM_HAS_CONSTEXPR_CXX14 __has_feature(cxx_relaxed_constexpr)
+#elif GLM_COMPILER & GLM_COMPILER_VC
+#	define GLM_HAS_CONSTEXPR_CXX14 (_MSC_VER >= 1910)
+#elif defined(__cpp_constexpr) && (__cpp_constexpr >= 201304L)
+#	define GLM_HAS_CONSTEXPR_CXX14 1
+#else
+#	define GLM_HAS_CONSTEXPR_CXX14 0
+#endif
+
 // N2672
 #if GLM_COMPILER & (GLM_COMPILER_LLVM | GLM_COMPILER_APPLE_CLANG)
 #	define GLM_HAS_INITIALIZER_LISTS __has_feature(cxx_generalized_initializers)
@@ -943,6 +954,12 @@
 #	define GLM_RELAXED_CONSTEXPR const
 #endif
 
+#if GLM_HAS_CONSTEXPR_CXX14
+#	define GLM_CONSTEXPR_CXX14 constexpr
+#else
+#	define GLM_CONSTEXPR_CXX14
+#endif
+
 #ifdef GLM_FORCE_EXPLICIT_CTOR
 #	define GLM_EXPLICIT explicit
 #else
@@ -67,18 +67,18 @@ namespace glm
 	public:
 		// -- Constructors --
 
-		GLM_FUNC_DECL tmat3x3() GLM_DEFAULT_CTOR;
-		GLM_FUNC_DECL tmat3x3(tmat3x3<T, P> const & m) GLM_DEFAULT;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3() GLM_DEFAULT_CTOR;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3(tmat3x3<T, P> const & m) GLM_DEFAULT;
 		template <precision Q>
-		GLM_FUNC_DECL tmat3x3(tmat3x3<T, Q> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3(tmat3x3<T, Q> const & m);
 
-		GLM_FUNC_DECL explicit tmat3x3(ctor);
-		GLM_FUNC_DECL explicit tmat3x3(T const & s);
-		GLM_FUNC_DECL tmat3x3(
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tmat3x3(ctor);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tmat3x3(T const & s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3(
 			T const & x0, T const & y0, T const & z0,
 			T const & x1, T const & y1, T const & z1,
 			T const & x2, T const & y2, T const & z2);
-		GLM_FUNC_DECL tmat3x3(
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3(
 			col_type const & v0,
 			col_type const & v1,
 			col_type const & v2);
@@ -89,13 +89,13 @@ namespace glm
 			typename X1, typename Y1, typename Z1,
 			typename X2, typename Y2, typename Z2,
 			typename X3, typename Y3, typename Z3>
-		GLM_FUNC_DECL tmat3x3(
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3(
 			X1 const & x1, Y1 const & y1, Z1 const & z1,
 			X2 const & x2, Y2 const & y2, Z2 const & z2,
 			X3 const & x3, Y3 const & y3, Z3 const & z3);
 
 		template <typename V1, typename V2, typename V3>
-		GLM_FUNC_DECL tmat3x3(
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3(
 			tvec3<V1, P> const & v1,
 			tvec3<V2, P> const & v2,
 			tvec3<V3, P> const & v3);
@@ -103,16 +103,16 @@ namespace glm
 		// -- Matrix conversions --
 
 		template <typename U, precision Q>
-		GLM_FUNC_DECL GLM_EXPLICIT tmat3x3(tmat3x3<U, Q> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 GLM_EXPLICIT tmat3x3(tmat3x3<U, Q> const & m);
 
-		GLM_FUNC_DECL explicit tmat3x3(tmat2x2<T, P> const & x);
-		GLM_FUNC_DECL explicit tmat3x3(tmat4x4<T, P> const & x);
-		GLM_FUNC_DECL explicit tmat3x3(tmat2x3<T, P> const & x);
-		GLM_FUNC_DECL explicit tmat3x3(tmat3x2<T, P> const & x);
-		GLM_FUNC_DECL explicit tmat3x3(tmat2x4<T, P> const & x);
-		GLM_FUNC_DECL explicit tmat3x3(tmat4x2<T, P> const & x);
-		GLM_FUNC_DECL explicit tmat3x3(tmat3x4<T, P> const & x);
-		GLM_FUNC_DECL explicit tmat3x3(tmat4x3<T, P> const & x);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tmat3x3(tmat2x2<T, P> const & x);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tmat3x3(tmat4x4<T, P> const & x);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tmat3x3(tmat2x3<T, P> const & x);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tmat3x3(tmat3x2<T, P> const & x);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tmat3x3(tmat2x4<T, P> const & x);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tmat3x3(tmat4x2<T, P> const & x);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tmat3x3(tmat3x4<T, P> const & x);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tmat3x3(tmat4x3<T, P> const & x);
 
 		// -- Accesses --
 
@@ -120,115 +120,115 @@ namespace glm
 			typedef size_t size_type;
 			GLM_FUNC_DECL GLM_CONSTEXPR size_t size() const;
 
-			GLM_FUNC_DECL col_type & operator[](size_type i);
-			GLM_FUNC_DECL col_type const & operator[](size_type i) const;
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 col_type & operator[](size_type i);
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 col_type const & operator[](size_type i) const;
 #		else
 			typedef length_t length_type;
 			GLM_FUNC_DECL GLM_CONSTEXPR length_type length() const;
 
-			GLM_FUNC_DECL col_type & operator[](length_type i);
-			GLM_FUNC_DECL col_type const & operator[](length_type i) const;
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 col_type & operator[](length_type i);
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 col_type const & operator[](length_type i) const;
 #		endif//GLM_FORCE_SIZE_FUNC
 
 		// -- Unary arithmetic operators --
 
-		GLM_FUNC_DECL tmat3x3<T, P> & operator=(tmat3x3<T, P> const & m) GLM_DEFAULT;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator=(tmat3x3<T, P> const & m) GLM_DEFAULT;
 
 		template <typename U>
-		GLM_FUNC_DECL tmat3x3<T, P> & operator=(tmat3x3<U, P> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator=(tmat3x3<U, P> const & m);
 		template <typename U>
-		GLM_FUNC_DECL tmat3x3<T, P> & operator+=(U s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator+=(U s);
 		template <typename U>
-		GLM_FUNC_DECL tmat3x3<T, P> & operator+=(tmat3x3<U, P> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator+=(tmat3x3<U, P> const & m);
 		template <typename U>
-		GLM_FUNC_DECL tmat3x3<T, P> & operator-=(U s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator-=(U s);
 		template <typename U>
-		GLM_FUNC_DECL tmat3x3<T, P> & operator-=(tmat3x3<U, P> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator-=(tmat3x3<U, P> const & m);
 		template <typename U>
-		GLM_FUNC_DECL tmat3x3<T, P> & operator*=(U s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator*=(U s);
 		template <typename U>
-		GLM_FUNC_DECL tmat3x3<T, P> & operator*=(tmat3x3<U, P> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator*=(tmat3x3<U, P> const & m);
 		template <typename U>
-		GLM_FUNC_DECL tmat3x3<T, P> & operator/=(U s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator/=(U s);
 		template <typename U>
-		GLM_FUNC_DECL tmat3x3<T, P> & operator/=(tmat3x3<U, P> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator/=(tmat3x3<U, P> const & m);
 
 		// -- Increment and decrement operators --
 
-		GLM_FUNC_DECL tmat3x3<T, P> & operator++();
-		GLM_FUNC_DECL tmat3x3<T, P> & operator--();
-		GLM_FUNC_DECL tmat3x3<T, P> operator++(int);
-		GLM_FUNC_DECL tmat3x3<T, P> operator--(int);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator++();
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> & operator--();
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator++(int);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator--(int);
 	};
 
 	// -- Unary operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> const operator-(tmat3x3<T, P> const & m);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> const operator-(tmat3x3<T, P> const & m);
 
 	// -- Binary operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator+(tmat3x3<T, P> const & m, T const & s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator+(tmat3x3<T, P> const & m, T const & s);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator+(T const & s, tmat3x3<T, P> const & m);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator+(T const & s, tmat3x3<T, P> const & m);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator+(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator+(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator-(tmat3x3<T, P> const & m, T const & s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator-(tmat3x3<T, P> const & m, T const & s);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator-(T const & s, tmat3x3<T, P> const & m);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator-(T const & s, tmat3x3<T, P> const & m);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator-(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator-(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator*(tmat3x3<T, P> const & m, T const & s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator*(tmat3x3<T, P> const & m, T const & s);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator*(T const & s, tmat3x3<T, P> const & m);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator*(T const & s, tmat3x3<T, P> const & m);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL typename tmat3x3<T, P>::col_type operator*(tmat3x3<T, P> const & m, typename tmat3x3<T, P>::row_type const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 typename tmat3x3<T, P>::col_type operator*(tmat3x3<T, P> const & m, typename tmat3x3<T, P>::row_type const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL typename tmat3x3<T, P>::row_type operator*(typename tmat3x3<T, P>::col_type const & v, tmat3x3<T, P> const & m);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 typename tmat3x3<T, P>::row_type operator*(typename tmat3x3<T, P>::col_type const & v, tmat3x3<T, P> const & m);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator*(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator*(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat2x3<T, P> operator*(tmat3x3<T, P> const & m1, tmat2x3<T, P> const & m2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat2x3<T, P> operator*(tmat3x3<T, P> const & m1, tmat2x3<T, P> const & m2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat4x3<T, P> operator*(tmat3x3<T, P> const & m1, tmat4x3<T, P> const & m2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x3<T, P> operator*(tmat3x3<T, P> const & m1, tmat4x3<T, P> const & m2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator/(tmat3x3<T, P> const & m, T const & s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator/(tmat3x3<T, P> const & m, T const & s);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator/(T const & s, tmat3x3<T, P> const & m);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator/(T const & s, tmat3x3<T, P> const & m);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL typename tmat3x3<T, P>::col_type operator/(tmat3x3<T, P> const & m, typename tmat3x3<T, P>::row_type const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 typename tmat3x3<T, P>::col_type operator/(tmat3x3<T, P> const & m, typename tmat3x3<T, P>::row_type const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL typename tmat3x3<T, P>::row_type operator/(typename tmat3x3<T, P>::col_type const & v, tmat3x3<T, P> const & m);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 typename tmat3x3<T, P>::row_type operator/(typename tmat3x3<T, P>::col_type const & v, tmat3x3<T, P> const & m);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> operator/(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> operator/(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
 
 	// -- Boolean operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL bool operator==(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 bool operator==(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL bool operator!=(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 bool operator!=(tmat3x3<T, P> const & m1, tmat3x3<T, P> const & m2);
 }//namespace glm
 
 #ifndef GLM_EXTERNAL_TEMPLATE
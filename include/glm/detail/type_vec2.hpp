@@ -95,56 +95,56 @@ namespace glm
 			typedef size_t size_type;
 			GLM_FUNC_DECL GLM_CONSTEXPR size_type size() const;
 
-			GLM_FUNC_DECL T & operator[](size_type i);
-			GLM_FUNC_DECL T const & operator[](size_type i) const;
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T & operator[](size_type i);
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T const & operator[](size_type i) const;
 #		else
 			/// Return the count of components of the vector
 			typedef length_t length_type;
 			GLM_FUNC_DECL GLM_CONSTEXPR length_type length() const;
 
-			GLM_FUNC_DECL T & operator[](length_type i);
-			GLM_FUNC_DECL T const & operator[](length_type i) const;
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T & operator[](length_type i);
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T const & operator[](length_type i) const;
 #		endif//GLM_FORCE_SIZE_FUNC
 
 		// -- Implicit basic constructors --
 
-		GLM_FUNC_DECL tvec2() GLM_DEFAULT_CTOR;
-		GLM_FUNC_DECL tvec2(tvec2<T, P> const & v) GLM_DEFAULT;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2() GLM_DEFAULT_CTOR;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2(tvec2<T, P> const & v) GLM_DEFAULT;
 		template <precision Q>
-		GLM_FUNC_DECL tvec2(tvec2<T, Q> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2(tvec2<T, Q> const & v);
 
 		// -- Explicit basic constructors --
 
-		GLM_FUNC_DECL explicit tvec2(ctor);
-		GLM_FUNC_DECL explicit tvec2(T const & scalar);
-		GLM_FUNC_DECL tvec2(T const & s1, T const & s2);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tvec2(ctor);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tvec2(T const & scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2(T const & s1, T const & s2);
 
 		// -- Conversion constructors --
 
 		/// Explicit converions (From section 5.4.1 Conversion and scalar constructors of GLSL 1.30.08 specification)
 		template <typename A, typename B>
-		GLM_FUNC_DECL tvec2(A const & x, B const & y);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2(A const & x, B const & y);
 		template <typename A, typename B>
-		GLM_FUNC_DECL tvec2(tvec1<A, P> const & v1, tvec1<B, P> const & v2);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2(tvec1<A, P> const & v1, tvec1<B, P> const & v2);
 
 		// -- Conversion vector constructors --
 
 		/// Explicit conversions (From section 5.4.1 Conversion and scalar constructors of GLSL 1.30.08 specification)
 		template <typename U, precision Q>
-		GLM_FUNC_DECL explicit tvec2(tvec3<U, Q> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tvec2(tvec3<U, Q> const & v);
 		/// Explicit conversions (From section 5.4.1 Conversion and scalar constructors of GLSL 1.30.08 specification)
 		template <typename U, precision Q>
-		GLM_FUNC_DECL explicit tvec2(tvec4<U, Q> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit tvec2(tvec4<U, Q> const & v);
 
 		/// Explicit conversions (From section 5.4.1 Conversion and scalar constructors of GLSL 1.30.08 specification)
 		template <typename U, precision Q>
-		GLM_FUNC_DECL GLM_EXPLICIT tvec2(tvec2<U, Q> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 GLM_EXPLICIT tvec2(tvec2<U, Q> const & v);
 
 		// -- Swizzle constructors --
 
 #		if GLM_HAS_ANONYMOUS_UNION && defined(GLM_SWIZZLE)
 			template <int E0, int E1>
-			GLM_FUNC_DECL tvec2(detail::_swizzle<2, T, P, tvec2<T, P>, E0, E1,-1,-2> const & that)
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2(detail::_swizzle<2, T, P, tvec2<T, P>, E0, E1,-1,-2> const & that)
 			{
 				*this = that();
 			}
@@ -152,252 +152,252 @@ namespace glm
 
 		// -- Unary arithmetic operators --
 
-		GLM_FUNC_DECL tvec2<T, P>& operator=(tvec2<T, P> const & v) GLM_DEFAULT;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator=(tvec2<T, P> const & v) GLM_DEFAULT;
 
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator=(tvec2<U, P> const & v);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator+=(U scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator+=(U scalar);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator+=(tvec1<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator+=(tvec1<U, P> const & v);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator+=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator+=(tvec2<U, P> const & v);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator-=(U scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator-=(U scalar);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator-=(tvec1<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator-=(tvec1<U, P> const & v);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator-=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator-=(tvec2<U, P> const & v);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator*=(U scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator*=(U scalar);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator*=(tvec1<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator*=(tvec1<U, P> const & v);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator*=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator*=(tvec2<U, P> const & v);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator/=(U scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator/=(U scalar);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator/=(tvec1<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator/=(tvec1<U, P> const & v);
 		template <typename U>
-		GLM_FUNC_DECL tvec2<T, P>& operator/=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P>& operator/=(tvec2<U, P> const & v);
 
 		// -- Increment and decrement operators --
 
-		GLM_FUNC_DECL tvec2<T, P> & operator++();
-		GLM_FUNC_DECL tvec2<T, P> & operator--();
-		GLM_FUNC_DECL tvec2<T, P> operator++(int);
-		GLM_FUNC_DECL tvec2<T, P> operator--(int);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator++();
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator--();
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator++(int);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator--(int);
 
 		// -- Unary bit operators --
 
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator%=(U scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator%=(U scalar);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator%=(tvec1<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator%=(tvec1<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator%=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator%=(tvec2<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator&=(U scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator&=(U scalar);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator&=(tvec1<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator&=(tvec1<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator&=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator&=(tvec2<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator|=(U scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator|=(U scalar);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator|=(tvec1<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator|=(tvec1<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator|=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator|=(tvec2<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator^=(U scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator^=(U scalar);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator^=(tvec1<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator^=(tvec1<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator^=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator^=(tvec2<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator<<=(U scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator<<=(U scalar);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator<<=(tvec1<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator<<=(tvec1<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator<<=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator<<=(tvec2<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator>>=(U scalar);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator>>=(U scalar);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator>>=(tvec1<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator>>=(tvec1<U, P> const & v);
 		template <typename U> 
-		GLM_FUNC_DECL tvec2<T, P> & operator>>=(tvec2<U, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> & operator>>=(tvec2<U, P> const & v);
 	};
 
 	// -- Unary operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator-(tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator-(tvec2<T, P> const & v);
 
 	// -- Binary operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator+(tvec2<T, P> const & v, T const & scalar);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator+(tvec2<T, P> const & v, T const & scalar);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator+(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator+(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator+(T const & scalar, tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator+(T const & scalar, tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator+(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator+(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator+(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator+(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator-(tvec2<T, P> const & v, T const & scalar);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator-(tvec2<T, P> const & v, T const & scalar);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator-(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator-(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator-(T const & scalar, tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator-(T const & scalar, tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator-(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator-(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator-(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator-(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator*(tvec2<T, P> const & v, T const & scalar);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator*(tvec2<T, P> const & v, T const & scalar);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator*(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator*(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator*(T const & scalar, tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator*(T const & scalar, tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator*(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator*(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator*(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator*(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator/(tvec2<T, P> const & v, T const & scalar);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator/(tvec2<T, P> const & v, T const & scalar);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator/(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator/(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator/(T const & scalar, tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator/(T const & scalar, tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator/(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator/(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator/(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator/(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator-(tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator-(tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator%(tvec2<T, P> const & v, T const & scalar);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator%(tvec2<T, P> const & v, T const & scalar);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator%(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator%(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator%(T const & scalar, tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator%(T const & scalar, tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator%(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator%(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator%(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator%(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator&(tvec2<T, P> const & v, T const & scalar);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator&(tvec2<T, P> const & v, T const & scalar);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator&(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator&(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator&(T const & scalar, tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator&(T const & scalar, tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator&(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator&(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator&(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator&(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator|(tvec2<T, P> const & v, T const & scalar);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator|(tvec2<T, P> const & v, T const & scalar);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator|(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator|(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator|(T const & scalar, tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator|(T const & scalar, tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator|(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator|(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator|(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator|(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator^(tvec2<T, P> const & v, T const & scalar);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator^(tvec2<T, P> const & v, T const & scalar);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator^(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator^(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator^(T const & scalar, tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator^(T const & scalar, tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator^(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator^(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator^(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator^(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator<<(tvec2<T, P> const & v, T const & scalar);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator<<(tvec2<T, P> const & v, T const & scalar);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator<<(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator<<(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator<<(T const & scalar, tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator<<(T const & scalar, tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator<<(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator<<(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator<<(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator<<(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator>>(tvec2<T, P> const & v, T const & scalar);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator>>(tvec2<T, P> const & v, T const & scalar);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator>>(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator>>(tvec2<T, P> const & v1, tvec1<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator>>(T const & scalar, tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator>>(T const & scalar, tvec2<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator>>(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator>>(tvec1<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator>>(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator>>(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec2<T, P> operator~(tvec2<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec2<T, P> operator~(tvec2<T, P> const & v);
 
 	// -- Boolean operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL bool operator==(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 bool operator==(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL bool operator!=(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 bool operator!=(tvec2<T, P> const & v1, tvec2<T, P> const & v2);
 }//namespace glm
 
 #ifndef GLM_EXTERNAL_TEMPLATE
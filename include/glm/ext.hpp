@@ -81,6 +81,11 @@
 #include "./gtc/vec1.hpp"
 
 #include "./gtx/associated_min_max.hpp"
+#include "./gtx/batch_half.hpp"
+#include "./gtx/batch_noise.hpp"
+#include "./gtx/batch_packing.hpp"
+#include "./gtx/batch_quat.hpp"
+#include "./gtx/batch_transform.hpp"
 #include "./gtx/bit.hpp"
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_space.hpp"
@@ -127,6 +132,7 @@
 #include "./gtx/type_aligned.hpp"
 #include "./gtx/vector_angle.hpp"
 #include "./gtx/vector_query.hpp"
+#include "./gtx/wide.hpp"
 #include "./gtx/wrap.hpp"
 
 #if GLM_HAS_TEMPLATE_ALIASES
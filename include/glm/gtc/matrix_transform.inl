@@ -37,7 +37,7 @@
 namespace glm
 {
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> translate
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> translate
 	(
 		tmat4x4<T, P> const & m,
 		tvec3<T, P> const & v
@@ -119,7 +119,7 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> scale
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> scale
 	(
 		tmat4x4<T, P> const & m,
 		tvec3<T, P> const & v
@@ -148,7 +148,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> ortho
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho
 	(
 		T left,
 		T right,
@@ -169,7 +169,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> ortho
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho
 	(
 		T left,
 		T right,
@@ -187,7 +187,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> frustum
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustum
 	(
 		T left,
 		T right,
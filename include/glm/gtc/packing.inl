@@ -141,14 +141,19 @@ namespace detail
 		return ((h & 0x8000) << 16) | ((( h & 0x7c00) + 0x1C000) << 13) | ((h & 0x03FF) << 13);
 	}
 
+	// Unsigned 11 bits float of x: 5 bits of exponent biased by 15, 6 bits of
+	// significand truncated. Negative values give zero, values from 65536 infinity
+	// and values under 2^-14 denormals
 	GLM_FUNC_QUALIFIER glm::uint floatTo11bit(float x)
 	{
-		if(x == 0.0f)
-			return 0u;
-		else if(glm::isnan(x))
+		if(glm::isnan(x))
 			return ~0u;
-		else if(glm::isinf(x))
+		else if(!(x > 0.0f))
+			return 0u;
+		else if(x >= 65536.0f)
 			return 0x1Fu << 6u;
+		else if(x < 6.103515625e-05f) // 2^-14
+			return uint(x * 1048576.0f); // 2^20, 64 steps per 2^-14
 
 #		if(GLM_COMPILER & GLM_COMPILER_GCC || GLM_COMPILER & (GLM_COMPILER_APPLE_CLANG | GLM_COMPILER_LLVM))
 			uint Pack = 0u;
@@ -160,16 +165,17 @@ namespace detail
 		return float2packed11(Pack);
 	}
 
+	// Float of the low 11 bits of x
 	GLM_FUNC_QUALIFIER float packed11bitToFloat(glm::uint x)
 	{
-		if(x == 0)
-			return 0.0f;
-		else if(x == ((1 << 11) - 1))
-			return ~0;//NaN
-		else if(x == (0x1f << 6))
-			return ~0;//Inf
-
-		uint Result = packed11ToFloat(x);
+		x &= (1 << 11) - 1;
+		uint Result = 0;
+		if((x >> 6) == 0)
+			return float(x) * 9.5367431640625e-07f; // 2^-20, denormal
+		else if((x >> 6) == 0x1f)
+			Result = 0x7f800000 | ((x & 0x003f) << 17); // Inf or NaN
+		else
+			Result = packed11ToFloat(x);
 
 #		if(GLM_COMPILER & GLM_COMPILER_GCC || GLM_COMPILER & (GLM_COMPILER_APPLE_CLANG | GLM_COMPILER_LLVM))
 			float Temp = 0;
@@ -180,14 +186,17 @@ namespace detail
 #		endif
 	}
 
+	// Unsigned 10 bits float of x: 5 bits of exponent, 5 bits of significand
 	GLM_FUNC_QUALIFIER glm::uint floatTo10bit(float x)
 	{
-		if(x == 0.0f)
-			return 0u;
-		else if(glm::isnan(x))
+		if(glm::isnan(x))
 			return ~0u;
-		else if(glm::isinf(x))
+		else if(!(x > 0.0f))
+			return 0u;
+		else if(x >= 65536.0f)
 			return 0x1Fu << 5u;
+		else if(x < 6.103515625e-05f) // 2^-14
+			return uint(x * 524288.0f); // 2^19, 32 steps per 2^-14
 
 #		if(GLM_COMPILER & GLM_COMPILER_GCC || GLM_COMPILER & (GLM_COMPILER_APPLE_CLANG | GLM_COMPILER_LLVM))
 			uint Pack = 0;
@@ -199,16 +208,17 @@ namespace detail
 		return float2packed10(Pack);
 	}
 
+	// Float of the low 10 bits of x
 	GLM_FUNC_QUALIFIER float packed10bitToFloat(glm::uint x)
 	{
-		if(x == 0)
-			return 0.0f;
-		else if(x == ((1 << 10) - 1))
-			return ~0;//NaN
-		else if(x == (0x1f << 5))
-			return ~0;//Inf
-
-		uint Result = packed10ToFloat(x);
+		x &= (1 << 10) - 1;
+		uint Result = 0;
+		if((x >> 5) == 0)
+			return float(x) * 1.9073486328125e-06f; // 2^-19, denormal
+		else if((x >> 5) == 0x1f)
+			Result = 0x7f800000 | ((x & 0x001f) << 18); // Inf or NaN
+		else
+			Result = packed10ToFloat(x);
 
 #		if(GLM_COMPILER & GLM_COMPILER_GCC || GLM_COMPILER & (GLM_COMPILER_APPLE_CLANG | GLM_COMPILER_LLVM))
 			float Temp = 0;
@@ -451,17 +461,17 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint32 packUnorm3x10_1x2(vec4 const & v)
 	{
-		detail::i10i10i10i2 Result;
-		Result.data.x = int(round(clamp(v.x, 0.0f, 1.0f) * 1023.f));
-		Result.data.y = int(round(clamp(v.y, 0.0f, 1.0f) * 1023.f));
-		Result.data.z = int(round(clamp(v.z, 0.0f, 1.0f) * 1023.f));
-		Result.data.w = int(round(clamp(v.w, 0.0f, 1.0f) *    3.f));
+		detail::u10u10u10u2 Result;
+		Result.data.x = uint(round(clamp(v.x, 0.0f, 1.0f) * 1023.f));
+		Result.data.y = uint(round(clamp(v.y, 0.0f, 1.0f) * 1023.f));
+		Result.data.z = uint(round(clamp(v.z, 0.0f, 1.0f) * 1023.f));
+		Result.data.w = uint(round(clamp(v.w, 0.0f, 1.0f) *    3.f));
 		return Result.pack;
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackUnorm3x10_1x2(uint32 v)
 	{
-		detail::i10i10i10i2 Unpack;
+		detail::u10u10u10u2 Unpack;
 		Unpack.pack = v;
 		vec4 Result;
 		Result.x = float(Unpack.data.x) / 1023.f;
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_half
+/// @file glm/gtx/batch_half.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_batch_half GLM_GTX_batch_half
+/// @ingroup gtx
+/// 
+/// @brief Convert arrays of floats to half floats and back.
+/// 
+/// Vertex streams and HDR images, millions of values at a time. When
+/// GLM_BATCH_ARCH is GLM_BATCH_AVX2 eight values go through one F16C
+/// instruction (every AVX2 CPU has F16C, GCC and Clang also need -mf16c),
+/// otherwise each value takes two small table lookups indexed by its exponent.
+/// Both round to nearest even and give the same bits, F16C's: halves of NaNs
+/// are quiet NaNs keeping the high bits of the payload, and floats of
+/// signaling NaN halves are quiet. detail::toFloat16 (packHalf1x16) rounds
+/// ties away from zero instead, so a value exactly between two halves may
+/// differ from it by one. unpackHalfs matches unpackHalf1x16 except for the
+/// quiet bit of signaling NaNs.
+/// Outputs of at least GLM_BATCH_STREAM_BYTES (4 MB unless defined before
+/// including this header) are written with streaming stores, which skip the
+/// cache: the result of such a conversion is seldom read again before it
+/// leaves the cache, while the input is.
+/// 
+/// <glm/gtx/batch_half.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependencies
+#include "../detail/setup.hpp"
+#include "../detail/type_int.hpp"
+#include "../detail/batch_simd.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_batch_half extension included")
+#endif
+
+// /arch:AVX2 lets Visual C++ use F16C but does not define __F16C__, GCC and Clang need -mf16c
+#if GLM_BATCH_ARCH == GLM_BATCH_AVX2 && (defined(__F16C__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_BATCH_F16C 1
+#else
+#	define GLM_BATCH_F16C 0
+#endif
+
+#ifndef GLM_BATCH_STREAM_BYTES
+#	define GLM_BATCH_STREAM_BYTES (4 << 20)
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_half
+	/// @{
+
+	/// Name of the conversion compiled in: "F16C" or "table".
+	/// @see gtx_batch_half
+	GLM_FUNC_DECL char const * batchHalfArch();
+
+	/// out[i] = packHalf1x16(in[i]), rounded to nearest even.
+	/// in and out must not overlap.
+	/// @see gtx_batch_half
+	GLM_FUNC_DECL void packHalfs(
+		float const * in,
+		uint16 * out,
+		std::size_t count);
+
+	/// out[i] = unpackHalf1x16(in[i]).
+	/// in and out must not overlap.
+	/// @see gtx_batch_half
+	GLM_FUNC_DECL void unpackHalfs(
+		uint16 const * in,
+		float * out,
+		std::size_t count);
+
+	/// @}
+}// namespace glm
+
+#include "batch_half.inl"
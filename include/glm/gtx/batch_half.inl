@@ -0,0 +1,221 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_half
+/// @file glm/gtx/batch_half.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	/* Half of one float, rounded to nearest even. The float exponent gives the
+	half exponent already in place (base) and how far the significand, with
+	its implicit bit, moves down (shift): 13 for normal halves, more for
+	denormal ones and 25, which leaves nothing, below them and above 65504.
+	A carry of the rounding goes on into the exponent, up to infinity */
+	GLM_FUNC_QUALIFIER uint16 batch_pack_half(float value)
+	{
+		static uint16 const Base[256] = {
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0400, 0x0800, 0x0c00, 0x1000, 0x1400, 0x1800, 0x1c00, 0x2000, 0x2400, 0x2800, 0x2c00, 0x3000, 0x3400, 0x3800,
+			0x3c00, 0x4000, 0x4400, 0x4800, 0x4c00, 0x5000, 0x5400, 0x5800, 0x5c00, 0x6000, 0x6400, 0x6800, 0x6c00, 0x7000, 0x7400, 0x7c00,
+			0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00,
+			0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00,
+			0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00,
+			0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00,
+			0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00,
+			0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00,
+			0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00, 0x7c00
+		};
+		static uint8 const Shift[256] = {
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15,
+			14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+			13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+			25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25
+		};
+
+		uint32 Bits;
+		std::memcpy(&Bits, &value, sizeof(Bits));
+		uint32 const Sign = (Bits >> 16) & 0x8000;
+		uint32 const Exponent = (Bits >> 23) & 0xff;
+		uint32 const Significand = Bits & 0x007fffff;
+		if(Exponent == 0xff && Significand != 0)
+			return uint16(Sign | 0x7e00 | (Significand >> 13));
+		uint32 const Mantissa = Significand | 0x00800000;
+		uint32 const S = Shift[Exponent];
+		uint32 const Rounded = (Mantissa + (1u << (S - 1)) - 1 + ((Mantissa >> S) & 1)) >> S;
+		return uint16(Sign | (Base[Exponent] + Rounded));
+	}
+
+	/* Float of one half: the half bits moved up, plus the exponent bias. Denormal
+	halves are made normal with an implicit bit worth 2^-14, then taken away by
+	the subtraction, which also makes signaling NaNs quiet */
+	GLM_FUNC_QUALIFIER float batch_unpack_half(uint16 value)
+	{
+		static uint32 const Exponent[32] = {
+			0x38800000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000,
+			0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000,
+			0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000,
+			0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x38000000, 0x70000000
+		};
+		static float const Implicit[32] = {
+			6.103515625e-05f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f
+		};
+
+		uint32 const Index = (value >> 10) & 0x1f;
+		uint32 Bits = (uint32(value & 0x7fff) << 13) + Exponent[Index];
+		float Magnitude;
+		std::memcpy(&Magnitude, &Bits, sizeof(Bits));
+		Magnitude -= Implicit[Index];
+		std::memcpy(&Bits, &Magnitude, sizeof(Bits));
+		Bits |= uint32(value & 0x8000) << 16;
+		float Result;
+		std::memcpy(&Result, &Bits, sizeof(Bits));
+		return Result;
+	}
+
+	// Elements to convert one by one before out reaches the alignment of a streaming store
+	GLM_FUNC_QUALIFIER std::size_t batch_stream_head(void const * out, std::size_t alignment, std::size_t size, std::size_t count)
+	{
+		std::size_t const Misalignment = reinterpret_cast<std::size_t>(out) & (alignment - 1);
+		std::size_t const Head = Misalignment == 0 ? 0 : (alignment - Misalignment) / size;
+		return Head < count ? Head : count;
+	}
+
+	GLM_FUNC_QUALIFIER bool batch_stream(std::size_t count, std::size_t size)
+	{
+		return count >= std::size_t(GLM_BATCH_STREAM_BYTES) / size;
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER char const * batchHalfArch()
+	{
+#		if GLM_BATCH_F16C
+			return "F16C";
+#		else
+			return "table";
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void packHalfs(float const * in, uint16 * out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_BATCH_F16C
+			if(detail::batch_stream(count, sizeof(uint16)))
+			{
+				// Whole 16 bytes lines, eight halves each
+				for(std::size_t Head = detail::batch_stream_head(out, 16, sizeof(uint16), count); i < Head; ++i)
+					out[i] = uint16(_mm_extract_epi16(_mm_cvtps_ph(_mm_set_ss(in[i]), _MM_FROUND_TO_NEAREST_INT), 0));
+				for(; i + 8 <= count; i += 8)
+					_mm_stream_si128(reinterpret_cast<__m128i *>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+				_mm_sfence();
+			}
+			for(; i + 8 <= count; i += 8)
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+			for(; i < count; ++i)
+				out[i] = uint16(_mm_extract_epi16(_mm_cvtps_ph(_mm_set_ss(in[i]), _MM_FROUND_TO_NEAREST_INT), 0));
+#		else
+#			if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+				if(detail::batch_stream(count, sizeof(uint16)))
+				{
+					for(std::size_t Head = detail::batch_stream_head(out, 16, sizeof(uint16), count); i < Head; ++i)
+						out[i] = detail::batch_pack_half(in[i]);
+					for(; i + 8 <= count; i += 8)
+					{
+						float const * p = in + i;
+						_mm_stream_si128(reinterpret_cast<__m128i *>(out + i), _mm_setr_epi16(
+							short(detail::batch_pack_half(p[0])), short(detail::batch_pack_half(p[1])),
+							short(detail::batch_pack_half(p[2])), short(detail::batch_pack_half(p[3])),
+							short(detail::batch_pack_half(p[4])), short(detail::batch_pack_half(p[5])),
+							short(detail::batch_pack_half(p[6])), short(detail::batch_pack_half(p[7]))));
+					}
+					_mm_sfence();
+				}
+#			endif
+			for(; i < count; ++i)
+				out[i] = detail::batch_pack_half(in[i]);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalfs(uint16 const * in, float * out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_BATCH_F16C
+			if(detail::batch_stream(count, sizeof(float)))
+			{
+				// Whole 32 bytes lines, eight floats each
+				for(std::size_t Head = detail::batch_stream_head(out, 32, sizeof(float), count); i < Head; ++i)
+					out[i] = _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(in[i])));
+				for(; i + 8 <= count; i += 8)
+					_mm256_stream_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i))));
+				_mm_sfence();
+			}
+			for(; i + 8 <= count; i += 8)
+				_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i))));
+			for(; i < count; ++i)
+				out[i] = _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(in[i])));
+#		else
+#			if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+				if(detail::batch_stream(count, sizeof(float)))
+				{
+					for(std::size_t Head = detail::batch_stream_head(out, 16, sizeof(float), count); i < Head; ++i)
+						out[i] = detail::batch_unpack_half(in[i]);
+					for(; i + 4 <= count; i += 4)
+						_mm_stream_ps(out + i, _mm_setr_ps(
+							detail::batch_unpack_half(in[i + 0]), detail::batch_unpack_half(in[i + 1]),
+							detail::batch_unpack_half(in[i + 2]), detail::batch_unpack_half(in[i + 3])));
+					_mm_sfence();
+				}
+#			endif
+			for(; i < count; ++i)
+				out[i] = detail::batch_unpack_half(in[i]);
+#		endif
+	}
+}//namespace glm
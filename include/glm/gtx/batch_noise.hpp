@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_noise
+/// @file glm/gtx/batch_noise.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+/// @see gtx_wide (dependence)
+///
+/// @defgroup gtx_batch_noise GLM_GTX_batch_noise
+/// @ingroup gtx
+/// 
+/// @brief Perlin and simplex noise of eight points at once, of arrays of
+/// points and of fractal rows of a grid.
+/// 
+/// The GLM_GTC_noise formulas run on GLM_GTX_wide registers in the same order
+/// of operations, so the results match perlin and simplex up to rounding:
+/// within 1e-5 with GLM_BATCH_AVX2 which fuses some multiply adds, closer
+/// otherwise. The instruction set follows GLM_BATCH_ARCH like GLM_GTX_wide.
+/// The periodic perlin variants have no batch version.
+/// perlinRow and simplexRow sum octaves of noise along a row of a 2D, 3D or
+/// 4D grid: call them once per row (a heightmap) or per row of every slice
+/// (a 3D texture). Rows only depend on their own arguments, so a grid is split
+/// over threads by rows.
+/// 
+/// <glm/gtx/batch_noise.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependencies
+#include "../vec2.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include "../gtc/noise.hpp"
+#include "../gtx/wide.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_batch_noise extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_noise
+	/// @{
+
+	/// Lane i is perlin(vec2(x[i], y[i])).
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL floatx8 perlin(floatx8 const & x, floatx8 const & y);
+	/// Lane i is perlin(lane(p, i)).
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL floatx8 perlin(vec3x8 const & p);
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL floatx8 perlin(vec4x8 const & p);
+
+	/// Lane i is simplex(vec2(x[i], y[i])).
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL floatx8 simplex(floatx8 const & x, floatx8 const & y);
+	/// Lane i is simplex(lane(p, i)).
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL floatx8 simplex(vec3x8 const & p);
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL floatx8 simplex(vec4x8 const & p);
+
+	/// out[i] = perlin(in[i]).
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void perlinNoise(vec2 const * in, float * out, std::size_t count);
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void perlinNoise(vec3 const * in, float * out, std::size_t count);
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void perlinNoise(vec4 const * in, float * out, std::size_t count);
+
+	/// out[i] = simplex(in[i]).
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void simplexNoise(vec2 const * in, float * out, std::size_t count);
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void simplexNoise(vec3 const * in, float * out, std::size_t count);
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void simplexNoise(vec4 const * in, float * out, std::size_t count);
+
+	/// Fractal Perlin noise along x: out[i] is the sum over the octaves of
+	/// Amplitude * perlin(p * Frequency), p = origin with p.x = origin.x + float(i) * step.
+	/// Frequency and Amplitude start at 1 and are multiplied by lacunarity and
+	/// gain after each octave. Exact for count up to 2^24.
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void perlinRow(
+		vec2 const & origin,
+		float step,
+		std::size_t count,
+		int octaves,
+		float lacunarity,
+		float gain,
+		float * out);
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void perlinRow(
+		vec3 const & origin,
+		float step,
+		std::size_t count,
+		int octaves,
+		float lacunarity,
+		float gain,
+		float * out);
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void perlinRow(
+		vec4 const & origin,
+		float step,
+		std::size_t count,
+		int octaves,
+		float lacunarity,
+		float gain,
+		float * out);
+
+	/// Same with simplex noise.
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void simplexRow(
+		vec2 const & origin,
+		float step,
+		std::size_t count,
+		int octaves,
+		float lacunarity,
+		float gain,
+		float * out);
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void simplexRow(
+		vec3 const & origin,
+		float step,
+		std::size_t count,
+		int octaves,
+		float lacunarity,
+		float gain,
+		float * out);
+	/// @see gtx_batch_noise
+	GLM_FUNC_DECL void simplexRow(
+		vec4 const & origin,
+		float step,
+		std::size_t count,
+		int octaves,
+		float lacunarity,
+		float gain,
+		float * out);
+
+	/// @}
+}// namespace glm
+
+#include "batch_noise.inl"
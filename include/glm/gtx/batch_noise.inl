@@ -0,0 +1,559 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_noise
+/// @file glm/gtx/batch_noise.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+// Wide versions of the webgl-noise functions of gtc/noise.inl, see there for
+// the derivation. Every expression keeps the order of operations of the
+// scalar one, so that the hashes and the floors agree
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// 0 where x < edge, else 1
+	GLM_FUNC_QUALIFIER floatx8 batch_noise_step(floatx8 const & edge, floatx8 const & x)
+	{
+		return select(x < edge, floatx8(0.0f), floatx8(1.0f));
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 batch_noise_mod289(floatx8 const & x)
+	{
+		return x - floor(x / 289.0f) * 289.0f;
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 batch_noise_permute(floatx8 const & x)
+	{
+		return batch_noise_mod289((x * 34.0f + 1.0f) * x);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 batch_noise_taylorInvSqrt(floatx8 const & r)
+	{
+		return 1.79284291400159f - 0.85373472095314f * r;
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 batch_noise_fade(floatx8 const & t)
+	{
+		return (t * t * t) * (t * (t * 6.0f - 15.0f) + 10.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_noise_load(vec2 const * in, std::size_t count, floatx8 & x, floatx8 & y)
+	{
+		float X[8] = {0};
+		float Y[8] = {0};
+		for(std::size_t i = 0; i < count && i < 8; ++i)
+		{
+			X[i] = in[i].x;
+			Y[i] = in[i].y;
+		}
+		x = wideLoad(X);
+		y = wideLoad(Y);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_noise_store(floatx8 const & v, float * out, std::size_t count)
+	{
+		if(count >= 8)
+		{
+			wideStore(v, out);
+			return;
+		}
+		float Lanes[8];
+		wideStore(v, Lanes);
+		std::memcpy(out, Lanes, count * sizeof(float));
+	}
+
+	// Perlin square corner: gradient picked by the hash i, normalized, dotted with the offset
+	GLM_FUNC_QUALIFIER floatx8 batch_perlin_corner(floatx8 const & i, floatx8 const & fx, floatx8 const & fy)
+	{
+		floatx8 gx = 2.0f * fract(i / 41.0f) - 1.0f;
+		floatx8 const gy = abs(gx) - 0.5f;
+		gx = gx - floor(gx + 0.5f);
+		floatx8 const Norm = batch_noise_taylorInvSqrt(gx * gx + gy * gy);
+		return (gx * Norm) * fx + (gy * Norm) * fy;
+	}
+
+	// Perlin cube corner, the gradients are 7 x 7 points mapped onto an octahedron
+	GLM_FUNC_QUALIFIER floatx8 batch_perlin_corner(floatx8 const & i, vec3x8 const & f)
+	{
+		float const OneSeventh = static_cast<float>(1.0 / 7.0);
+		floatx8 gx = i * OneSeventh;
+		floatx8 gy = fract(floor(gx) * OneSeventh) - 0.5f;
+		gx = fract(gx);
+		floatx8 const gz = 0.5f - abs(gx) - abs(gy);
+		floatx8 const sz = batch_noise_step(gz, floatx8(0.0f));
+		gx = gx - sz * (batch_noise_step(floatx8(0.0f), gx) - 0.5f);
+		gy = gy - sz * (batch_noise_step(floatx8(0.0f), gy) - 0.5f);
+		floatx8 const Norm = batch_noise_taylorInvSqrt(gx * gx + gy * gy + gz * gz);
+		return (gx * Norm) * f.x + (gy * Norm) * f.y + (gz * Norm) * f.z;
+	}
+
+	// Perlin hypercube corner, 7 x 7 x 6 points mapped onto a 4-cross polytope
+	GLM_FUNC_QUALIFIER floatx8 batch_perlin_corner(floatx8 const & i, vec4x8 const & f)
+	{
+		floatx8 gx = i / 7.0f;
+		floatx8 gy = floor(gx) / 7.0f;
+		floatx8 gz = floor(gy) / 6.0f;
+		gx = fract(gx) - 0.5f;
+		gy = fract(gy) - 0.5f;
+		gz = fract(gz) - 0.5f;
+		floatx8 const gw = 0.75f - abs(gx) - abs(gy) - abs(gz);
+		floatx8 const sw = batch_noise_step(gw, floatx8(0.0f));
+		gx = gx - sw * (batch_noise_step(floatx8(0.0f), gx) - 0.5f);
+		gy = gy - sw * (batch_noise_step(floatx8(0.0f), gy) - 0.5f);
+		floatx8 const Norm = batch_noise_taylorInvSqrt((gx * gx + gy * gy) + (gz * gz + gw * gw));
+		return ((gx * Norm) * f.x + (gy * Norm) * f.y) + ((gz * Norm) * f.z + (gw * Norm) * f.w);
+	}
+
+	// Simplex triangle corner: hash p, offset (x, y) from the corner, falloff included
+	GLM_FUNC_QUALIFIER floatx8 batch_simplex_corner(floatx8 const & p, floatx8 const & x, floatx8 const & y)
+	{
+		floatx8 m = max(0.5f - (x * x + y * y), floatx8(0.0f));
+		m = m * m;
+		m = m * m;
+		// 41 points uniformly over a line, mapped onto a diamond
+		floatx8 const gx = 2.0f * fract(p * 0.024390243902439f) - 1.0f;
+		floatx8 const h = abs(gx) - 0.5f;
+		floatx8 const a0 = gx - floor(gx + 0.5f);
+		m = m * batch_noise_taylorInvSqrt(a0 * a0 + h * h);
+		return m * (a0 * x + h * y);
+	}
+
+	// Simplex tetrahedron corner, 7 x 7 points over a square mapped onto an octahedron
+	GLM_FUNC_QUALIFIER floatx8 batch_simplex_corner(floatx8 const & p, vec3x8 const & x)
+	{
+		float const n_ = 0.142857142857f;
+		float const nsx = n_ * 2.0f - 0.0f;
+		float const nsy = n_ * 0.5f - 1.0f;
+		float const nsz = n_ * 1.0f - 0.0f;
+
+		floatx8 const j = p - 49.0f * floor(p * nsz * nsz);
+		floatx8 const x_ = floor(j * nsz);
+		floatx8 const y_ = floor(j - 7.0f * x_);
+		floatx8 const gx = x_ * nsx + nsy;
+		floatx8 const gy = y_ * nsx + nsy;
+		floatx8 const h = 1.0f - abs(gx) - abs(gy);
+		floatx8 const sh = -batch_noise_step(h, floatx8(0.0f));
+
+		vec3x8 g(
+			gx + (floor(gx) * 2.0f + 1.0f) * sh,
+			gy + (floor(gy) * 2.0f + 1.0f) * sh,
+			h);
+		g *= batch_noise_taylorInvSqrt(g.x * g.x + g.y * g.y + g.z * g.z);
+
+		floatx8 m = max(0.6f - (x.x * x.x + x.y * x.y + x.z * x.z), floatx8(0.0f));
+		m = m * m;
+		return (m * m) * (g.x * x.x + g.y * x.y + g.z * x.z);
+	}
+
+	// Simplex pentachoron corner, see gtc::grad4
+	GLM_FUNC_QUALIFIER floatx8 batch_simplex_corner(floatx8 const & j, vec4x8 const & x)
+	{
+		float const ipx = 1.0f / 294.0f;
+		float const ipy = 1.0f / 49.0f;
+		float const ipz = 1.0f / 7.0f;
+
+		vec4x8 g;
+		g.x = floor(fract(j * ipx) * 7.0f) * ipz - 1.0f;
+		g.y = floor(fract(j * ipy) * 7.0f) * ipz - 1.0f;
+		g.z = floor(fract(j * ipz) * 7.0f) * ipz - 1.0f;
+		g.w = 1.5f - (abs(g.x) * 1.0f + abs(g.y) * 1.0f + abs(g.z) * 1.0f);
+		floatx8 const Zero(0.0f);
+		floatx8 const One(1.0f);
+		floatx8 const sw = select(g.w < Zero, One, Zero);
+		g.x = g.x + (select(g.x < Zero, One, Zero) * 2.0f - 1.0f) * sw;
+		g.y = g.y + (select(g.y < Zero, One, Zero) * 2.0f - 1.0f) * sw;
+		g.z = g.z + (select(g.z < Zero, One, Zero) * 2.0f - 1.0f) * sw;
+		g *= batch_noise_taylorInvSqrt((g.x * g.x + g.y * g.y) + (g.z * g.z + g.w * g.w));
+
+		floatx8 m = max(0.6f - ((x.x * x.x + x.y * x.y) + (x.z * x.z + x.w * x.w)), Zero);
+		m = m * m;
+		return (m * m) * ((g.x * x.x + g.y * x.y) + (g.z * x.z + g.w * x.w));
+	}
+
+	// The eight points of a row, one noise per dimension count
+	struct batch_perlin2
+	{
+		GLM_FUNC_QUALIFIER static floatx8 call(vec4x8 const & p){return perlin(p.x, p.y);}
+	};
+
+	struct batch_perlin3
+	{
+		GLM_FUNC_QUALIFIER static floatx8 call(vec4x8 const & p){return perlin(vec3x8(p));}
+	};
+
+	struct batch_perlin4
+	{
+		GLM_FUNC_QUALIFIER static floatx8 call(vec4x8 const & p){return perlin(p);}
+	};
+
+	struct batch_simplex2
+	{
+		GLM_FUNC_QUALIFIER static floatx8 call(vec4x8 const & p){return simplex(p.x, p.y);}
+	};
+
+	struct batch_simplex3
+	{
+		GLM_FUNC_QUALIFIER static floatx8 call(vec4x8 const & p){return simplex(vec3x8(p));}
+	};
+
+	struct batch_simplex4
+	{
+		GLM_FUNC_QUALIFIER static floatx8 call(vec4x8 const & p){return simplex(p);}
+	};
+
+	template <typename noise>
+	GLM_FUNC_QUALIFIER void batch_noise_row(vec4 const & origin, float step, std::size_t count, int octaves, float lacunarity, float gain, float * out)
+	{
+		float Lanes[8];
+		for(int l = 0; l < 8; ++l)
+			Lanes[l] = static_cast<float>(l);
+		floatx8 const Offsets = wideLoad(Lanes);
+
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			floatx8 const x = origin.x + (static_cast<float>(i) + Offsets) * step;
+			floatx8 Sum(0.0f);
+			float Frequency = 1.0f;
+			float Amplitude = 1.0f;
+			for(int o = 0; o < octaves; ++o)
+			{
+				vec4x8 const p(x * Frequency, floatx8(origin.y * Frequency), floatx8(origin.z * Frequency), floatx8(origin.w * Frequency));
+				Sum += Amplitude * noise::call(p);
+				Frequency *= lacunarity;
+				Amplitude *= gain;
+			}
+			batch_noise_store(Sum, out + i, count - i);
+		}
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER floatx8 perlin(floatx8 const & x, floatx8 const & y)
+	{
+		floatx8 const Floor[2] = {floor(x), floor(y)};
+		floatx8 Pi[2][2];
+		floatx8 Pf[2][2];
+		for(int k = 0; k < 2; ++k)
+		{
+			Pi[0][k] = detail::batch_noise_mod289(Floor[k]);
+			Pi[1][k] = detail::batch_noise_mod289(Floor[k] + 1.0f);
+		}
+		Pf[0][0] = fract(x);
+		Pf[0][1] = fract(y);
+		Pf[1][0] = Pf[0][0] - 1.0f;
+		Pf[1][1] = Pf[0][1] - 1.0f;
+
+		// n[a][b] is the corner at x + a, y + b
+		floatx8 n[2][2];
+		for(int a = 0; a < 2; ++a)
+		{
+			floatx8 const ix = detail::batch_noise_permute(Pi[a][0]);
+			for(int b = 0; b < 2; ++b)
+				n[a][b] = detail::batch_perlin_corner(detail::batch_noise_permute(ix + Pi[b][1]), Pf[a][0], Pf[b][1]);
+		}
+
+		floatx8 const FadeX = detail::batch_noise_fade(Pf[0][0]);
+		floatx8 const FadeY = detail::batch_noise_fade(Pf[0][1]);
+		return 2.3f * mix(mix(n[0][0], n[1][0], FadeX), mix(n[0][1], n[1][1], FadeX), FadeY);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 perlin(vec3x8 const & p)
+	{
+		floatx8 const Position[3] = {p.x, p.y, p.z};
+		floatx8 Pi[2][3];
+		floatx8 Pf[2][3];
+		for(int k = 0; k < 3; ++k)
+		{
+			floatx8 const Floor = floor(Position[k]);
+			Pi[0][k] = detail::batch_noise_mod289(Floor);
+			Pi[1][k] = detail::batch_noise_mod289(Floor + 1.0f);
+			Pf[0][k] = fract(Position[k]);
+			Pf[1][k] = Pf[0][k] - 1.0f;
+		}
+
+		// n[a][b][c] is the corner at x + a, y + b, z + c
+		floatx8 n[2][2][2];
+		for(int a = 0; a < 2; ++a)
+		for(int b = 0; b < 2; ++b)
+		{
+			floatx8 const ixy = detail::batch_noise_permute(detail::batch_noise_permute(Pi[a][0]) + Pi[b][1]);
+			for(int c = 0; c < 2; ++c)
+				n[a][b][c] = detail::batch_perlin_corner(detail::batch_noise_permute(ixy + Pi[c][2]), vec3x8(Pf[a][0], Pf[b][1], Pf[c][2]));
+		}
+
+		floatx8 const FadeX = detail::batch_noise_fade(Pf[0][0]);
+		floatx8 const FadeY = detail::batch_noise_fade(Pf[0][1]);
+		floatx8 const FadeZ = detail::batch_noise_fade(Pf[0][2]);
+		floatx8 n_yz[2];
+		for(int a = 0; a < 2; ++a)
+			n_yz[a] = mix(mix(n[a][0][0], n[a][0][1], FadeZ), mix(n[a][1][0], n[a][1][1], FadeZ), FadeY);
+		return 2.2f * mix(n_yz[0], n_yz[1], FadeX);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 perlin(vec4x8 const & p)
+	{
+		floatx8 const Position[4] = {p.x, p.y, p.z, p.w};
+		floatx8 Pi[2][4];
+		floatx8 Pf[2][4];
+		for(int k = 0; k < 4; ++k)
+		{
+			floatx8 const Floor = floor(Position[k]);
+			Pi[0][k] = detail::batch_noise_mod289(Floor);
+			Pi[1][k] = detail::batch_noise_mod289(Floor + 1.0f);
+			Pf[0][k] = fract(Position[k]);
+			Pf[1][k] = Pf[0][k] - 1.0f;
+		}
+
+		// n[a][b][c][d] is the corner at x + a, y + b, z + c, w + d
+		floatx8 n[2][2][2][2];
+		for(int a = 0; a < 2; ++a)
+		for(int b = 0; b < 2; ++b)
+		{
+			floatx8 const ixy = detail::batch_noise_permute(detail::batch_noise_permute(Pi[a][0]) + Pi[b][1]);
+			for(int c = 0; c < 2; ++c)
+			{
+				floatx8 const ixyz = detail::batch_noise_permute(ixy + Pi[c][2]);
+				for(int d = 0; d < 2; ++d)
+					n[a][b][c][d] = detail::batch_perlin_corner(detail::batch_noise_permute(ixyz + Pi[d][3]), vec4x8(Pf[a][0], Pf[b][1], Pf[c][2], Pf[d][3]));
+			}
+		}
+
+		floatx8 const FadeX = detail::batch_noise_fade(Pf[0][0]);
+		floatx8 const FadeY = detail::batch_noise_fade(Pf[0][1]);
+		floatx8 const FadeZ = detail::batch_noise_fade(Pf[0][2]);
+		floatx8 const FadeW = detail::batch_noise_fade(Pf[0][3]);
+		floatx8 n_yzw[2];
+		for(int a = 0; a < 2; ++a)
+		{
+			floatx8 n_zw[2];
+			for(int b = 0; b < 2; ++b)
+				n_zw[b] = mix(mix(n[a][b][0][0], n[a][b][0][1], FadeW), mix(n[a][b][1][0], n[a][b][1][1], FadeW), FadeZ);
+			n_yzw[a] = mix(n_zw[0], n_zw[1], FadeY);
+		}
+		return 2.2f * mix(n_yzw[0], n_yzw[1], FadeX);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 simplex(floatx8 const & x, floatx8 const & y)
+	{
+		float const Cx = 0.211324865405187f;	// (3.0 -  sqrt(3.0)) / 6.0
+		float const Cy = 0.366025403784439f;	//  0.5 * (sqrt(3.0)  - 1.0)
+		float const Cz = -0.577350269189626f;	// -1.0 + 2.0 * C.x
+
+		// First corner
+		floatx8 const Skew = x * Cy + y * Cy;
+		floatx8 ix = floor(x + Skew);
+		floatx8 iy = floor(y + Skew);
+		floatx8 const Unskew = ix * Cx + iy * Cx;
+		floatx8 const x0 = x - ix + Unskew;
+		floatx8 const y0 = y - iy + Unskew;
+
+		// Other corners, the middle one is (1, 0) below the diagonal and (0, 1) above
+		boolx8 const Lower = x0 > y0;
+		floatx8 const i1x = select(Lower, floatx8(1.0f), floatx8(0.0f));
+		floatx8 const i1y = select(Lower, floatx8(0.0f), floatx8(1.0f));
+		floatx8 const x1 = (x0 + Cx) - i1x;
+		floatx8 const y1 = (y0 + Cx) - i1y;
+		floatx8 const x2 = x0 + Cz;
+		floatx8 const y2 = y0 + Cz;
+
+		// Permutations
+		ix = detail::batch_noise_mod289(ix);
+		iy = detail::batch_noise_mod289(iy);
+		floatx8 const p0 = detail::batch_noise_permute(detail::batch_noise_permute(iy) + ix);
+		floatx8 const p1 = detail::batch_noise_permute(detail::batch_noise_permute(iy + i1y) + ix + i1x);
+		floatx8 const p2 = detail::batch_noise_permute(detail::batch_noise_permute(iy + 1.0f) + ix + 1.0f);
+
+		return 130.0f * (detail::batch_simplex_corner(p0, x0, y0) + detail::batch_simplex_corner(p1, x1, y1) + detail::batch_simplex_corner(p2, x2, y2));
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 simplex(vec3x8 const & v)
+	{
+		float const Cx = static_cast<float>(1.0 / 6.0);
+		float const Cy = static_cast<float>(1.0 / 3.0);
+
+		// First corner
+		floatx8 const Skew = v.x * Cy + v.y * Cy + v.z * Cy;
+		vec3x8 i(floor(v.x + Skew), floor(v.y + Skew), floor(v.z + Skew));
+		floatx8 const Unskew = i.x * Cx + i.y * Cx + i.z * Cx;
+		vec3x8 const x0(v.x - i.x + Unskew, v.y - i.y + Unskew, v.z - i.z + Unskew);
+
+		// Other corners
+		vec3x8 const g(
+			detail::batch_noise_step(x0.y, x0.x),
+			detail::batch_noise_step(x0.z, x0.y),
+			detail::batch_noise_step(x0.x, x0.z));
+		vec3x8 const l(1.0f - g.z, 1.0f - g.x, 1.0f - g.y);
+		vec3x8 const i1 = min(g, l);
+		vec3x8 const i2 = max(g, l);
+
+		vec3x8 const x1(x0.x - i1.x + Cx, x0.y - i1.y + Cx, x0.z - i1.z + Cx);
+		vec3x8 const x2(x0.x - i2.x + Cy, x0.y - i2.y + Cy, x0.z - i2.z + Cy);
+		vec3x8 const x3(x0.x - 0.5f, x0.y - 0.5f, x0.z - 0.5f);
+
+		// Permutations
+		i = vec3x8(detail::batch_noise_mod289(i.x), detail::batch_noise_mod289(i.y), detail::batch_noise_mod289(i.z));
+		vec3x8 const Offsets[4] = {vec3x8(vec3(0.0f)), i1, i2, vec3x8(vec3(1.0f))};
+		vec3x8 const Corners[4] = {x0, x1, x2, x3};
+		floatx8 Contributions[4];
+		for(int k = 0; k < 4; ++k)
+		{
+			floatx8 const p = detail::batch_noise_permute(detail::batch_noise_permute(detail::batch_noise_permute(
+				i.z + Offsets[k].z) + i.y + Offsets[k].y) + i.x + Offsets[k].x);
+			Contributions[k] = detail::batch_simplex_corner(p, Corners[k]);
+		}
+		return 42.0f * ((Contributions[0] + Contributions[1]) + (Contributions[2] + Contributions[3]));
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 simplex(vec4x8 const & v)
+	{
+		float const Cx = 0.138196601125011f;	// (5 - sqrt(5))/20  G4
+		float const Cy = 0.276393202250021f;	// 2 * G4
+		float const Cz = 0.414589803375032f;	// 3 * G4
+		float const Cw = -0.447213595499958f;	// -1 + 4 * G4
+		float const F4 = 0.309016994374947451f;	// (sqrt(5) - 1)/4
+
+		// First corner
+		floatx8 const Skew = (v.x * F4 + v.y * F4) + (v.z * F4 + v.w * F4);
+		vec4x8 i(floor(v.x + Skew), floor(v.y + Skew), floor(v.z + Skew), floor(v.w + Skew));
+		floatx8 const Unskew = (i.x * Cx + i.y * Cx) + (i.z * Cx + i.w * Cx);
+		vec4x8 const x0(v.x - i.x + Unskew, v.y - i.y + Unskew, v.z - i.z + Unskew, v.w - i.w + Unskew);
+
+		// Rank sorting, i0 holds 0, 1, 2 and 3 in some order
+		floatx8 const isXy = detail::batch_noise_step(x0.y, x0.x);
+		floatx8 const isXz = detail::batch_noise_step(x0.z, x0.x);
+		floatx8 const isXw = detail::batch_noise_step(x0.w, x0.x);
+		floatx8 const isYz = detail::batch_noise_step(x0.z, x0.y);
+		floatx8 const isYw = detail::batch_noise_step(x0.w, x0.y);
+		floatx8 const isZw = detail::batch_noise_step(x0.w, x0.z);
+		vec4x8 i0(isXy + isXz + isXw, 1.0f - isXy, 1.0f - isXz, 1.0f - isXw);
+		i0.y += isYz + isYw;
+		i0.z += 1.0f - isYz;
+		i0.w += 1.0f - isYw;
+		i0.z += isZw;
+		i0.w += 1.0f - isZw;
+
+		floatx8 const Zero(0.0f);
+		floatx8 const One(1.0f);
+		vec4x8 const i3(clamp(i0.x, Zero, One), clamp(i0.y, Zero, One), clamp(i0.z, Zero, One), clamp(i0.w, Zero, One));
+		vec4x8 const i2(clamp(i0.x - 1.0f, Zero, One), clamp(i0.y - 1.0f, Zero, One), clamp(i0.z - 1.0f, Zero, One), clamp(i0.w - 1.0f, Zero, One));
+		vec4x8 const i1(clamp(i0.x - 2.0f, Zero, One), clamp(i0.y - 2.0f, Zero, One), clamp(i0.z - 2.0f, Zero, One), clamp(i0.w - 2.0f, Zero, One));
+
+		vec4x8 const x1(x0.x - i1.x + Cx, x0.y - i1.y + Cx, x0.z - i1.z + Cx, x0.w - i1.w + Cx);
+		vec4x8 const x2(x0.x - i2.x + Cy, x0.y - i2.y + Cy, x0.z - i2.z + Cy, x0.w - i2.w + Cy);
+		vec4x8 const x3(x0.x - i3.x + Cz, x0.y - i3.y + Cz, x0.z - i3.z + Cz, x0.w - i3.w + Cz);
+		vec4x8 const x4(x0.x + Cw, x0.y + Cw, x0.z + Cw, x0.w + Cw);
+
+		// Permutations
+		i = vec4x8(detail::batch_noise_mod289(i.x), detail::batch_noise_mod289(i.y), detail::batch_noise_mod289(i.z), detail::batch_noise_mod289(i.w));
+		vec4x8 const Offsets[5] = {vec4x8(vec4(0.0f)), i1, i2, i3, vec4x8(vec4(1.0f))};
+		vec4x8 const Corners[5] = {x0, x1, x2, x3, x4};
+		floatx8 Contributions[5];
+		for(int k = 0; k < 5; ++k)
+		{
+			floatx8 const j = detail::batch_noise_permute(detail::batch_noise_permute(detail::batch_noise_permute(detail::batch_noise_permute(
+				i.w + Offsets[k].w) + i.z + Offsets[k].z) + i.y + Offsets[k].y) + i.x + Offsets[k].x);
+			Contributions[k] = detail::batch_simplex_corner(j, Corners[k]);
+		}
+		return 49.0f * ((Contributions[0] + Contributions[1] + Contributions[2]) + (Contributions[3] + Contributions[4]));
+	}
+
+	GLM_FUNC_QUALIFIER void perlinNoise(vec2 const * in, float * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			floatx8 x, y;
+			detail::batch_noise_load(in + i, count - i, x, y);
+			detail::batch_noise_store(perlin(x, y), out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void perlinNoise(vec3 const * in, float * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+			detail::batch_noise_store(perlin(wideGather(in + i, count - i)), out + i, count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinNoise(vec4 const * in, float * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+			detail::batch_noise_store(perlin(wideGather(in + i, count - i)), out + i, count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexNoise(vec2 const * in, float * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			floatx8 x, y;
+			detail::batch_noise_load(in + i, count - i, x, y);
+			detail::batch_noise_store(simplex(x, y), out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void simplexNoise(vec3 const * in, float * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+			detail::batch_noise_store(simplex(wideGather(in + i, count - i)), out + i, count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexNoise(vec4 const * in, float * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+			detail::batch_noise_store(simplex(wideGather(in + i, count - i)), out + i, count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinRow(vec2 const & origin, float step, std::size_t count, int octaves, float lacunarity, float gain, float * out)
+	{
+		detail::batch_noise_row<detail::batch_perlin2>(vec4(origin, 0.0f, 0.0f), step, count, octaves, lacunarity, gain, out);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinRow(vec3 const & origin, float step, std::size_t count, int octaves, float lacunarity, float gain, float * out)
+	{
+		detail::batch_noise_row<detail::batch_perlin3>(vec4(origin, 0.0f), step, count, octaves, lacunarity, gain, out);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinRow(vec4 const & origin, float step, std::size_t count, int octaves, float lacunarity, float gain, float * out)
+	{
+		detail::batch_noise_row<detail::batch_perlin4>(origin, step, count, octaves, lacunarity, gain, out);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexRow(vec2 const & origin, float step, std::size_t count, int octaves, float lacunarity, float gain, float * out)
+	{
+		detail::batch_noise_row<detail::batch_simplex2>(vec4(origin, 0.0f, 0.0f), step, count, octaves, lacunarity, gain, out);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexRow(vec3 const & origin, float step, std::size_t count, int octaves, float lacunarity, float gain, float * out)
+	{
+		detail::batch_noise_row<detail::batch_simplex3>(vec4(origin, 0.0f), step, count, octaves, lacunarity, gain, out);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexRow(vec4 const & origin, float step, std::size_t count, int octaves, float lacunarity, float gain, float * out)
+	{
+		detail::batch_noise_row<detail::batch_simplex4>(origin, step, count, octaves, lacunarity, gain, out);
+	}
+}//namespace glm
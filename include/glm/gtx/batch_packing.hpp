@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_packing
+/// @file glm/gtx/batch_packing.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_packing (dependence)
+/// @see gtx_wide (dependence)
+///
+/// @defgroup gtx_batch_packing GLM_GTX_batch_packing
+/// @ingroup gtx
+/// 
+/// @brief Pack arrays of vectors to the normalized, integer and packed float formats
+/// of GLM_GTC_packing and unpack them.
+/// 
+/// Vertex attributes and render target readbacks, millions of vectors at a
+/// time. Each function gives the bits of its GLM_GTC_packing (or core)
+/// counterpart for every input, NaNs and out of range values included: the
+/// same clamp, the rounding of round (glm's own one when GLM_HAS_CXX11_STL is
+/// 0) and the same float constants. The 8 and 16 bits formats convert eight
+/// components at a time in place, the others gather eight vectors into
+/// GLM_GTX_wide registers, or integer ones for the I3x10_1x2 and U3x10_1x2
+/// formats. The instruction set follows GLM_BATCH_ARCH.
+/// The inputs and outputs of one call must not overlap.
+/// 
+/// <glm/gtx/batch_packing.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependencies
+#include "../vec2.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include "../gtc/packing.hpp"
+#include "../gtx/wide.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_batch_packing extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_packing
+	/// @{
+
+	/// out[i] = packUnorm1x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packUnorm1x8(float const * in, uint8 * out, std::size_t count);
+	/// out[i] = unpackUnorm1x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackUnorm1x8(uint8 const * in, float * out, std::size_t count);
+
+	/// out[i] = packSnorm1x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packSnorm1x8(float const * in, uint8 * out, std::size_t count);
+	/// out[i] = unpackSnorm1x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackSnorm1x8(uint8 const * in, float * out, std::size_t count);
+
+	/// out[i] = packUnorm2x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packUnorm2x8(vec2 const * in, uint16 * out, std::size_t count);
+	/// out[i] = unpackUnorm2x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackUnorm2x8(uint16 const * in, vec2 * out, std::size_t count);
+
+	/// out[i] = packSnorm2x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packSnorm2x8(vec2 const * in, uint16 * out, std::size_t count);
+	/// out[i] = unpackSnorm2x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackSnorm2x8(uint16 const * in, vec2 * out, std::size_t count);
+
+	/// out[i] = packUnorm4x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packUnorm4x8(vec4 const * in, uint32 * out, std::size_t count);
+	/// out[i] = unpackUnorm4x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackUnorm4x8(uint32 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packSnorm4x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packSnorm4x8(vec4 const * in, uint32 * out, std::size_t count);
+	/// out[i] = unpackSnorm4x8(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackSnorm4x8(uint32 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packUnorm1x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packUnorm1x16(float const * in, uint16 * out, std::size_t count);
+	/// out[i] = unpackUnorm1x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackUnorm1x16(uint16 const * in, float * out, std::size_t count);
+
+	/// out[i] = packSnorm1x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packSnorm1x16(float const * in, uint16 * out, std::size_t count);
+	/// out[i] = unpackSnorm1x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackSnorm1x16(uint16 const * in, float * out, std::size_t count);
+
+	/// out[i] = packUnorm2x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packUnorm2x16(vec2 const * in, uint32 * out, std::size_t count);
+	/// out[i] = unpackUnorm2x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackUnorm2x16(uint32 const * in, vec2 * out, std::size_t count);
+
+	/// out[i] = packSnorm2x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packSnorm2x16(vec2 const * in, uint32 * out, std::size_t count);
+	/// out[i] = unpackSnorm2x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackSnorm2x16(uint32 const * in, vec2 * out, std::size_t count);
+
+	/// out[i] = packUnorm4x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packUnorm4x16(vec4 const * in, uint64 * out, std::size_t count);
+	/// out[i] = unpackUnorm4x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackUnorm4x16(uint64 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packSnorm4x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packSnorm4x16(vec4 const * in, uint64 * out, std::size_t count);
+	/// out[i] = unpackSnorm4x16(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackSnorm4x16(uint64 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packI3x10_1x2(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packI3x10_1x2(ivec4 const * in, uint32 * out, std::size_t count);
+	/// out[i] = unpackI3x10_1x2(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackI3x10_1x2(uint32 const * in, ivec4 * out, std::size_t count);
+
+	/// out[i] = packU3x10_1x2(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packU3x10_1x2(uvec4 const * in, uint32 * out, std::size_t count);
+	/// out[i] = unpackU3x10_1x2(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackU3x10_1x2(uint32 const * in, uvec4 * out, std::size_t count);
+
+	/// out[i] = packUnorm3x10_1x2(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packUnorm3x10_1x2(vec4 const * in, uint32 * out, std::size_t count);
+	/// out[i] = unpackUnorm3x10_1x2(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackUnorm3x10_1x2(uint32 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packSnorm3x10_1x2(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packSnorm3x10_1x2(vec4 const * in, uint32 * out, std::size_t count);
+	/// out[i] = unpackSnorm3x10_1x2(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackSnorm3x10_1x2(uint32 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packF2x11_1x10(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void packF2x11_1x10(vec3 const * in, uint32 * out, std::size_t count);
+	/// out[i] = unpackF2x11_1x10(in[i]).
+	/// @see gtx_batch_packing
+	GLM_FUNC_DECL void unpackF2x11_1x10(uint32 const * in, vec3 * out, std::size_t count);
+
+	/// @}
+}// namespace glm
+
+#include "batch_packing.inl"
@@ -0,0 +1,904 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_packing
+/// @file glm/gtx/batch_packing.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// Eight 32 bits integers, lane i beside lane i of a floatx8
+	struct batch_intx8
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m256i data;
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			__m128i data[2];
+#		else
+			uint32 data[8];
+#		endif
+	};
+
+	GLM_FUNC_QUALIFIER batch_intx8 batch_int(uint32 s)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_set1_epi32(int(s));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = Result.data[1] = _mm_set1_epi32(int(s));
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = s;
+#		endif
+		return Result;
+	}
+
+	// Bits of the floats
+	GLM_FUNC_QUALIFIER batch_intx8 batch_bits(floatx8 const & v)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_castps_si256(v.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_castps_si128(v.data[0]);
+			Result.data[1] = _mm_castps_si128(v.data[1]);
+#		else
+			std::memcpy(Result.data, v.data, sizeof(Result.data));
+#		endif
+		return Result;
+	}
+
+	// Floats of the bits
+	GLM_FUNC_QUALIFIER floatx8 batch_float_bits(batch_intx8 const & v)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return wide_float(_mm256_castsi256_ps(v.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return wide_float(_mm_castsi128_ps(v.data[0]), _mm_castsi128_ps(v.data[1]));
+#		else
+			floatx8 Result;
+			std::memcpy(Result.data, v.data, sizeof(Result.data));
+			return Result;
+#		endif
+	}
+
+	// Floats of the signed integers
+	GLM_FUNC_QUALIFIER floatx8 batch_float(batch_intx8 const & v)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return wide_float(_mm256_cvtepi32_ps(v.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return wide_float(_mm_cvtepi32_ps(v.data[0]), _mm_cvtepi32_ps(v.data[1]));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = float(int32(v.data[i]));
+			return Result;
+#		endif
+	}
+
+	// Signed integers of the floats rounded toward zero, which must fit
+	GLM_FUNC_QUALIFIER batch_intx8 batch_trunc(floatx8 const & v)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_cvttps_epi32(v.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_cvttps_epi32(v.data[0]);
+			Result.data[1] = _mm_cvttps_epi32(v.data[1]);
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = uint32(int32(v.data[i]));
+#		endif
+		return Result;
+	}
+
+	// ~0 in the lanes of b that are true, 0 in the others
+	GLM_FUNC_QUALIFIER batch_intx8 batch_mask(boolx8 const & b)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_castps_si256(b.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_castps_si128(b.data[0]);
+			Result.data[1] = _mm_castps_si128(b.data[1]);
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = b.data[i] ? ~0u : 0u;
+#		endif
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER batch_intx8 batch_and(batch_intx8 const & a, batch_intx8 const & b)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_and_si256(a.data, b.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_and_si128(a.data[0], b.data[0]);
+			Result.data[1] = _mm_and_si128(a.data[1], b.data[1]);
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] & b.data[i];
+#		endif
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER batch_intx8 batch_or(batch_intx8 const & a, batch_intx8 const & b)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_or_si256(a.data, b.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_or_si128(a.data[0], b.data[0]);
+			Result.data[1] = _mm_or_si128(a.data[1], b.data[1]);
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] | b.data[i];
+#		endif
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER batch_intx8 batch_add(batch_intx8 const & a, batch_intx8 const & b)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_add_epi32(a.data, b.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_add_epi32(a.data[0], b.data[0]);
+			Result.data[1] = _mm_add_epi32(a.data[1], b.data[1]);
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] + b.data[i];
+#		endif
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER batch_intx8 batch_sub(batch_intx8 const & a, batch_intx8 const & b)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_sub_epi32(a.data, b.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_sub_epi32(a.data[0], b.data[0]);
+			Result.data[1] = _mm_sub_epi32(a.data[1], b.data[1]);
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] - b.data[i];
+#		endif
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER batch_intx8 batch_shl(batch_intx8 const & v, int Shift)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_slli_epi32(v.data, Shift);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_slli_epi32(v.data[0], Shift);
+			Result.data[1] = _mm_slli_epi32(v.data[1], Shift);
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = v.data[i] << Shift;
+#		endif
+		return Result;
+	}
+
+	// Shift right bringing in zeros
+	GLM_FUNC_QUALIFIER batch_intx8 batch_shr(batch_intx8 const & v, int Shift)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_srli_epi32(v.data, Shift);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_srli_epi32(v.data[0], Shift);
+			Result.data[1] = _mm_srli_epi32(v.data[1], Shift);
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = v.data[i] >> Shift;
+#		endif
+		return Result;
+	}
+
+	// Shift right bringing in copies of the sign bit
+	GLM_FUNC_QUALIFIER batch_intx8 batch_sar(batch_intx8 const & v, int Shift)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_srai_epi32(v.data, Shift);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_srai_epi32(v.data[0], Shift);
+			Result.data[1] = _mm_srai_epi32(v.data[1], Shift);
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = uint32(int32(v.data[i]) >> Shift);
+#		endif
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 batch_equal(batch_intx8 const & a, batch_intx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return wide_bool(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a.data, b.data)));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return wide_bool(_mm_castsi128_ps(_mm_cmpeq_epi32(a.data[0], b.data[0])), _mm_castsi128_ps(_mm_cmpeq_epi32(a.data[1], b.data[1])));
+#		else
+			boolx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] == b.data[i];
+			return Result;
+#		endif
+	}
+
+	// Lanes of a where m is true, of b elsewhere
+	GLM_FUNC_QUALIFIER batch_intx8 batch_select(boolx8 const & m, batch_intx8 const & a, batch_intx8 const & b)
+	{
+		batch_intx8 const Mask = batch_mask(m);
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			batch_intx8 Result;
+			Result.data = _mm256_blendv_epi8(b.data, a.data, Mask.data);
+			return Result;
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			batch_intx8 Result;
+			Result.data[0] = _mm_or_si128(_mm_and_si128(Mask.data[0], a.data[0]), _mm_andnot_si128(Mask.data[0], b.data[0]));
+			Result.data[1] = _mm_or_si128(_mm_and_si128(Mask.data[1], a.data[1]), _mm_andnot_si128(Mask.data[1], b.data[1]));
+			return Result;
+#		else
+			return batch_or(batch_and(Mask, a), batch_and(batch_sub(batch_int(~0u), Mask), b));
+#		endif
+	}
+
+	/* Nearest integers like round. std::round takes halves away from zero,
+	from the difference to the truncated value, exact below 2^23, far above
+	what is packed here. Without it glm truncates v +- 0.5, which also rounds
+	up the float just under 0.5 */
+	GLM_FUNC_QUALIFIER batch_intx8 batch_round(floatx8 const & v)
+	{
+#		if GLM_HAS_CXX11_STL
+			batch_intx8 const Trunc = batch_trunc(v);
+			floatx8 const Fraction = v - batch_float(Trunc);
+			// The masks are -1 where true
+			return batch_sub(batch_add(Trunc, batch_mask(Fraction <= floatx8(-0.5f))), batch_mask(Fraction >= floatx8(0.5f)));
+#		else
+			return batch_trunc(v + select(v < floatx8(0.0f), floatx8(-0.5f), floatx8(0.5f)));
+#		endif
+	}
+
+	// round(clamp(v, Min, 1) * Scale), a NaN gives Min like clamp
+	GLM_FUNC_QUALIFIER batch_intx8 batch_quantize(floatx8 const & v, float Min, float Scale)
+	{
+		return batch_round(min(floatx8(1.0f), max(floatx8(Min), v)) * Scale);
+	}
+
+	// Floats of integers, divided by Scale and clamped to -1 when Signed like the unpack functions
+	GLM_FUNC_QUALIFIER floatx8 batch_dequantize(batch_intx8 const & v, bool Signed, float Scale)
+	{
+		floatx8 const Result = batch_float(v) / Scale;
+		return Signed ? min(floatx8(1.0f), max(floatx8(-1.0f), Result)) : Result;
+	}
+
+	// Same with a multiply by Factor, what the 8 and 16 bits formats do
+	GLM_FUNC_QUALIFIER floatx8 batch_dequantize_multiply(batch_intx8 const & v, bool Signed, float Factor)
+	{
+		floatx8 const Result = batch_float(v) * Factor;
+		return Signed ? min(floatx8(1.0f), max(floatx8(-1.0f), Result)) : Result;
+	}
+
+	// Eight 32 bits values, count of them read when under eight, the others zero
+	GLM_FUNC_QUALIFIER batch_intx8 batch_load(uint32 const * in, std::size_t count)
+	{
+		uint32 Packed[8];
+		if(count < 8)
+		{
+			std::memset(Packed, 0, sizeof(Packed));
+			std::memcpy(Packed, in, count * sizeof(uint32));
+			in = Packed;
+		}
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			Result.data = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(in));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			Result.data[0] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in));
+			Result.data[1] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 4));
+#		else
+			std::memcpy(Result.data, in, sizeof(Result.data));
+#		endif
+		return Result;
+	}
+
+	// The first count lanes, up to eight
+	GLM_FUNC_QUALIFIER void batch_store(batch_intx8 const & v, uint32 * out, std::size_t count)
+	{
+		uint32 Packed[8];
+		uint32 * p = count < 8 ? Packed : out;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p), v.data[0]);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 4), v.data[1]);
+#		else
+			std::memcpy(p, v.data, sizeof(v.data));
+#		endif
+		if(count < 8)
+			std::memcpy(out, Packed, count * sizeof(uint32));
+	}
+
+	// Eight 8 bits integers, sign extended when Signed
+	GLM_FUNC_QUALIFIER batch_intx8 batch_load8(uint8 const * in, bool Signed)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m128i const Bytes = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(in));
+			Result.data = Signed ? _mm256_cvtepi8_epi32(Bytes) : _mm256_cvtepu8_epi32(Bytes);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			__m128i const Bytes = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(in));
+			if(Signed)
+			{
+				__m128i const Words = _mm_srai_epi16(_mm_unpacklo_epi8(Bytes, Bytes), 8);
+				Result.data[0] = _mm_srai_epi32(_mm_unpacklo_epi16(Words, Words), 16);
+				Result.data[1] = _mm_srai_epi32(_mm_unpackhi_epi16(Words, Words), 16);
+			}
+			else
+			{
+				__m128i const Zero = _mm_setzero_si128();
+				__m128i const Words = _mm_unpacklo_epi8(Bytes, Zero);
+				Result.data[0] = _mm_unpacklo_epi16(Words, Zero);
+				Result.data[1] = _mm_unpackhi_epi16(Words, Zero);
+			}
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = Signed ? uint32(int32(int8(in[i]))) : uint32(in[i]);
+#		endif
+		return Result;
+	}
+
+	// Eight 16 bits integers, sign extended when Signed
+	GLM_FUNC_QUALIFIER batch_intx8 batch_load16(uint16 const * in, bool Signed)
+	{
+		batch_intx8 Result;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m128i const Words = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in));
+			Result.data = Signed ? _mm256_cvtepi16_epi32(Words) : _mm256_cvtepu16_epi32(Words);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			__m128i const Words = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in));
+			if(Signed)
+			{
+				Result.data[0] = _mm_srai_epi32(_mm_unpacklo_epi16(Words, Words), 16);
+				Result.data[1] = _mm_srai_epi32(_mm_unpackhi_epi16(Words, Words), 16);
+			}
+			else
+			{
+				__m128i const Zero = _mm_setzero_si128();
+				Result.data[0] = _mm_unpacklo_epi16(Words, Zero);
+				Result.data[1] = _mm_unpackhi_epi16(Words, Zero);
+			}
+#		else
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = Signed ? uint32(int32(int16(in[i]))) : uint32(in[i]);
+#		endif
+		return Result;
+	}
+
+	// The low 8 bits of the eight lanes
+	GLM_FUNC_QUALIFIER void batch_store8(batch_intx8 const & v, uint8 * out)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m128i const Low = _mm256_castsi256_si128(v.data);
+			__m128i const High = _mm256_extracti128_si256(v.data, 1);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			__m128i const Low = v.data[0];
+			__m128i const High = v.data[1];
+#		endif
+#		if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+			// Masked to 0-255 the saturations keep every value
+			__m128i const Byte = _mm_set1_epi32(0xff);
+			__m128i const Words = _mm_packs_epi32(_mm_and_si128(Low, Byte), _mm_and_si128(High, Byte));
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(Words, Words));
+#		else
+			for(int i = 0; i < 8; ++i)
+				out[i] = uint8(v.data[i]);
+#		endif
+	}
+
+	// The low 16 bits of the eight lanes
+	GLM_FUNC_QUALIFIER void batch_store16(batch_intx8 const & v, uint16 * out)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m128i const Low = _mm256_castsi256_si128(v.data);
+			__m128i const High = _mm256_extracti128_si256(v.data, 1);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			__m128i const Low = v.data[0];
+			__m128i const High = v.data[1];
+#		endif
+#		if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+			// Sign extended from bit 15 the saturation keeps every value
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_packs_epi32(
+				_mm_srai_epi32(_mm_slli_epi32(Low, 16), 16),
+				_mm_srai_epi32(_mm_slli_epi32(High, 16), 16)));
+#		else
+			for(int i = 0; i < 8; ++i)
+				out[i] = uint16(v.data[i]);
+#		endif
+	}
+
+	/* Components of 8 bits, in the order of the floats: eight at a time, the
+	last ones through a copy. The vectors of every format lie x first, so the
+	bits are those of the u8vec and i8vec casts of the scalar functions */
+	GLM_FUNC_QUALIFIER void batch_pack8(float const * in, uint8 * out, std::size_t count, float Min, float Scale)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+			batch_store8(batch_quantize(wideLoad(in + i), Min, Scale), out + i);
+		if(i < count)
+		{
+			float Components[8] = {0};
+			std::memcpy(Components, in + i, (count - i) * sizeof(float));
+			uint8 Packed[8];
+			batch_store8(batch_quantize(wideLoad(Components), Min, Scale), Packed);
+			std::memcpy(out + i, Packed, (count - i) * sizeof(uint8));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void batch_unpack8(uint8 const * in, float * out, std::size_t count, bool Signed, float Factor)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+			wideStore(batch_dequantize_multiply(batch_load8(in + i, Signed), Signed, Factor), out + i);
+		if(i < count)
+		{
+			uint8 Packed[8] = {0};
+			std::memcpy(Packed, in + i, (count - i) * sizeof(uint8));
+			float Components[8];
+			wideStore(batch_dequantize_multiply(batch_load8(Packed, Signed), Signed, Factor), Components);
+			std::memcpy(out + i, Components, (count - i) * sizeof(float));
+		}
+	}
+
+	// Same with 16 bits components
+	GLM_FUNC_QUALIFIER void batch_pack16(float const * in, uint16 * out, std::size_t count, float Min, float Scale)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+			batch_store16(batch_quantize(wideLoad(in + i), Min, Scale), out + i);
+		if(i < count)
+		{
+			float Components[8] = {0};
+			std::memcpy(Components, in + i, (count - i) * sizeof(float));
+			uint16 Packed[8];
+			batch_store16(batch_quantize(wideLoad(Components), Min, Scale), Packed);
+			std::memcpy(out + i, Packed, (count - i) * sizeof(uint16));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void batch_unpack16(uint16 const * in, float * out, std::size_t count, bool Signed, float Factor)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+			wideStore(batch_dequantize_multiply(batch_load16(in + i, Signed), Signed, Factor), out + i);
+		if(i < count)
+		{
+			uint16 Packed[8] = {0};
+			std::memcpy(Packed, in + i, (count - i) * sizeof(uint16));
+			float Components[8];
+			wideStore(batch_dequantize_multiply(batch_load16(Packed, Signed), Signed, Factor), Components);
+			std::memcpy(out + i, Components, (count - i) * sizeof(float));
+		}
+	}
+
+	/* Lane i of x, y, z and w from the vector i of four 32 bits integers,
+	count of them read when under eight, the others zero */
+	GLM_FUNC_QUALIFIER void batch_deinterleave(uint32 const * in, std::size_t count, batch_intx8 & x, batch_intx8 & y, batch_intx8 & z, batch_intx8 & w)
+	{
+		uint32 Packed[32];
+		if(count < 8)
+		{
+			std::memset(Packed, 0, sizeof(Packed));
+			std::memcpy(Packed, in, count * 4 * sizeof(uint32));
+			in = Packed;
+		}
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m256i const r0 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in))), _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 16)), 1);
+			__m256i const r1 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 4))), _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 20)), 1);
+			__m256i const r2 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 8))), _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 24)), 1);
+			__m256i const r3 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 12))), _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 28)), 1);
+			__m256i const t0 = _mm256_unpacklo_epi32(r0, r1);
+			__m256i const t1 = _mm256_unpacklo_epi32(r2, r3);
+			__m256i const t2 = _mm256_unpackhi_epi32(r0, r1);
+			__m256i const t3 = _mm256_unpackhi_epi32(r2, r3);
+			x.data = _mm256_unpacklo_epi64(t0, t1);
+			y.data = _mm256_unpackhi_epi64(t0, t1);
+			z.data = _mm256_unpacklo_epi64(t2, t3);
+			w.data = _mm256_unpackhi_epi64(t2, t3);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			for(int h = 0; h < 2; ++h)
+			{
+				__m128i const r0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 16 * h));
+				__m128i const r1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 16 * h + 4));
+				__m128i const r2 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 16 * h + 8));
+				__m128i const r3 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 16 * h + 12));
+				__m128i const t0 = _mm_unpacklo_epi32(r0, r1);
+				__m128i const t1 = _mm_unpacklo_epi32(r2, r3);
+				__m128i const t2 = _mm_unpackhi_epi32(r0, r1);
+				__m128i const t3 = _mm_unpackhi_epi32(r2, r3);
+				x.data[h] = _mm_unpacklo_epi64(t0, t1);
+				y.data[h] = _mm_unpackhi_epi64(t0, t1);
+				z.data[h] = _mm_unpacklo_epi64(t2, t3);
+				w.data[h] = _mm_unpackhi_epi64(t2, t3);
+			}
+#		else
+			for(int i = 0; i < 8; ++i)
+			{
+				x.data[i] = in[4 * i];
+				y.data[i] = in[4 * i + 1];
+				z.data[i] = in[4 * i + 2];
+				w.data[i] = in[4 * i + 3];
+			}
+#		endif
+	}
+
+	// The first count vectors of lanes of x, y, z and w, up to eight
+	GLM_FUNC_QUALIFIER void batch_interleave(batch_intx8 const & x, batch_intx8 const & y, batch_intx8 const & z, batch_intx8 const & w, uint32 * out, std::size_t count)
+	{
+		uint32 Packed[32];
+		uint32 * p = count < 8 ? Packed : out;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m256i const t0 = _mm256_unpacklo_epi32(x.data, y.data);
+			__m256i const t1 = _mm256_unpacklo_epi32(z.data, w.data);
+			__m256i const t2 = _mm256_unpackhi_epi32(x.data, y.data);
+			__m256i const t3 = _mm256_unpackhi_epi32(z.data, w.data);
+			__m256i const r0 = _mm256_unpacklo_epi64(t0, t1);
+			__m256i const r1 = _mm256_unpackhi_epi64(t0, t1);
+			__m256i const r2 = _mm256_unpacklo_epi64(t2, t3);
+			__m256i const r3 = _mm256_unpackhi_epi64(t2, t3);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm256_castsi256_si128(r0));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 4), _mm256_castsi256_si128(r1));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 8), _mm256_castsi256_si128(r2));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 12), _mm256_castsi256_si128(r3));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 16), _mm256_extracti128_si256(r0, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 20), _mm256_extracti128_si256(r1, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 24), _mm256_extracti128_si256(r2, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 28), _mm256_extracti128_si256(r3, 1));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			for(int h = 0; h < 2; ++h)
+			{
+				__m128i const t0 = _mm_unpacklo_epi32(x.data[h], y.data[h]);
+				__m128i const t1 = _mm_unpacklo_epi32(z.data[h], w.data[h]);
+				__m128i const t2 = _mm_unpackhi_epi32(x.data[h], y.data[h]);
+				__m128i const t3 = _mm_unpackhi_epi32(z.data[h], w.data[h]);
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 16 * h), _mm_unpacklo_epi64(t0, t1));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 16 * h + 4), _mm_unpackhi_epi64(t0, t1));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 16 * h + 8), _mm_unpacklo_epi64(t2, t3));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 16 * h + 12), _mm_unpackhi_epi64(t2, t3));
+			}
+#		else
+			for(int i = 0; i < 8; ++i)
+			{
+				p[4 * i] = x.data[i];
+				p[4 * i + 1] = y.data[i];
+				p[4 * i + 2] = z.data[i];
+				p[4 * i + 3] = w.data[i];
+			}
+#		endif
+		if(count < 8)
+			std::memcpy(out, Packed, count * 4 * sizeof(uint32));
+	}
+
+	// The low 10 bits of x, y and z from the lowest bit, the low 2 bits of w on top
+	GLM_FUNC_QUALIFIER batch_intx8 batch_bits3x10_1x2(batch_intx8 const & x, batch_intx8 const & y, batch_intx8 const & z, batch_intx8 const & w)
+	{
+		batch_intx8 const Mask = batch_int(0x3ff);
+		batch_intx8 Result = batch_and(x, Mask);
+		Result = batch_or(Result, batch_shl(batch_and(y, Mask), 10));
+		Result = batch_or(Result, batch_shl(batch_and(z, Mask), 20));
+		return batch_or(Result, batch_shl(w, 30));
+	}
+
+	// The fields of p, sign extended when Signed
+	GLM_FUNC_QUALIFIER void batch_fields3x10_1x2(batch_intx8 const & p, bool Signed, batch_intx8 & x, batch_intx8 & y, batch_intx8 & z, batch_intx8 & w)
+	{
+		if(Signed)
+		{
+			x = batch_sar(batch_shl(p, 22), 22);
+			y = batch_sar(batch_shl(p, 12), 22);
+			z = batch_sar(batch_shl(p, 2), 22);
+			w = batch_sar(p, 30);
+		}
+		else
+		{
+			batch_intx8 const Mask = batch_int(0x3ff);
+			x = batch_and(p, Mask);
+			y = batch_and(batch_shr(p, 10), Mask);
+			z = batch_and(batch_shr(p, 20), Mask);
+			w = batch_shr(p, 30);
+		}
+	}
+
+	// Three 10 bits components and a 2 bits one, eight vectors at a time
+	GLM_FUNC_QUALIFIER void batch_pack3x10_1x2(vec4 const * in, uint32 * out, std::size_t count, float Min, float Scale, float ScaleW)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			vec4x8 const v = wideGather(in + i, count - i);
+			batch_store(batch_bits3x10_1x2(
+				batch_quantize(v.x, Min, Scale),
+				batch_quantize(v.y, Min, Scale),
+				batch_quantize(v.z, Min, Scale),
+				batch_quantize(v.w, Min, ScaleW)), out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void batch_unpack3x10_1x2(uint32 const * in, vec4 * out, std::size_t count, bool Signed, float Scale, float ScaleW)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			batch_intx8 x, y, z, w;
+			batch_fields3x10_1x2(batch_load(in + i, count - i), Signed, x, y, z, w);
+			vec4x8 const Result(
+				batch_dequantize(x, Signed, Scale),
+				batch_dequantize(y, Signed, Scale),
+				batch_dequantize(z, Signed, Scale),
+				batch_dequantize(w, Signed, ScaleW));
+			wideScatter(Result, out + i, count - i);
+		}
+	}
+
+	/* Integer vectors, four 32 bits values each: the low bits of every
+	component like the bit fields of packI3x10_1x2 and packU3x10_1x2 */
+	GLM_FUNC_QUALIFIER void batch_pack3x10_1x2(uint32 const * in, uint32 * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			batch_intx8 x, y, z, w;
+			batch_deinterleave(in + 4 * i, count - i, x, y, z, w);
+			batch_store(batch_bits3x10_1x2(x, y, z, w), out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void batch_unpack3x10_1x2(uint32 const * in, uint32 * out, std::size_t count, bool Signed)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			batch_intx8 x, y, z, w;
+			batch_fields3x10_1x2(batch_load(in + i, count - i), Signed, x, y, z, w);
+			batch_interleave(x, y, z, w, out + 4 * i, count - i);
+		}
+	}
+
+	/* Unsigned float with 5 bits of exponent and Bits of significand, 6 or
+	5, as floatTo11bit and floatTo10bit: the normal ones are the float bits
+	rebiased and truncated, the denormal ones the value in steps of 2^-14 >> Bits */
+	GLM_FUNC_QUALIFIER batch_intx8 batch_pack_float(floatx8 const & v, int Bits)
+	{
+		floatx8 const Smallest(6.103515625e-05f); // 2^-14
+		batch_intx8 const Normal = batch_shr(batch_sub(batch_bits(v), batch_int(0x38000000)), 23 - Bits);
+		batch_intx8 const Denormal = batch_trunc(min(Smallest, max(floatx8(0.0f), v)) * float(1 << (14 + Bits)));
+		batch_intx8 Result = batch_select(v < Smallest, Denormal, Normal);
+		Result = batch_select(v >= floatx8(65536.0f), batch_int(0x1fu << Bits), Result);
+		Result = batch_select(!(v > floatx8(0.0f)), batch_int(0), Result);
+		return batch_select(v != v, batch_int((0x20u << Bits) - 1), Result);
+	}
+
+	// Float of the 5 + Bits low bits of v, as packed11bitToFloat and packed10bitToFloat
+	GLM_FUNC_QUALIFIER floatx8 batch_unpack_float(batch_intx8 const & v, int Bits)
+	{
+		batch_intx8 const Exponent = batch_shr(v, Bits);
+		// Bias from 15 to 127, or the float exponent of infinity and NaN
+		batch_intx8 const Bias = batch_select(batch_equal(Exponent, batch_int(0x1f)), batch_int(0x70000000), batch_int(0x38000000));
+		floatx8 const Normal = batch_float_bits(batch_add(batch_shl(v, 23 - Bits), Bias));
+		floatx8 const Denormal = batch_float(v) * (1.0f / float(1 << (14 + Bits)));
+		return select(batch_equal(Exponent, batch_int(0)), Denormal, Normal);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void packUnorm1x8(float const * in, uint8 * out, std::size_t count)
+	{
+		detail::batch_pack8(in, reinterpret_cast<uint8 *>(out), count, 0.0f, 255.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x8(uint8 const * in, float * out, std::size_t count)
+	{
+		detail::batch_unpack8(reinterpret_cast<uint8 const *>(in), out, count, false, static_cast<float>(0.0039215686274509803921568627451));
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x8(float const * in, uint8 * out, std::size_t count)
+	{
+		detail::batch_pack8(in, reinterpret_cast<uint8 *>(out), count, -1.0f, 127.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x8(uint8 const * in, float * out, std::size_t count)
+	{
+		detail::batch_unpack8(reinterpret_cast<uint8 const *>(in), out, count, true, 0.00787401574803149606299212598425f);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm2x8(vec2 const * in, uint16 * out, std::size_t count)
+	{
+		detail::batch_pack8(reinterpret_cast<float const *>(in), reinterpret_cast<uint8 *>(out), 2 * count, 0.0f, 255.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm2x8(uint16 const * in, vec2 * out, std::size_t count)
+	{
+		detail::batch_unpack8(reinterpret_cast<uint8 const *>(in), reinterpret_cast<float *>(out), 2 * count, false, static_cast<float>(0.0039215686274509803921568627451));
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm2x8(vec2 const * in, uint16 * out, std::size_t count)
+	{
+		detail::batch_pack8(reinterpret_cast<float const *>(in), reinterpret_cast<uint8 *>(out), 2 * count, -1.0f, 127.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm2x8(uint16 const * in, vec2 * out, std::size_t count)
+	{
+		detail::batch_unpack8(reinterpret_cast<uint8 const *>(in), reinterpret_cast<float *>(out), 2 * count, true, 0.00787401574803149606299212598425f);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x8(vec4 const * in, uint32 * out, std::size_t count)
+	{
+		detail::batch_pack8(reinterpret_cast<float const *>(in), reinterpret_cast<uint8 *>(out), 4 * count, 0.0f, 255.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x8(uint32 const * in, vec4 * out, std::size_t count)
+	{
+		detail::batch_unpack8(reinterpret_cast<uint8 const *>(in), reinterpret_cast<float *>(out), 4 * count, false, 0.0039215686274509803921568627451f);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm4x8(vec4 const * in, uint32 * out, std::size_t count)
+	{
+		detail::batch_pack8(reinterpret_cast<float const *>(in), reinterpret_cast<uint8 *>(out), 4 * count, -1.0f, 127.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm4x8(uint32 const * in, vec4 * out, std::size_t count)
+	{
+		detail::batch_unpack8(reinterpret_cast<uint8 const *>(in), reinterpret_cast<float *>(out), 4 * count, true, 0.0078740157480315f);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x16(float const * in, uint16 * out, std::size_t count)
+	{
+		detail::batch_pack16(in, reinterpret_cast<uint16 *>(out), count, 0.0f, 65535.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x16(uint16 const * in, float * out, std::size_t count)
+	{
+		detail::batch_unpack16(reinterpret_cast<uint16 const *>(in), out, count, false, 1.5259021896696421759365224689097e-5f);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x16(float const * in, uint16 * out, std::size_t count)
+	{
+		detail::batch_pack16(in, reinterpret_cast<uint16 *>(out), count, -1.0f, 32767.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x16(uint16 const * in, float * out, std::size_t count)
+	{
+		detail::batch_unpack16(reinterpret_cast<uint16 const *>(in), out, count, true, 3.0518509475997192297128208258309e-5f);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm2x16(vec2 const * in, uint32 * out, std::size_t count)
+	{
+		detail::batch_pack16(reinterpret_cast<float const *>(in), reinterpret_cast<uint16 *>(out), 2 * count, 0.0f, 65535.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm2x16(uint32 const * in, vec2 * out, std::size_t count)
+	{
+		detail::batch_unpack16(reinterpret_cast<uint16 const *>(in), reinterpret_cast<float *>(out), 2 * count, false, 1.5259021896696421759365224689097e-5f);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm2x16(vec2 const * in, uint32 * out, std::size_t count)
+	{
+		detail::batch_pack16(reinterpret_cast<float const *>(in), reinterpret_cast<uint16 *>(out), 2 * count, -1.0f, 32767.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm2x16(uint32 const * in, vec2 * out, std::size_t count)
+	{
+		detail::batch_unpack16(reinterpret_cast<uint16 const *>(in), reinterpret_cast<float *>(out), 2 * count, true, 3.0518509475997192297128208258309e-5f);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x16(vec4 const * in, uint64 * out, std::size_t count)
+	{
+		detail::batch_pack16(reinterpret_cast<float const *>(in), reinterpret_cast<uint16 *>(out), 4 * count, 0.0f, 65535.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x16(uint64 const * in, vec4 * out, std::size_t count)
+	{
+		detail::batch_unpack16(reinterpret_cast<uint16 const *>(in), reinterpret_cast<float *>(out), 4 * count, false, 1.5259021896696421759365224689097e-5f);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm4x16(vec4 const * in, uint64 * out, std::size_t count)
+	{
+		detail::batch_pack16(reinterpret_cast<float const *>(in), reinterpret_cast<uint16 *>(out), 4 * count, -1.0f, 32767.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm4x16(uint64 const * in, vec4 * out, std::size_t count)
+	{
+		detail::batch_unpack16(reinterpret_cast<uint16 const *>(in), reinterpret_cast<float *>(out), 4 * count, true, 3.0518509475997192297128208258309e-5f);
+	}
+
+	GLM_FUNC_QUALIFIER void packI3x10_1x2(ivec4 const * in, uint32 * out, std::size_t count)
+	{
+		detail::batch_pack3x10_1x2(reinterpret_cast<uint32 const *>(in), out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackI3x10_1x2(uint32 const * in, ivec4 * out, std::size_t count)
+	{
+		detail::batch_unpack3x10_1x2(in, reinterpret_cast<uint32 *>(out), count, true);
+	}
+
+	GLM_FUNC_QUALIFIER void packU3x10_1x2(uvec4 const * in, uint32 * out, std::size_t count)
+	{
+		detail::batch_pack3x10_1x2(reinterpret_cast<uint32 const *>(in), out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackU3x10_1x2(uint32 const * in, uvec4 * out, std::size_t count)
+	{
+		detail::batch_unpack3x10_1x2(in, reinterpret_cast<uint32 *>(out), count, false);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm3x10_1x2(vec4 const * in, uint32 * out, std::size_t count)
+	{
+		detail::batch_pack3x10_1x2(in, out, count, 0.0f, 1023.f, 3.f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm3x10_1x2(uint32 const * in, vec4 * out, std::size_t count)
+	{
+		detail::batch_unpack3x10_1x2(in, out, count, false, 1023.f, 3.f);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2(vec4 const * in, uint32 * out, std::size_t count)
+	{
+		detail::batch_pack3x10_1x2(in, out, count, -1.0f, 511.f, 1.f);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2(uint32 const * in, vec4 * out, std::size_t count)
+	{
+		detail::batch_unpack3x10_1x2(in, out, count, true, 511.f, 1.f);
+	}
+
+	GLM_FUNC_QUALIFIER void packF2x11_1x10(vec3 const * in, uint32 * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			vec3x8 const v = wideGather(in + i, count - i);
+			detail::batch_intx8 Result = detail::batch_or(detail::batch_pack_float(v.x, 6), detail::batch_shl(detail::batch_pack_float(v.y, 6), 11));
+			Result = detail::batch_or(Result, detail::batch_shl(detail::batch_pack_float(v.z, 5), 22));
+			detail::batch_store(Result, out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void unpackF2x11_1x10(uint32 const * in, vec3 * out, std::size_t count)
+	{
+		detail::batch_intx8 const Mask = detail::batch_int(0x7ff);
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			detail::batch_intx8 const p = detail::batch_load(in + i, count - i);
+			vec3x8 const Result(
+				detail::batch_unpack_float(detail::batch_and(p, Mask), 6),
+				detail::batch_unpack_float(detail::batch_and(detail::batch_shr(p, 11), Mask), 6),
+				detail::batch_unpack_float(detail::batch_shr(p, 22), 5));
+			wideScatter(Result, out + i, count - i);
+		}
+	}
+}//namespace glm
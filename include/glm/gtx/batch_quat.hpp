@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_quat
+/// @file glm/gtx/batch_quat.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_wide (dependence)
+///
+/// @defgroup gtx_batch_quat GLM_GTX_batch_quat
+/// @ingroup gtx
+/// 
+/// @brief Normalize, multiply, interpolate and convert arrays of quaternions.
+/// 
+/// The quaternions are loaded eight at a time into GLM_GTX_wide registers, one
+/// per component, so every function runs the scalar formula on eight lanes.
+/// The instruction set follows GLM_BATCH_ARCH like GLM_GTX_wide.
+/// Each element only depends on its own inputs: split the arrays in ranges to
+/// spread a large batch (the bones of many skeletons) over several threads.
+/// The results match the GLM_GTC_quaternion functions up to rounding. slerp
+/// uses polynomial acos and sin, within 1e-6 of the scalar version for
+/// interpolation factors in [0, 1].
+/// 
+/// <glm/gtx/batch_quat.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependencies
+#include "../mat3x3.hpp"
+#include "../mat4x4.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/wide.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_batch_quat extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_quat
+	/// @{
+
+	/// out[i] = normalize(in[i]), zero length quaternions give the identity.
+	/// out may be in.
+	/// @see gtx_batch_quat
+	GLM_FUNC_DECL void normalizeQuats(
+		quat const * in,
+		quat * out,
+		std::size_t count);
+
+	/// out[i] = a[i] * b[i]. out may be a or b.
+	/// @see gtx_batch_quat
+	GLM_FUNC_DECL void multiplyQuats(
+		quat const * a,
+		quat const * b,
+		quat * out,
+		std::size_t count);
+
+	/// out[i] = normalize(mix(x[i], y[i], a)) along the shortest path:
+	/// y[i] is negated when dot(x[i], y[i]) < 0. out may be x or y.
+	/// @see gtx_batch_quat
+	GLM_FUNC_DECL void nlerpQuats(
+		quat const * x,
+		quat const * y,
+		float a,
+		quat * out,
+		std::size_t count);
+
+	/// Same with one interpolation factor per quaternion.
+	/// @see gtx_batch_quat
+	GLM_FUNC_DECL void nlerpQuats(
+		quat const * x,
+		quat const * y,
+		float const * a,
+		quat * out,
+		std::size_t count);
+
+	/// out[i] = slerp(x[i], y[i], a), shortest path, linear when the
+	/// quaternions are too close for the sine to be divided by. out may be x or y.
+	/// @see gtx_batch_quat
+	GLM_FUNC_DECL void slerpQuats(
+		quat const * x,
+		quat const * y,
+		float a,
+		quat * out,
+		std::size_t count);
+
+	/// Same with one interpolation factor per quaternion.
+	/// @see gtx_batch_quat
+	GLM_FUNC_DECL void slerpQuats(
+		quat const * x,
+		quat const * y,
+		float const * a,
+		quat * out,
+		std::size_t count);
+
+	/// out[i] = mat3_cast(in[i]).
+	/// @see gtx_batch_quat
+	GLM_FUNC_DECL void quatsToMat3(
+		quat const * in,
+		mat3 * out,
+		std::size_t count);
+
+	/// out[i] = mat4_cast(in[i]).
+	/// @see gtx_batch_quat
+	GLM_FUNC_DECL void quatsToMat4(
+		quat const * in,
+		mat4 * out,
+		std::size_t count);
+
+	/// @}
+}// namespace glm
+
+#include "batch_quat.inl"
@@ -0,0 +1,312 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_quat
+/// @file glm/gtx/batch_quat.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// tquat and tvec4 both store x, y, z and w in that order
+	GLM_FUNC_QUALIFIER vec4x8 batch_quat_load(quat const * in, std::size_t count)
+	{
+		return wideGather(reinterpret_cast<vec4 const *>(in), count);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_quat_store(vec4x8 const & q, quat * out, std::size_t count)
+	{
+		wideScatter(q, reinterpret_cast<vec4 *>(out), count);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 batch_quat_factors(float const * a, std::size_t count)
+	{
+		if(count >= 8)
+			return wideLoad(a);
+		float Packed[8] = {0};
+		std::memcpy(Packed, a, count * sizeof(float));
+		return wideLoad(Packed);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 batch_quat_mul(vec4x8 const & p, vec4x8 const & q)
+	{
+		return vec4x8(
+			p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y,
+			p.w * q.y + p.y * q.w + p.z * q.x - p.x * q.z,
+			p.w * q.z + p.z * q.w + p.x * q.y - p.y * q.x,
+			p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 batch_quat_normalize(vec4x8 const & q)
+	{
+		floatx8 const LengthSq = dot(q, q);
+		vec4x8 const Identity(floatx8(0.0f), floatx8(0.0f), floatx8(0.0f), floatx8(1.0f));
+		return select(LengthSq > floatx8(0.0f), q * inversesqrt(LengthSq), Identity);
+	}
+
+	// y, negated in the lanes where it is on the far side of x, and |dot(x, y)|
+	GLM_FUNC_QUALIFIER vec4x8 batch_quat_closest(vec4x8 const & x, vec4x8 const & y, floatx8 & cosTheta)
+	{
+		cosTheta = dot(x, y);
+		boolx8 const Flip = cosTheta < floatx8(0.0f);
+		cosTheta = abs(cosTheta);
+		return select(Flip, -y, y);
+	}
+
+	// acos(x) for x in [0, 1], Abramowitz and Stegun 4.4.46, error below 2e-8
+	GLM_FUNC_QUALIFIER floatx8 batch_quat_acos(floatx8 const & x)
+	{
+		floatx8 p(-0.0012624911f);
+		p = fma(p, x, floatx8(0.0066700901f));
+		p = fma(p, x, floatx8(-0.0170881256f));
+		p = fma(p, x, floatx8(0.0308918810f));
+		p = fma(p, x, floatx8(-0.0501743046f));
+		p = fma(p, x, floatx8(0.0889789874f));
+		p = fma(p, x, floatx8(-0.2145988016f));
+		p = fma(p, x, floatx8(1.5707963050f));
+		return sqrt(1.0f - x) * p;
+	}
+
+	// sin(x) for x in [-pi/2, pi/2], Taylor series up to x^11, error below 6e-8
+	GLM_FUNC_QUALIFIER floatx8 batch_quat_sin(floatx8 const & x)
+	{
+		floatx8 const x2 = x * x;
+		floatx8 p(-2.5052108e-8f);
+		p = fma(p, x2, floatx8(2.7557319e-6f));
+		p = fma(p, x2, floatx8(-1.9841270e-4f));
+		p = fma(p, x2, floatx8(8.3333333e-3f));
+		p = fma(p, x2, floatx8(-1.6666667e-1f));
+		return fma(p * x2, x, x);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 batch_quat_nlerp(vec4x8 const & x, vec4x8 const & y, floatx8 const & a)
+	{
+		floatx8 CosTheta;
+		vec4x8 const z = batch_quat_closest(x, y, CosTheta);
+		return batch_quat_normalize(mix(x, z, a));
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 batch_quat_slerp(vec4x8 const & x, vec4x8 const & y, floatx8 const & a)
+	{
+		floatx8 CosTheta;
+		vec4x8 const z = batch_quat_closest(x, y, CosTheta);
+
+		// Both results are computed, the lanes too close for the division take the linear one
+		floatx8 const Angle = batch_quat_acos(min(CosTheta, floatx8(1.0f)));
+		vec4x8 const Spherical = (x * batch_quat_sin((1.0f - a) * Angle) + z * batch_quat_sin(a * Angle)) / batch_quat_sin(Angle);
+		return select(CosTheta > floatx8(1.0f - epsilon<float>()), mix(x, z, a), Spherical);
+	}
+
+	// mat3_cast of every lane, the nine components in column major order
+	GLM_FUNC_QUALIFIER void batch_quat_mat3(vec4x8 const & q, floatx8 (&m)[9])
+	{
+		floatx8 const qxx(q.x * q.x);
+		floatx8 const qyy(q.y * q.y);
+		floatx8 const qzz(q.z * q.z);
+		floatx8 const qxz(q.x * q.z);
+		floatx8 const qxy(q.x * q.y);
+		floatx8 const qyz(q.y * q.z);
+		floatx8 const qwx(q.w * q.x);
+		floatx8 const qwy(q.w * q.y);
+		floatx8 const qwz(q.w * q.z);
+
+		m[0] = 1.0f - 2.0f * (qyy + qzz);
+		m[1] = 2.0f * (qxy + qwz);
+		m[2] = 2.0f * (qxz - qwy);
+
+		m[3] = 2.0f * (qxy - qwz);
+		m[4] = 1.0f - 2.0f * (qxx + qzz);
+		m[5] = 2.0f * (qyz + qwx);
+
+		m[6] = 2.0f * (qxz + qwy);
+		m[7] = 2.0f * (qyz - qwx);
+		m[8] = 1.0f - 2.0f * (qxx + qyy);
+	}
+
+#	if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+	// Lanes 4 * h to 4 * h + 3 of v
+	GLM_FUNC_QUALIFIER __m128 batch_quat_half(floatx8 const & v, int h)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return h == 0 ? _mm256_castps256_ps128(v.data) : _mm256_extractf128_ps(v.data, 1);
+#		else
+			return v.data[h];
+#		endif
+	}
+
+	// Lane j of a, b, c and d as one register, for the four lanes of half h
+	GLM_FUNC_QUALIFIER void batch_quat_transpose(floatx8 const & a, floatx8 const & b, floatx8 const & c, floatx8 const & d, int h, __m128 (&lanes)[4])
+	{
+		lanes[0] = batch_quat_half(a, h);
+		lanes[1] = batch_quat_half(b, h);
+		lanes[2] = batch_quat_half(c, h);
+		lanes[3] = batch_quat_half(d, h);
+		_MM_TRANSPOSE4_PS(lanes[0], lanes[1], lanes[2], lanes[3]);
+	}
+#	endif
+
+	// Lane k of the components to out[k], for k < count
+	GLM_FUNC_QUALIFIER void batch_quat_store(floatx8 const (&m)[9], mat3 * out, std::size_t count)
+	{
+#		if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+			float Last[8];
+			wideStore(m[8], Last);
+			for(int h = 0; h < 2 && std::size_t(4 * h) < count; ++h)
+			{
+				__m128 Low[4];
+				__m128 High[4];
+				batch_quat_transpose(m[0], m[1], m[2], m[3], h, Low);
+				batch_quat_transpose(m[4], m[5], m[6], m[7], h, High);
+				for(int j = 0; j < 4 && std::size_t(4 * h + j) < count; ++j)
+				{
+					float * p = &out[4 * h + j][0][0];
+					_mm_storeu_ps(p, Low[j]);
+					_mm_storeu_ps(p + 4, High[j]);
+					p[8] = Last[4 * h + j];
+				}
+			}
+#		else
+			for(std::size_t k = 0; k < count && k < 8; ++k)
+			{
+				float * p = &out[k][0][0];
+				for(length_t j = 0; j < 9; ++j)
+					p[j] = m[j].data[k];
+			}
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batch_quat_store(floatx8 const (&m)[9], mat4 * out, std::size_t count)
+	{
+#		if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+			floatx8 const Zero(0.0f);
+			__m128 const LastColumn = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+			for(int h = 0; h < 2 && std::size_t(4 * h) < count; ++h)
+			{
+				__m128 Columns[3][4];
+				for(int c = 0; c < 3; ++c)
+					batch_quat_transpose(m[3 * c], m[3 * c + 1], m[3 * c + 2], Zero, h, Columns[c]);
+				for(int j = 0; j < 4 && std::size_t(4 * h + j) < count; ++j)
+				{
+					float * p = &out[4 * h + j][0][0];
+					_mm_storeu_ps(p, Columns[0][j]);
+					_mm_storeu_ps(p + 4, Columns[1][j]);
+					_mm_storeu_ps(p + 8, Columns[2][j]);
+					_mm_storeu_ps(p + 12, LastColumn);
+				}
+			}
+#		else
+			for(std::size_t k = 0; k < count && k < 8; ++k)
+			{
+				out[k] = mat4(1.0f);
+				for(length_t c = 0; c < 3; ++c)
+					for(length_t r = 0; r < 3; ++r)
+						out[k][c][r] = m[3 * c + r].data[k];
+			}
+#		endif
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void normalizeQuats(quat const * in, quat * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+			detail::batch_quat_store(detail::batch_quat_normalize(detail::batch_quat_load(in + i, count - i)), out + i, count - i);
+	}
+
+	GLM_FUNC_QUALIFIER void multiplyQuats(quat const * a, quat const * b, quat * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			vec4x8 const p = detail::batch_quat_load(a + i, count - i);
+			vec4x8 const q = detail::batch_quat_load(b + i, count - i);
+			detail::batch_quat_store(detail::batch_quat_mul(p, q), out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void nlerpQuats(quat const * x, quat const * y, float a, quat * out, std::size_t count)
+	{
+		floatx8 const Factor(a);
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			vec4x8 const p = detail::batch_quat_load(x + i, count - i);
+			vec4x8 const q = detail::batch_quat_load(y + i, count - i);
+			detail::batch_quat_store(detail::batch_quat_nlerp(p, q, Factor), out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void nlerpQuats(quat const * x, quat const * y, float const * a, quat * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			vec4x8 const p = detail::batch_quat_load(x + i, count - i);
+			vec4x8 const q = detail::batch_quat_load(y + i, count - i);
+			detail::batch_quat_store(detail::batch_quat_nlerp(p, q, detail::batch_quat_factors(a + i, count - i)), out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void slerpQuats(quat const * x, quat const * y, float a, quat * out, std::size_t count)
+	{
+		floatx8 const Factor(a);
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			vec4x8 const p = detail::batch_quat_load(x + i, count - i);
+			vec4x8 const q = detail::batch_quat_load(y + i, count - i);
+			detail::batch_quat_store(detail::batch_quat_slerp(p, q, Factor), out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void slerpQuats(quat const * x, quat const * y, float const * a, quat * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			vec4x8 const p = detail::batch_quat_load(x + i, count - i);
+			vec4x8 const q = detail::batch_quat_load(y + i, count - i);
+			detail::batch_quat_store(detail::batch_quat_slerp(p, q, detail::batch_quat_factors(a + i, count - i)), out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void quatsToMat3(quat const * in, mat3 * out, std::size_t count)
+	{
+		floatx8 Components[9];
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			detail::batch_quat_mat3(detail::batch_quat_load(in + i, count - i), Components);
+			detail::batch_quat_store(Components, out + i, count - i);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void quatsToMat4(quat const * in, mat4 * out, std::size_t count)
+	{
+		floatx8 Components[9];
+		for(std::size_t i = 0; i < count; i += 8)
+		{
+			detail::batch_quat_mat3(detail::batch_quat_load(in + i, count - i), Components);
+			detail::batch_quat_store(Components, out + i, count - i);
+		}
+	}
+}//namespace glm
@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_transform
+/// @file glm/gtx/batch_transform.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_batch_transform GLM_GTX_batch_transform
+/// @ingroup gtx
+/// 
+/// @brief Transform arrays of points and vectors by one matrix or by one matrix each.
+/// 
+/// Array in, array out: AoS (packed or strided) or SoA inputs, with AVX2/FMA
+/// and SSE2 kernels chosen at compile time and a scalar fallback.
+/// These functions only read and write plain float arrays, so unlike the rest
+/// of GLM they use the instruction set the compiler targets even when
+/// GLM_FORCE_PURE is defined. Define GLM_FORCE_BATCH_PURE to keep them scalar.
+/// FMA rounds once per multiply add, so the AVX2 results may differ from
+/// matrix * vector in the last bit.
+/// 
+/// <glm/gtx/batch_transform.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependencies
+#include "../mat4x4.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include "../detail/batch_simd.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_batch_transform extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_transform
+	/// @{
+
+	/// Name of the kernels compiled in: "AVX2+FMA", "SSE2" or "scalar".
+	/// @see gtx_batch_transform
+	GLM_FUNC_DECL char const * batchTransformArch();
+
+	/// out[i] = vec3(m * vec4(in[i], 1)), no perspective divide.
+	/// in and out may be the same array, other overlaps are not supported.
+	/// @see gtx_batch_transform
+	GLM_FUNC_DECL void transformPoints(
+		mat4 const & m,
+		vec3 const * in,
+		vec3 * out,
+		std::size_t count);
+
+	/// out[i] = vec3(m * vec4(in[i], 0)), normals need the inverse transpose.
+	/// @see gtx_batch_transform
+	GLM_FUNC_DECL void transformDirections(
+		mat4 const & m,
+		vec3 const * in,
+		vec3 * out,
+		std::size_t count);
+
+	/// out[i] = m * in[i].
+	/// @see gtx_batch_transform
+	GLM_FUNC_DECL void transformVectors(
+		mat4 const & m,
+		vec4 const * in,
+		vec4 * out,
+		std::size_t count);
+
+	/// out[i] = vec3(m[i] * vec4(in[i], 1)), one matrix per point (skinning, instances).
+	/// @see gtx_batch_transform
+	GLM_FUNC_DECL void transformPoints(
+		mat4 const * m,
+		vec3 const * in,
+		vec3 * out,
+		std::size_t count);
+
+	/// Points given as three floats every inStride bytes (a position inside
+	/// a vertex struct for instance), written every outStride bytes.
+	/// @see gtx_batch_transform
+	GLM_FUNC_DECL void transformPointsStrided(
+		mat4 const & m,
+		void const * in, std::size_t inStride,
+		void * out, std::size_t outStride,
+		std::size_t count);
+
+	/// Directions given as three floats every inStride bytes.
+	/// @see gtx_batch_transform
+	GLM_FUNC_DECL void transformDirectionsStrided(
+		mat4 const & m,
+		void const * in, std::size_t inStride,
+		void * out, std::size_t outStride,
+		std::size_t count);
+
+	/// Points given as separate x, y and z arrays (structure of arrays).
+	/// The outputs may be the inputs.
+	/// @see gtx_batch_transform
+	GLM_FUNC_DECL void transformPointsSoA(
+		mat4 const & m,
+		float const * x, float const * y, float const * z,
+		float * outX, float * outY, float * outZ,
+		std::size_t count);
+
+	/// Directions given as separate x, y and z arrays.
+	/// @see gtx_batch_transform
+	GLM_FUNC_DECL void transformDirectionsSoA(
+		mat4 const & m,
+		float const * x, float const * y, float const * z,
+		float * outX, float * outY, float * outZ,
+		std::size_t count);
+
+	/// @}
+}// namespace glm
+
+#include "batch_transform.inl"
@@ -0,0 +1,296 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_transform
+/// @file glm/gtx/batch_transform.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	// Column major, m[c * 4 + r]
+	GLM_FUNC_QUALIFIER float const * batch_columns(mat4 const & m)
+	{
+		return &m[0][0];
+	}
+
+	// Scalar reference, w is 1 for points and 0 for directions
+	GLM_FUNC_QUALIFIER void batch_affine_scalar(float const * m, float const * in, float * out, float w)
+	{
+		float const x = in[0], y = in[1], z = in[2];
+		out[0] = m[0] * x + m[4] * y + m[8] * z + m[12] * w;
+		out[1] = m[1] * x + m[5] * y + m[9] * z + m[13] * w;
+		out[2] = m[2] * x + m[6] * y + m[10] * z + m[14] * w;
+	}
+
+	GLM_FUNC_QUALIFIER void batch_vec4_scalar(float const * m, float const * in, float * out)
+	{
+		float const x = in[0], y = in[1], z = in[2], w = in[3];
+		out[0] = m[0] * x + m[4] * y + m[8] * z + m[12] * w;
+		out[1] = m[1] * x + m[5] * y + m[9] * z + m[13] * w;
+		out[2] = m[2] * x + m[6] * y + m[10] * z + m[14] * w;
+		out[3] = m[3] * x + m[7] * y + m[11] * z + m[15] * w;
+	}
+
+#	if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+	// One point against columns c0, c1, c2 and the translation already scaled by w.
+	// Three floats in and out, never touching the fourth
+	GLM_FUNC_QUALIFIER void batch_affine_sse(__m128 const & c0, __m128 const & c1, __m128 const & c2, __m128 const & t, float const * in, float * out)
+	{
+		__m128 r = batch_madd(c0, _mm_set1_ps(in[0]), t);
+		r = batch_madd(c1, _mm_set1_ps(in[1]), r);
+		r = batch_madd(c2, _mm_set1_ps(in[2]), r);
+		_mm_storel_pi(reinterpret_cast<__m64*>(out), r);
+		_mm_store_ss(out + 2, _mm_movehl_ps(r, r));
+	}
+
+	// The rows of the matrix broadcast, four points at once
+	struct batch_rows4
+	{
+		__m128 m[12];
+
+		batch_rows4(float const * columns, float w)
+		{
+			for(int r = 0; r < 3; ++r)
+			{
+				m[r * 4 + 0] = _mm_set1_ps(columns[r]);
+				m[r * 4 + 1] = _mm_set1_ps(columns[r + 4]);
+				m[r * 4 + 2] = _mm_set1_ps(columns[r + 8]);
+				m[r * 4 + 3] = _mm_set1_ps(columns[r + 12] * w);
+			}
+		}
+	};
+
+	GLM_FUNC_QUALIFIER void batch_affine4(batch_rows4 const & rows, __m128 & x, __m128 & y, __m128 & z)
+	{
+		__m128 const * m = rows.m;
+		__m128 rx = batch_madd(m[0], x, batch_madd(m[1], y, batch_madd(m[2], z, m[3])));
+		__m128 ry = batch_madd(m[4], x, batch_madd(m[5], y, batch_madd(m[6], z, m[7])));
+		__m128 rz = batch_madd(m[8], x, batch_madd(m[9], y, batch_madd(m[10], z, m[11])));
+		x = rx;
+		y = ry;
+		z = rz;
+	}
+#	endif
+
+#	if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+	// out = m * (x, y, z, w) for eight points at once, row by row
+	GLM_FUNC_QUALIFIER void batch_affine8(float const * m, float w, __m256 & x, __m256 & y, __m256 & z)
+	{
+		__m256 rx = _mm256_fmadd_ps(_mm256_set1_ps(m[0]), x, _mm256_fmadd_ps(_mm256_set1_ps(m[4]), y, _mm256_fmadd_ps(_mm256_set1_ps(m[8]), z, _mm256_set1_ps(m[12] * w))));
+		__m256 ry = _mm256_fmadd_ps(_mm256_set1_ps(m[1]), x, _mm256_fmadd_ps(_mm256_set1_ps(m[5]), y, _mm256_fmadd_ps(_mm256_set1_ps(m[9]), z, _mm256_set1_ps(m[13] * w))));
+		__m256 rz = _mm256_fmadd_ps(_mm256_set1_ps(m[2]), x, _mm256_fmadd_ps(_mm256_set1_ps(m[6]), y, _mm256_fmadd_ps(_mm256_set1_ps(m[10]), z, _mm256_set1_ps(m[14] * w))));
+		x = rx;
+		y = ry;
+		z = rz;
+	}
+#	endif
+
+	GLM_FUNC_QUALIFIER void batch_affine(mat4 const & matrix, unsigned char const * in, std::size_t inStride, unsigned char * out, std::size_t outStride, std::size_t count, float w)
+	{
+		float const * m = batch_columns(matrix);
+		std::size_t i = 0;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			// Packed vec3, eight at a time. All 24 floats are read before any is written
+			if(inStride == 3 * sizeof(float) && outStride == 3 * sizeof(float))
+			{
+				for(; i + 8 <= count; i += 8)
+				{
+					__m256 x, y, z;
+					batch_deinterleave8(reinterpret_cast<float const *>(in + i * inStride), x, y, z);
+					batch_affine8(m, w, x, y, z);
+					batch_interleave8(x, y, z, reinterpret_cast<float *>(out + i * outStride));
+				}
+			}
+#		endif
+#		if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+			// Packed vec3 four at a time, then one by one
+			if(inStride == 3 * sizeof(float) && outStride == 3 * sizeof(float))
+			{
+				batch_rows4 const rows(m, w);
+				for(; i + 4 <= count; i += 4)
+				{
+					__m128 x, y, z;
+					batch_deinterleave4(reinterpret_cast<float const *>(in + i * inStride), x, y, z);
+					batch_affine4(rows, x, y, z);
+					batch_interleave4(x, y, z, reinterpret_cast<float *>(out + i * outStride));
+				}
+			}
+			__m128 const c0 = _mm_loadu_ps(m);
+			__m128 const c1 = _mm_loadu_ps(m + 4);
+			__m128 const c2 = _mm_loadu_ps(m + 8);
+			__m128 const t = _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(w));
+			for(; i < count; ++i)
+				batch_affine_sse(c0, c1, c2, t, reinterpret_cast<float const *>(in + i * inStride), reinterpret_cast<float *>(out + i * outStride));
+#		else
+			for(; i < count; ++i)
+				batch_affine_scalar(m, reinterpret_cast<float const *>(in + i * inStride), reinterpret_cast<float *>(out + i * outStride), w);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void batch_affine_soa(mat4 const & matrix, float const * x, float const * y, float const * z, float * outX, float * outY, float * outZ, std::size_t count, float w)
+	{
+		float const * m = batch_columns(matrix);
+		std::size_t i = 0;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			for(; i + 8 <= count; i += 8)
+			{
+				__m256 vx = _mm256_loadu_ps(x + i);
+				__m256 vy = _mm256_loadu_ps(y + i);
+				__m256 vz = _mm256_loadu_ps(z + i);
+				batch_affine8(m, w, vx, vy, vz);
+				_mm256_storeu_ps(outX + i, vx);
+				_mm256_storeu_ps(outY + i, vy);
+				_mm256_storeu_ps(outZ + i, vz);
+			}
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			batch_rows4 const rows(m, w);
+			for(; i + 4 <= count; i += 4)
+			{
+				__m128 vx = _mm_loadu_ps(x + i);
+				__m128 vy = _mm_loadu_ps(y + i);
+				__m128 vz = _mm_loadu_ps(z + i);
+				batch_affine4(rows, vx, vy, vz);
+				_mm_storeu_ps(outX + i, vx);
+				_mm_storeu_ps(outY + i, vy);
+				_mm_storeu_ps(outZ + i, vz);
+			}
+#		endif
+		for(; i < count; ++i)
+		{
+			float const in[3] = {x[i], y[i], z[i]};
+			float r[3];
+			batch_affine_scalar(m, in, r, w);
+			outX[i] = r[0];
+			outY[i] = r[1];
+			outZ[i] = r[2];
+		}
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER char const * batchTransformArch()
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return "AVX2+FMA";
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return "SSE2";
+#		else
+			return "scalar";
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void transformPoints(mat4 const & m, vec3 const * in, vec3 * out, std::size_t count)
+	{
+		detail::batch_affine(m, reinterpret_cast<unsigned char const *>(in), sizeof(vec3), reinterpret_cast<unsigned char *>(out), sizeof(vec3), count, 1.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void transformDirections(mat4 const & m, vec3 const * in, vec3 * out, std::size_t count)
+	{
+		detail::batch_affine(m, reinterpret_cast<unsigned char const *>(in), sizeof(vec3), reinterpret_cast<unsigned char *>(out), sizeof(vec3), count, 0.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void transformPointsStrided(mat4 const & m, void const * in, std::size_t inStride, void * out, std::size_t outStride, std::size_t count)
+	{
+		detail::batch_affine(m, static_cast<unsigned char const *>(in), inStride, static_cast<unsigned char *>(out), outStride, count, 1.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void transformDirectionsStrided(mat4 const & m, void const * in, std::size_t inStride, void * out, std::size_t outStride, std::size_t count)
+	{
+		detail::batch_affine(m, static_cast<unsigned char const *>(in), inStride, static_cast<unsigned char *>(out), outStride, count, 0.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void transformPointsSoA(mat4 const & m, float const * x, float const * y, float const * z, float * outX, float * outY, float * outZ, std::size_t count)
+	{
+		detail::batch_affine_soa(m, x, y, z, outX, outY, outZ, count, 1.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void transformDirectionsSoA(mat4 const & m, float const * x, float const * y, float const * z, float * outX, float * outY, float * outZ, std::size_t count)
+	{
+		detail::batch_affine_soa(m, x, y, z, outX, outY, outZ, count, 0.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void transformVectors(mat4 const & matrix, vec4 const * in, vec4 * out, std::size_t count)
+	{
+		float const * m = detail::batch_columns(matrix);
+		float const * src = reinterpret_cast<float const *>(in);
+		float * dst = reinterpret_cast<float *>(out);
+		std::size_t i = 0;
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			// Two vectors per register, one in each 128 bits lane, the in lane
+			// permutes broadcast their components
+			__m256 const c0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m));
+			__m256 const c1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m + 4));
+			__m256 const c2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m + 8));
+			__m256 const c3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m + 12));
+			for(; i + 2 <= count; i += 2)
+			{
+				__m256 v = _mm256_loadu_ps(src + 4 * i);
+				__m256 r = _mm256_mul_ps(c3, _mm256_permute_ps(v, 0xFF));
+				r = _mm256_fmadd_ps(c2, _mm256_permute_ps(v, 0xAA), r);
+				r = _mm256_fmadd_ps(c1, _mm256_permute_ps(v, 0x55), r);
+				r = _mm256_fmadd_ps(c0, _mm256_permute_ps(v, 0x00), r);
+				_mm256_storeu_ps(dst + 4 * i, r);
+			}
+#		endif
+#		if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+			__m128 const s0 = _mm_loadu_ps(m);
+			__m128 const s1 = _mm_loadu_ps(m + 4);
+			__m128 const s2 = _mm_loadu_ps(m + 8);
+			__m128 const s3 = _mm_loadu_ps(m + 12);
+			for(; i < count; ++i)
+			{
+				__m128 v = _mm_loadu_ps(src + 4 * i);
+				__m128 r = _mm_mul_ps(s3, _mm_shuffle_ps(v, v, 0xFF));
+				r = detail::batch_madd(s2, _mm_shuffle_ps(v, v, 0xAA), r);
+				r = detail::batch_madd(s1, _mm_shuffle_ps(v, v, 0x55), r);
+				r = detail::batch_madd(s0, _mm_shuffle_ps(v, v, 0x00), r);
+				_mm_storeu_ps(dst + 4 * i, r);
+			}
+#		else
+			for(; i < count; ++i)
+				detail::batch_vec4_scalar(m, src + 4 * i, dst + 4 * i);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void transformPoints(mat4 const * m, vec3 const * in, vec3 * out, std::size_t count)
+	{
+		// Bound by the 64 bytes of matrix read per point, 128 bits kernels are enough
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			float const * columns = detail::batch_columns(m[i]);
+#			if GLM_BATCH_ARCH != GLM_BATCH_SCALAR
+				__m128 const c0 = _mm_loadu_ps(columns);
+				__m128 const c1 = _mm_loadu_ps(columns + 4);
+				__m128 const c2 = _mm_loadu_ps(columns + 8);
+				__m128 const c3 = _mm_loadu_ps(columns + 12);
+				detail::batch_affine_sse(c0, c1, c2, c3, &in[i][0], &out[i][0]);
+#			else
+				detail::batch_affine_scalar(columns, &in[i][0], &out[i][0], 1.0f);
+#			endif
+		}
+	}
+}//namespace glm
@@ -454,13 +454,6 @@ GLM_FUNC_QUALIFIER fmat4x4SIMD operator/
     );
 }
 
-GLM_FUNC_QUALIFIER detail::fmat4x4SIMD inverse(detail::fmat4x4SIMD const & m)
-{
-	detail::fmat4x4SIMD result;
-	detail::sse_inverse_ps(&m[0].Data, &result[0].Data);
-	return result;
-}
-
 GLM_FUNC_QUALIFIER fvec4SIMD operator/
 (
 	const fmat4x4SIMD & m,
@@ -548,14 +541,22 @@ GLM_FUNC_QUALIFIER mat4 mat4_cast
 	detail::fmat4x4SIMD const & x
 )
 {
-	GLM_ALIGN(16) mat4 Result;
-	_mm_store_ps(&Result[0][0], x.Data[0].Data);
-	_mm_store_ps(&Result[1][0], x.Data[1].Data);
-	_mm_store_ps(&Result[2][0], x.Data[2].Data);
-	_mm_store_ps(&Result[3][0], x.Data[3].Data);
+	mat4 Result;
+	_mm_storeu_ps(&Result[0][0], x.Data[0].Data);
+	_mm_storeu_ps(&Result[1][0], x.Data[1].Data);
+	_mm_storeu_ps(&Result[2][0], x.Data[2].Data);
+	_mm_storeu_ps(&Result[3][0], x.Data[3].Data);
 	return Result;
 }
 
+// Declared in glm, not in glm::detail
+GLM_FUNC_QUALIFIER detail::fmat4x4SIMD inverse(detail::fmat4x4SIMD const & m)
+{
+	detail::fmat4x4SIMD result;
+	detail::sse_inverse_ps(&m[0].Data, &result[0].Data);
+	return result;
+}
+
 GLM_FUNC_QUALIFIER detail::fmat4x4SIMD matrixCompMult
 (
 	detail::fmat4x4SIMD const & x,
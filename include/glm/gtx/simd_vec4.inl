@@ -38,7 +38,7 @@ GLM_FUNC_QUALIFIER fvec4SIMD::fvec4SIMD(__m128 const & Data) :
 {}
 
 GLM_FUNC_QUALIFIER fvec4SIMD::fvec4SIMD(vec4 const & v) :
-	Data(_mm_set_ps(v.w, v.z, v.y, v.x))
+	Data(_mm_loadu_ps(&v[0]))
 {}
 
 //////////////////////////////////////
@@ -280,8 +280,8 @@ GLM_FUNC_QUALIFIER vec4 vec4_cast
 	detail::fvec4SIMD const & x
 )
 {
-	GLM_ALIGN(16) vec4 Result;
-	_mm_store_ps(&Result[0], x.Data);
+	vec4 Result;
+	_mm_storeu_ps(&Result[0], x.Data);
 	return Result;
 }
 
@@ -457,8 +457,7 @@ GLM_FUNC_QUALIFIER detail::fvec4SIMD mix
 )
 {
 	__m128 Sub0 = _mm_sub_ps(y.Data, x.Data);
-	__m128 Mul0 = _mm_mul_ps(a.Data, Sub0);
-	return _mm_add_ps(x.Data, Mul0);
+	return detail::sse_fma_ps(a.Data, Sub0, x.Data);
 }
 
 GLM_FUNC_QUALIFIER detail::fvec4SIMD step
@@ -534,7 +533,7 @@ GLM_FUNC_QUALIFIER detail::fvec4SIMD fma
 	detail::fvec4SIMD const & c
 )
 {
-	return _mm_add_ps(_mm_mul_ps(a.Data, b.Data), c.Data);
+	return detail::sse_fma_ps(a.Data, b.Data, c.Data);
 }
 
 GLM_FUNC_QUALIFIER float length
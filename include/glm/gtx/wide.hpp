@@ -0,0 +1,376 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_wide
+/// @file glm/gtx/wide.hpp
+/// @date 2026-10-19 / 2026-10-19
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_wide GLM_GTX_wide
+/// @ingroup gtx
+/// 
+/// @brief Eight lanes SoA types: floatx8, boolx8, vec3x8, vec4x8 and mat4x8.
+/// 
+/// One register (or two, or a plain array) per component, lane i of every
+/// component is object i. The usual operators and geometric functions work on
+/// eight objects at once, comparisons give boolx8 masks and select() blends by
+/// mask, so packet kernels (culling, particles, ray packets) read like the
+/// scalar code. wideGather and wideScatter convert from and to arrays of vec3,
+/// vec4 and mat4.
+/// The storage is an AVX register, two SSE2 registers or eight floats,
+/// following GLM_BATCH_ARCH (see GLM_GTX_batch_transform), so
+/// GLM_FORCE_PURE does not apply and GLM_FORCE_BATCH_PURE keeps them scalar.
+/// These are register types: keep the data in plain arrays and gather the
+/// values where they are used. Their alignment is above what new and
+/// std::vector guarantee before C++17, and they are always passed by
+/// reference because 32-bit Visual C++ can not pass them by value.
+/// 
+/// <glm/gtx/wide.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependencies
+#include "../mat4x4.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include "../detail/batch_simd.hpp"
+#include <cstddef>
+#include <vector>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_wide extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_wide
+	/// @{
+
+	/// Eight lanes of booleans, the result of comparing floatx8.
+	/// @see gtx_wide
+	struct boolx8
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m256 data;
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			__m128 data[2];
+#		else
+			bool data[8];
+#		endif
+
+		/// Every lane false.
+		GLM_FUNC_DECL boolx8();
+		/// Every lane b.
+		GLM_FUNC_DECL explicit boolx8(bool b);
+
+		/// Lane i.
+		GLM_FUNC_DECL bool operator[](length_t i) const;
+	};
+
+	/// Eight lanes of floats.
+	/// @see gtx_wide
+	struct floatx8
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m256 data;
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			__m128 data[2];
+#		else
+			float data[8];
+#		endif
+
+		/// Every lane zero.
+		GLM_FUNC_DECL floatx8();
+		/// Every lane s.
+		GLM_FUNC_DECL explicit floatx8(float s);
+
+		/// Lane i.
+		GLM_FUNC_DECL float operator[](length_t i) const;
+
+		GLM_FUNC_DECL floatx8 & operator+=(floatx8 const & v);
+		GLM_FUNC_DECL floatx8 & operator-=(floatx8 const & v);
+		GLM_FUNC_DECL floatx8 & operator*=(floatx8 const & v);
+		GLM_FUNC_DECL floatx8 & operator/=(floatx8 const & v);
+	};
+
+	struct vec4x8;
+
+	/// Eight vec3, one floatx8 per component.
+	/// @see gtx_wide
+	struct vec3x8
+	{
+		floatx8 x, y, z;
+
+		/// Every lane zero.
+		GLM_FUNC_DECL vec3x8();
+		/// Every lane v.
+		GLM_FUNC_DECL explicit vec3x8(vec3 const & v);
+		GLM_FUNC_DECL vec3x8(floatx8 const & x, floatx8 const & y, floatx8 const & z);
+		/// Drops w.
+		GLM_FUNC_DECL explicit vec3x8(vec4x8 const & v);
+
+		GLM_FUNC_DECL vec3x8 & operator+=(vec3x8 const & v);
+		GLM_FUNC_DECL vec3x8 & operator-=(vec3x8 const & v);
+		GLM_FUNC_DECL vec3x8 & operator*=(vec3x8 const & v);
+		GLM_FUNC_DECL vec3x8 & operator*=(floatx8 const & s);
+		GLM_FUNC_DECL vec3x8 & operator/=(vec3x8 const & v);
+		GLM_FUNC_DECL vec3x8 & operator/=(floatx8 const & s);
+	};
+
+	/// Eight vec4, one floatx8 per component.
+	/// @see gtx_wide
+	struct vec4x8
+	{
+		floatx8 x, y, z, w;
+
+		/// Every lane zero.
+		GLM_FUNC_DECL vec4x8();
+		/// Every lane v.
+		GLM_FUNC_DECL explicit vec4x8(vec4 const & v);
+		GLM_FUNC_DECL vec4x8(floatx8 const & x, floatx8 const & y, floatx8 const & z, floatx8 const & w);
+		GLM_FUNC_DECL vec4x8(vec3x8 const & v, floatx8 const & w);
+
+		GLM_FUNC_DECL vec4x8 & operator+=(vec4x8 const & v);
+		GLM_FUNC_DECL vec4x8 & operator-=(vec4x8 const & v);
+		GLM_FUNC_DECL vec4x8 & operator*=(vec4x8 const & v);
+		GLM_FUNC_DECL vec4x8 & operator*=(floatx8 const & s);
+		GLM_FUNC_DECL vec4x8 & operator/=(vec4x8 const & v);
+		GLM_FUNC_DECL vec4x8 & operator/=(floatx8 const & s);
+	};
+
+	/// Eight mat4, four vec4x8 columns.
+	/// @see gtx_wide
+	struct mat4x8
+	{
+		vec4x8 value[4];
+
+		/// Every lane the identity, like mat4.
+		GLM_FUNC_DECL mat4x8();
+		/// Every lane m.
+		GLM_FUNC_DECL explicit mat4x8(mat4 const & m);
+
+		/// Column i.
+		GLM_FUNC_DECL vec4x8 & operator[](length_t i);
+		GLM_FUNC_DECL vec4x8 const & operator[](length_t i) const;
+	};
+
+	/// Eight floats from p, which needs no alignment.
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 wideLoad(float const * p);
+
+	/// Writes the eight lanes of v to p, which needs no alignment.
+	/// @see gtx_wide
+	GLM_FUNC_DECL void wideStore(floatx8 const & v, float * p);
+
+	/// Bit i set when lane i is true.
+	/// @see gtx_wide
+	GLM_FUNC_DECL int laneMask(boolx8 const & b);
+
+	/// @see gtx_wide
+	GLM_FUNC_DECL bool any(boolx8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL bool all(boolx8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL bool none(boolx8 const & b);
+
+	GLM_FUNC_DECL boolx8 operator&(boolx8 const & a, boolx8 const & b);
+	GLM_FUNC_DECL boolx8 operator|(boolx8 const & a, boolx8 const & b);
+	GLM_FUNC_DECL boolx8 operator^(boolx8 const & a, boolx8 const & b);
+	GLM_FUNC_DECL boolx8 operator!(boolx8 const & b);
+
+	GLM_FUNC_DECL floatx8 operator-(floatx8 const & v);
+	GLM_FUNC_DECL floatx8 operator+(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator-(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator*(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator/(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator+(floatx8 const & a, float b);
+	GLM_FUNC_DECL floatx8 operator-(floatx8 const & a, float b);
+	GLM_FUNC_DECL floatx8 operator*(floatx8 const & a, float b);
+	GLM_FUNC_DECL floatx8 operator/(floatx8 const & a, float b);
+	GLM_FUNC_DECL floatx8 operator+(float a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator-(float a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator*(float a, floatx8 const & b);
+	GLM_FUNC_DECL floatx8 operator/(float a, floatx8 const & b);
+
+	/// Lane wise comparisons, != is true for NaN like the scalar operator.
+	GLM_FUNC_DECL boolx8 operator<(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL boolx8 operator<=(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL boolx8 operator>(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL boolx8 operator>=(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL boolx8 operator==(floatx8 const & a, floatx8 const & b);
+	GLM_FUNC_DECL boolx8 operator!=(floatx8 const & a, floatx8 const & b);
+
+	/// Lane i is a[i] where m[i] is true, else b[i].
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 select(boolx8 const & m, floatx8 const & a, floatx8 const & b);
+
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 min(floatx8 const & a, floatx8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 max(floatx8 const & a, floatx8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 clamp(floatx8 const & x, floatx8 const & minVal, floatx8 const & maxVal);
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 abs(floatx8 const & x);
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 sqrt(floatx8 const & x);
+	/// 1 / sqrt(x), divided, not the hardware estimate.
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 inversesqrt(floatx8 const & x);
+	/// a * b + c, rounded once when GLM_BATCH_ARCH is GLM_BATCH_AVX2.
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 fma(floatx8 const & a, floatx8 const & b, floatx8 const & c);
+	/// x + (y - x) * a.
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 mix(floatx8 const & x, floatx8 const & y, floatx8 const & a);
+	/// Largest integer not above x. Without AVX, lanes of magnitude 2^23 or
+	/// more are already integers and kept as they are.
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 floor(floatx8 const & x);
+	/// x - floor(x).
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 fract(floatx8 const & x);
+
+	GLM_FUNC_DECL vec3x8 operator-(vec3x8 const & v);
+	GLM_FUNC_DECL vec3x8 operator+(vec3x8 const & a, vec3x8 const & b);
+	GLM_FUNC_DECL vec3x8 operator-(vec3x8 const & a, vec3x8 const & b);
+	GLM_FUNC_DECL vec3x8 operator*(vec3x8 const & a, vec3x8 const & b);
+	GLM_FUNC_DECL vec3x8 operator/(vec3x8 const & a, vec3x8 const & b);
+	GLM_FUNC_DECL vec3x8 operator*(vec3x8 const & v, floatx8 const & s);
+	GLM_FUNC_DECL vec3x8 operator*(floatx8 const & s, vec3x8 const & v);
+	GLM_FUNC_DECL vec3x8 operator/(vec3x8 const & v, floatx8 const & s);
+	GLM_FUNC_DECL vec3x8 operator*(vec3x8 const & v, float s);
+	GLM_FUNC_DECL vec3x8 operator*(float s, vec3x8 const & v);
+	GLM_FUNC_DECL vec3x8 operator/(vec3x8 const & v, float s);
+
+	GLM_FUNC_DECL vec4x8 operator-(vec4x8 const & v);
+	GLM_FUNC_DECL vec4x8 operator+(vec4x8 const & a, vec4x8 const & b);
+	GLM_FUNC_DECL vec4x8 operator-(vec4x8 const & a, vec4x8 const & b);
+	GLM_FUNC_DECL vec4x8 operator*(vec4x8 const & a, vec4x8 const & b);
+	GLM_FUNC_DECL vec4x8 operator/(vec4x8 const & a, vec4x8 const & b);
+	GLM_FUNC_DECL vec4x8 operator*(vec4x8 const & v, floatx8 const & s);
+	GLM_FUNC_DECL vec4x8 operator*(floatx8 const & s, vec4x8 const & v);
+	GLM_FUNC_DECL vec4x8 operator/(vec4x8 const & v, floatx8 const & s);
+	GLM_FUNC_DECL vec4x8 operator*(vec4x8 const & v, float s);
+	GLM_FUNC_DECL vec4x8 operator*(float s, vec4x8 const & v);
+	GLM_FUNC_DECL vec4x8 operator/(vec4x8 const & v, float s);
+
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 dot(vec3x8 const & a, vec3x8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 dot(vec4x8 const & a, vec4x8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec3x8 cross(vec3x8 const & a, vec3x8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 length(vec3x8 const & v);
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 length(vec4x8 const & v);
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 distance(vec3x8 const & a, vec3x8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL floatx8 distance(vec4x8 const & a, vec4x8 const & b);
+	/// Like glm::normalize, zero length lanes give NaN.
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec3x8 normalize(vec3x8 const & v);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec4x8 normalize(vec4x8 const & v);
+
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec3x8 select(boolx8 const & m, vec3x8 const & a, vec3x8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec4x8 select(boolx8 const & m, vec4x8 const & a, vec4x8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec3x8 min(vec3x8 const & a, vec3x8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec4x8 min(vec4x8 const & a, vec4x8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec3x8 max(vec3x8 const & a, vec3x8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec4x8 max(vec4x8 const & a, vec4x8 const & b);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec3x8 mix(vec3x8 const & x, vec3x8 const & y, floatx8 const & a);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec4x8 mix(vec4x8 const & x, vec4x8 const & y, floatx8 const & a);
+
+	GLM_FUNC_DECL vec4x8 operator*(mat4x8 const & m, vec4x8 const & v);
+	GLM_FUNC_DECL mat4x8 operator*(mat4x8 const & a, mat4x8 const & b);
+
+	/// @see gtx_wide
+	GLM_FUNC_DECL mat4x8 transpose(mat4x8 const & m);
+
+	/// Lane i as a vec3.
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec3 lane(vec3x8 const & v, length_t i);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec4 lane(vec4x8 const & v, length_t i);
+	/// @see gtx_wide
+	GLM_FUNC_DECL mat4 lane(mat4x8 const & m, length_t i);
+
+	/// The first min(count, 8) elements of in, the lanes past them are zero.
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec3x8 wideGather(vec3 const * in, std::size_t count);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec4x8 wideGather(vec4 const * in, std::size_t count);
+	/// The first min(count, 8) elements of in, the lanes past them are the identity.
+	/// @see gtx_wide
+	GLM_FUNC_DECL mat4x8 wideGather(mat4 const * in, std::size_t count);
+
+	/// Lane i is in[indices[i]] for i < min(count, 8), the others are zero.
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec3x8 wideGather(vec3 const * in, unsigned int const * indices, std::size_t count);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec4x8 wideGather(vec4 const * in, unsigned int const * indices, std::size_t count);
+
+	/// Lanes from in[first] up to eight elements or the end of in, the others are zero.
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec3x8 wideGather(std::vector<vec3> const & in, std::size_t first);
+	/// @see gtx_wide
+	GLM_FUNC_DECL vec4x8 wideGather(std::vector<vec4> const & in, std::size_t first);
+
+	/// Writes the first min(count, 8) lanes of v to out.
+	/// @see gtx_wide
+	GLM_FUNC_DECL void wideScatter(vec3x8 const & v, vec3 * out, std::size_t count);
+	/// @see gtx_wide
+	GLM_FUNC_DECL void wideScatter(vec4x8 const & v, vec4 * out, std::size_t count);
+
+	/// Writes lane i of v to out[indices[i]] for i < min(count, 8), in lane order.
+	/// @see gtx_wide
+	GLM_FUNC_DECL void wideScatter(vec3x8 const & v, vec3 * out, unsigned int const * indices, std::size_t count);
+	/// @see gtx_wide
+	GLM_FUNC_DECL void wideScatter(vec4x8 const & v, vec4 * out, unsigned int const * indices, std::size_t count);
+
+	/// Writes the lanes of v from out[first] up to eight elements or the end of out.
+	/// @see gtx_wide
+	GLM_FUNC_DECL void wideScatter(vec3x8 const & v, std::vector<vec3> & out, std::size_t first);
+	/// @see gtx_wide
+	GLM_FUNC_DECL void wideScatter(vec4x8 const & v, std::vector<vec4> & out, std::size_t first);
+
+	/// @}
+}// namespace glm
+
+#include "wide.inl"
@@ -0,0 +1,1178 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2015 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_wide
+/// @file glm/gtx/wide.inl
+/// @date 2026-10-19 / 2026-10-19
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+#	if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+	GLM_FUNC_QUALIFIER floatx8 wide_float(__m256 const & v)
+	{
+		floatx8 r;
+		r.data = v;
+		return r;
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 wide_bool(__m256 const & v)
+	{
+		boolx8 r;
+		r.data = v;
+		return r;
+	}
+#	elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+	GLM_FUNC_QUALIFIER floatx8 wide_float(__m128 const & low, __m128 const & high)
+	{
+		floatx8 r;
+		r.data[0] = low;
+		r.data[1] = high;
+		return r;
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 wide_bool(__m128 const & low, __m128 const & high)
+	{
+		boolx8 r;
+		r.data[0] = low;
+		r.data[1] = high;
+		return r;
+	}
+#	endif
+
+	// Eight packed vec3 (24 floats) to SoA and back
+	GLM_FUNC_QUALIFIER void wide_deinterleave(float const * p, floatx8 & x, floatx8 & y, floatx8 & z)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			batch_deinterleave8(p, x.data, y.data, z.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			batch_deinterleave4(p, x.data[0], y.data[0], z.data[0]);
+			batch_deinterleave4(p + 12, x.data[1], y.data[1], z.data[1]);
+#		else
+			for(int i = 0; i < 8; ++i)
+			{
+				x.data[i] = p[3 * i];
+				y.data[i] = p[3 * i + 1];
+				z.data[i] = p[3 * i + 2];
+			}
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void wide_interleave(floatx8 const & x, floatx8 const & y, floatx8 const & z, float * p)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			batch_interleave8(x.data, y.data, z.data, p);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			batch_interleave4(x.data[0], y.data[0], z.data[0], p);
+			batch_interleave4(x.data[1], y.data[1], z.data[1], p + 12);
+#		else
+			for(int i = 0; i < 8; ++i)
+			{
+				p[3 * i] = x.data[i];
+				p[3 * i + 1] = y.data[i];
+				p[3 * i + 2] = z.data[i];
+			}
+#		endif
+	}
+
+	// Eight vec4 to SoA and back, a 4x4 transpose per half
+	GLM_FUNC_QUALIFIER void wide_deinterleave(float const * p, floatx8 & x, floatx8 & y, floatx8 & z, floatx8 & w)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 16), 1);
+			__m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 20), 1);
+			__m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 24), 1);
+			__m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 12)), _mm_loadu_ps(p + 28), 1);
+			__m256 t0 = _mm256_unpacklo_ps(r0, r1);
+			__m256 t1 = _mm256_unpacklo_ps(r2, r3);
+			__m256 t2 = _mm256_unpackhi_ps(r0, r1);
+			__m256 t3 = _mm256_unpackhi_ps(r2, r3);
+			x.data = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+			y.data = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+			z.data = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			w.data = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			for(int h = 0; h < 2; ++h)
+			{
+				__m128 r0 = _mm_loadu_ps(p + 16 * h);
+				__m128 r1 = _mm_loadu_ps(p + 16 * h + 4);
+				__m128 r2 = _mm_loadu_ps(p + 16 * h + 8);
+				__m128 r3 = _mm_loadu_ps(p + 16 * h + 12);
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+				x.data[h] = r0;
+				y.data[h] = r1;
+				z.data[h] = r2;
+				w.data[h] = r3;
+			}
+#		else
+			for(int i = 0; i < 8; ++i)
+			{
+				x.data[i] = p[4 * i];
+				y.data[i] = p[4 * i + 1];
+				z.data[i] = p[4 * i + 2];
+				w.data[i] = p[4 * i + 3];
+			}
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void wide_interleave(floatx8 const & x, floatx8 const & y, floatx8 const & z, floatx8 const & w, float * p)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			__m256 t0 = _mm256_unpacklo_ps(x.data, y.data);
+			__m256 t1 = _mm256_unpacklo_ps(z.data, w.data);
+			__m256 t2 = _mm256_unpackhi_ps(x.data, y.data);
+			__m256 t3 = _mm256_unpackhi_ps(z.data, w.data);
+			__m256 r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+			__m256 r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+			__m256 r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			__m256 r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+			_mm_storeu_ps(p, _mm256_castps256_ps128(r0));
+			_mm_storeu_ps(p + 4, _mm256_castps256_ps128(r1));
+			_mm_storeu_ps(p + 8, _mm256_castps256_ps128(r2));
+			_mm_storeu_ps(p + 12, _mm256_castps256_ps128(r3));
+			_mm_storeu_ps(p + 16, _mm256_extractf128_ps(r0, 1));
+			_mm_storeu_ps(p + 20, _mm256_extractf128_ps(r1, 1));
+			_mm_storeu_ps(p + 24, _mm256_extractf128_ps(r2, 1));
+			_mm_storeu_ps(p + 28, _mm256_extractf128_ps(r3, 1));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			for(int h = 0; h < 2; ++h)
+			{
+				__m128 r0 = x.data[h];
+				__m128 r1 = y.data[h];
+				__m128 r2 = z.data[h];
+				__m128 r3 = w.data[h];
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+				_mm_storeu_ps(p + 16 * h, r0);
+				_mm_storeu_ps(p + 16 * h + 4, r1);
+				_mm_storeu_ps(p + 16 * h + 8, r2);
+				_mm_storeu_ps(p + 16 * h + 12, r3);
+			}
+#		else
+			for(int i = 0; i < 8; ++i)
+			{
+				p[4 * i] = x.data[i];
+				p[4 * i + 1] = y.data[i];
+				p[4 * i + 2] = z.data[i];
+				p[4 * i + 3] = w.data[i];
+			}
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t wide_count(std::size_t count)
+	{
+		return count < 8 ? count : 8;
+	}
+}//namespace detail
+
+	//////////////////////////////////////
+	// boolx8
+
+	GLM_FUNC_QUALIFIER boolx8::boolx8()
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			data = _mm256_setzero_ps();
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			data[0] = data[1] = _mm_setzero_ps();
+#		else
+			for(int i = 0; i < 8; ++i)
+				data[i] = false;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER boolx8::boolx8(bool b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			data = _mm256_castsi256_ps(_mm256_set1_epi32(b ? -1 : 0));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			data[0] = data[1] = _mm_castsi128_ps(_mm_set1_epi32(b ? -1 : 0));
+#		else
+			for(int i = 0; i < 8; ++i)
+				data[i] = b;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER bool boolx8::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < 8);
+		return (laneMask(*this) >> i & 1) != 0;
+	}
+
+	GLM_FUNC_QUALIFIER int laneMask(boolx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return _mm256_movemask_ps(b.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return _mm_movemask_ps(b.data[0]) | _mm_movemask_ps(b.data[1]) << 4;
+#		else
+			int Result = 0;
+			for(int i = 0; i < 8; ++i)
+				Result |= b.data[i] ? 1 << i : 0;
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER bool any(boolx8 const & b)
+	{
+		return laneMask(b) != 0;
+	}
+
+	GLM_FUNC_QUALIFIER bool all(boolx8 const & b)
+	{
+		return laneMask(b) == 0xFF;
+	}
+
+	GLM_FUNC_QUALIFIER bool none(boolx8 const & b)
+	{
+		return laneMask(b) == 0;
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 operator&(boolx8 const & a, boolx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_bool(_mm256_and_ps(a.data, b.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_bool(_mm_and_ps(a.data[0], b.data[0]), _mm_and_ps(a.data[1], b.data[1]));
+#		else
+			boolx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] && b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 operator|(boolx8 const & a, boolx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_bool(_mm256_or_ps(a.data, b.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_bool(_mm_or_ps(a.data[0], b.data[0]), _mm_or_ps(a.data[1], b.data[1]));
+#		else
+			boolx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] || b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 operator^(boolx8 const & a, boolx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_bool(_mm256_xor_ps(a.data, b.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_bool(_mm_xor_ps(a.data[0], b.data[0]), _mm_xor_ps(a.data[1], b.data[1]));
+#		else
+			boolx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] != b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 operator!(boolx8 const & b)
+	{
+		return b ^ boolx8(true);
+	}
+
+	//////////////////////////////////////
+	// floatx8
+
+	GLM_FUNC_QUALIFIER floatx8::floatx8()
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			data = _mm256_setzero_ps();
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			data[0] = data[1] = _mm_setzero_ps();
+#		else
+			for(int i = 0; i < 8; ++i)
+				data[i] = 0.0f;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8::floatx8(float s)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			data = _mm256_set1_ps(s);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			data[0] = data[1] = _mm_set1_ps(s);
+#		else
+			for(int i = 0; i < 8; ++i)
+				data[i] = s;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER float floatx8::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < 8);
+		return reinterpret_cast<float const *>(&data)[i];
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 & floatx8::operator+=(floatx8 const & v)
+	{
+		return (*this = *this + v);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 & floatx8::operator-=(floatx8 const & v)
+	{
+		return (*this = *this - v);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 & floatx8::operator*=(floatx8 const & v)
+	{
+		return (*this = *this * v);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 & floatx8::operator/=(floatx8 const & v)
+	{
+		return (*this = *this / v);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 wideLoad(float const * p)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_loadu_ps(p));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_float(_mm_loadu_ps(p), _mm_loadu_ps(p + 4));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = p[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void wideStore(floatx8 const & v, float * p)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			_mm256_storeu_ps(p, v.data);
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			_mm_storeu_ps(p, v.data[0]);
+			_mm_storeu_ps(p + 4, v.data[1]);
+#		else
+			for(int i = 0; i < 8; ++i)
+				p[i] = v.data[i];
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator-(floatx8 const & v)
+	{
+		// Flips the sign bit, -0 and NaN included
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_xor_ps(v.data, _mm256_set1_ps(-0.0f)));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			__m128 const sign = _mm_set1_ps(-0.0f);
+			return detail::wide_float(_mm_xor_ps(v.data[0], sign), _mm_xor_ps(v.data[1], sign));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = -v.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator+(floatx8 const & a, floatx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_add_ps(a.data, b.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_float(_mm_add_ps(a.data[0], b.data[0]), _mm_add_ps(a.data[1], b.data[1]));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] + b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator-(floatx8 const & a, floatx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_sub_ps(a.data, b.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_float(_mm_sub_ps(a.data[0], b.data[0]), _mm_sub_ps(a.data[1], b.data[1]));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] - b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator*(floatx8 const & a, floatx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_mul_ps(a.data, b.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_float(_mm_mul_ps(a.data[0], b.data[0]), _mm_mul_ps(a.data[1], b.data[1]));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] * b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator/(floatx8 const & a, floatx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_div_ps(a.data, b.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_float(_mm_div_ps(a.data[0], b.data[0]), _mm_div_ps(a.data[1], b.data[1]));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] / b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator+(floatx8 const & a, float b)
+	{
+		return a + floatx8(b);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator-(floatx8 const & a, float b)
+	{
+		return a - floatx8(b);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator*(floatx8 const & a, float b)
+	{
+		return a * floatx8(b);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator/(floatx8 const & a, float b)
+	{
+		return a / floatx8(b);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator+(float a, floatx8 const & b)
+	{
+		return floatx8(a) + b;
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator-(float a, floatx8 const & b)
+	{
+		return floatx8(a) - b;
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator*(float a, floatx8 const & b)
+	{
+		return floatx8(a) * b;
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 operator/(float a, floatx8 const & b)
+	{
+		return floatx8(a) / b;
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 operator<(floatx8 const & a, floatx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_bool(_mm256_cmp_ps(a.data, b.data, _CMP_LT_OQ));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_bool(_mm_cmplt_ps(a.data[0], b.data[0]), _mm_cmplt_ps(a.data[1], b.data[1]));
+#		else
+			boolx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] < b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 operator<=(floatx8 const & a, floatx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_bool(_mm256_cmp_ps(a.data, b.data, _CMP_LE_OQ));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_bool(_mm_cmple_ps(a.data[0], b.data[0]), _mm_cmple_ps(a.data[1], b.data[1]));
+#		else
+			boolx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] <= b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 operator>(floatx8 const & a, floatx8 const & b)
+	{
+		return b < a;
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 operator>=(floatx8 const & a, floatx8 const & b)
+	{
+		return b <= a;
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 operator==(floatx8 const & a, floatx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_bool(_mm256_cmp_ps(a.data, b.data, _CMP_EQ_OQ));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_bool(_mm_cmpeq_ps(a.data[0], b.data[0]), _mm_cmpeq_ps(a.data[1], b.data[1]));
+#		else
+			boolx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] == b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER boolx8 operator!=(floatx8 const & a, floatx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_bool(_mm256_cmp_ps(a.data, b.data, _CMP_NEQ_UQ));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_bool(_mm_cmpneq_ps(a.data[0], b.data[0]), _mm_cmpneq_ps(a.data[1], b.data[1]));
+#		else
+			boolx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] != b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 select(boolx8 const & m, floatx8 const & a, floatx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_blendv_ps(b.data, a.data, m.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_float(
+				_mm_or_ps(_mm_and_ps(m.data[0], a.data[0]), _mm_andnot_ps(m.data[0], b.data[0])),
+				_mm_or_ps(_mm_and_ps(m.data[1], a.data[1]), _mm_andnot_ps(m.data[1], b.data[1])));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = m.data[i] ? a.data[i] : b.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 min(floatx8 const & a, floatx8 const & b)
+	{
+		// Operands swapped so a NaN in a gives a, like the scalar (b < a) ? b : a
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_min_ps(b.data, a.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_float(_mm_min_ps(b.data[0], a.data[0]), _mm_min_ps(b.data[1], a.data[1]));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = b.data[i] < a.data[i] ? b.data[i] : a.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 max(floatx8 const & a, floatx8 const & b)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_max_ps(b.data, a.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_float(_mm_max_ps(b.data[0], a.data[0]), _mm_max_ps(b.data[1], a.data[1]));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = a.data[i] < b.data[i] ? b.data[i] : a.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 clamp(floatx8 const & x, floatx8 const & minVal, floatx8 const & maxVal)
+	{
+		return min(max(x, minVal), maxVal);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 abs(floatx8 const & x)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), x.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			__m128 const sign = _mm_set1_ps(-0.0f);
+			return detail::wide_float(_mm_andnot_ps(sign, x.data[0]), _mm_andnot_ps(sign, x.data[1]));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = x.data[i] < 0.0f ? -x.data[i] : x.data[i];
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 sqrt(floatx8 const & x)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_sqrt_ps(x.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			return detail::wide_float(_mm_sqrt_ps(x.data[0]), _mm_sqrt_ps(x.data[1]));
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = std::sqrt(x.data[i]);
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 inversesqrt(floatx8 const & x)
+	{
+		return 1.0f / sqrt(x);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 fma(floatx8 const & a, floatx8 const & b, floatx8 const & c)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_fmadd_ps(a.data, b.data, c.data));
+#		else
+			return a * b + c;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 mix(floatx8 const & x, floatx8 const & y, floatx8 const & a)
+	{
+		return fma(y - x, a, x);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 floor(floatx8 const & x)
+	{
+#		if GLM_BATCH_ARCH == GLM_BATCH_AVX2
+			return detail::wide_float(_mm256_floor_ps(x.data));
+#		elif GLM_BATCH_ARCH == GLM_BATCH_SSE2
+			// SSE2 only truncates: one less where that rounded up, the large lanes have no fraction
+			__m128 const One = _mm_set1_ps(1.0f);
+			__m128 const Exact = _mm_set1_ps(8388608.0f);
+			__m128 const Sign = _mm_set1_ps(-0.0f);
+			__m128 Result[2];
+			for(int i = 0; i < 2; ++i)
+			{
+				__m128 const Truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(x.data[i]));
+				__m128 const Floor = _mm_sub_ps(Truncated, _mm_and_ps(_mm_cmpgt_ps(Truncated, x.data[i]), One));
+				__m128 const Small = _mm_cmplt_ps(_mm_andnot_ps(Sign, x.data[i]), Exact);
+				Result[i] = _mm_or_ps(_mm_and_ps(Small, Floor), _mm_andnot_ps(Small, x.data[i]));
+			}
+			return detail::wide_float(Result[0], Result[1]);
+#		else
+			floatx8 Result;
+			for(int i = 0; i < 8; ++i)
+				Result.data[i] = std::floor(x.data[i]);
+			return Result;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 fract(floatx8 const & x)
+	{
+		return x - floor(x);
+	}
+
+	//////////////////////////////////////
+	// vec3x8
+
+	GLM_FUNC_QUALIFIER vec3x8::vec3x8()
+	{}
+
+	GLM_FUNC_QUALIFIER vec3x8::vec3x8(vec3 const & v) :
+		x(v.x), y(v.y), z(v.z)
+	{}
+
+	GLM_FUNC_QUALIFIER vec3x8::vec3x8(floatx8 const & a, floatx8 const & b, floatx8 const & c) :
+		x(a), y(b), z(c)
+	{}
+
+	GLM_FUNC_QUALIFIER vec3x8::vec3x8(vec4x8 const & v) :
+		x(v.x), y(v.y), z(v.z)
+	{}
+
+	GLM_FUNC_QUALIFIER vec3x8 & vec3x8::operator+=(vec3x8 const & v)
+	{
+		return (*this = *this + v);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 & vec3x8::operator-=(vec3x8 const & v)
+	{
+		return (*this = *this - v);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 & vec3x8::operator*=(vec3x8 const & v)
+	{
+		return (*this = *this * v);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 & vec3x8::operator*=(floatx8 const & s)
+	{
+		return (*this = *this * s);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 & vec3x8::operator/=(vec3x8 const & v)
+	{
+		return (*this = *this / v);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 & vec3x8::operator/=(floatx8 const & s)
+	{
+		return (*this = *this / s);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator-(vec3x8 const & v)
+	{
+		return vec3x8(-v.x, -v.y, -v.z);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator+(vec3x8 const & a, vec3x8 const & b)
+	{
+		return vec3x8(a.x + b.x, a.y + b.y, a.z + b.z);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator-(vec3x8 const & a, vec3x8 const & b)
+	{
+		return vec3x8(a.x - b.x, a.y - b.y, a.z - b.z);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator*(vec3x8 const & a, vec3x8 const & b)
+	{
+		return vec3x8(a.x * b.x, a.y * b.y, a.z * b.z);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator/(vec3x8 const & a, vec3x8 const & b)
+	{
+		return vec3x8(a.x / b.x, a.y / b.y, a.z / b.z);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator*(vec3x8 const & v, floatx8 const & s)
+	{
+		return vec3x8(v.x * s, v.y * s, v.z * s);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator*(floatx8 const & s, vec3x8 const & v)
+	{
+		return v * s;
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator/(vec3x8 const & v, floatx8 const & s)
+	{
+		return vec3x8(v.x / s, v.y / s, v.z / s);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator*(vec3x8 const & v, float s)
+	{
+		return v * floatx8(s);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator*(float s, vec3x8 const & v)
+	{
+		return v * floatx8(s);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 operator/(vec3x8 const & v, float s)
+	{
+		return v / floatx8(s);
+	}
+
+	//////////////////////////////////////
+	// vec4x8
+
+	GLM_FUNC_QUALIFIER vec4x8::vec4x8()
+	{}
+
+	GLM_FUNC_QUALIFIER vec4x8::vec4x8(vec4 const & v) :
+		x(v.x), y(v.y), z(v.z), w(v.w)
+	{}
+
+	GLM_FUNC_QUALIFIER vec4x8::vec4x8(floatx8 const & a, floatx8 const & b, floatx8 const & c, floatx8 const & d) :
+		x(a), y(b), z(c), w(d)
+	{}
+
+	GLM_FUNC_QUALIFIER vec4x8::vec4x8(vec3x8 const & v, floatx8 const & d) :
+		x(v.x), y(v.y), z(v.z), w(d)
+	{}
+
+	GLM_FUNC_QUALIFIER vec4x8 & vec4x8::operator+=(vec4x8 const & v)
+	{
+		return (*this = *this + v);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 & vec4x8::operator-=(vec4x8 const & v)
+	{
+		return (*this = *this - v);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 & vec4x8::operator*=(vec4x8 const & v)
+	{
+		return (*this = *this * v);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 & vec4x8::operator*=(floatx8 const & s)
+	{
+		return (*this = *this * s);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 & vec4x8::operator/=(vec4x8 const & v)
+	{
+		return (*this = *this / v);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 & vec4x8::operator/=(floatx8 const & s)
+	{
+		return (*this = *this / s);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator-(vec4x8 const & v)
+	{
+		return vec4x8(-v.x, -v.y, -v.z, -v.w);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator+(vec4x8 const & a, vec4x8 const & b)
+	{
+		return vec4x8(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator-(vec4x8 const & a, vec4x8 const & b)
+	{
+		return vec4x8(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator*(vec4x8 const & a, vec4x8 const & b)
+	{
+		return vec4x8(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator/(vec4x8 const & a, vec4x8 const & b)
+	{
+		return vec4x8(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator*(vec4x8 const & v, floatx8 const & s)
+	{
+		return vec4x8(v.x * s, v.y * s, v.z * s, v.w * s);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator*(floatx8 const & s, vec4x8 const & v)
+	{
+		return v * s;
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator/(vec4x8 const & v, floatx8 const & s)
+	{
+		return vec4x8(v.x / s, v.y / s, v.z / s, v.w / s);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator*(vec4x8 const & v, float s)
+	{
+		return v * floatx8(s);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator*(float s, vec4x8 const & v)
+	{
+		return v * floatx8(s);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator/(vec4x8 const & v, float s)
+	{
+		return v / floatx8(s);
+	}
+
+	//////////////////////////////////////
+	// Geometric
+
+	GLM_FUNC_QUALIFIER floatx8 dot(vec3x8 const & a, vec3x8 const & b)
+	{
+		return fma(a.z, b.z, fma(a.y, b.y, a.x * b.x));
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 dot(vec4x8 const & a, vec4x8 const & b)
+	{
+		return fma(a.w, b.w, fma(a.z, b.z, fma(a.y, b.y, a.x * b.x)));
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 cross(vec3x8 const & a, vec3x8 const & b)
+	{
+		return vec3x8(
+			a.y * b.z - b.y * a.z,
+			a.z * b.x - b.z * a.x,
+			a.x * b.y - b.x * a.y);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 length(vec3x8 const & v)
+	{
+		return sqrt(dot(v, v));
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 length(vec4x8 const & v)
+	{
+		return sqrt(dot(v, v));
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 distance(vec3x8 const & a, vec3x8 const & b)
+	{
+		return length(b - a);
+	}
+
+	GLM_FUNC_QUALIFIER floatx8 distance(vec4x8 const & a, vec4x8 const & b)
+	{
+		return length(b - a);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 normalize(vec3x8 const & v)
+	{
+		return v * inversesqrt(dot(v, v));
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 normalize(vec4x8 const & v)
+	{
+		return v * inversesqrt(dot(v, v));
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 select(boolx8 const & m, vec3x8 const & a, vec3x8 const & b)
+	{
+		return vec3x8(select(m, a.x, b.x), select(m, a.y, b.y), select(m, a.z, b.z));
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 select(boolx8 const & m, vec4x8 const & a, vec4x8 const & b)
+	{
+		return vec4x8(select(m, a.x, b.x), select(m, a.y, b.y), select(m, a.z, b.z), select(m, a.w, b.w));
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 min(vec3x8 const & a, vec3x8 const & b)
+	{
+		return vec3x8(min(a.x, b.x), min(a.y, b.y), min(a.z, b.z));
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 min(vec4x8 const & a, vec4x8 const & b)
+	{
+		return vec4x8(min(a.x, b.x), min(a.y, b.y), min(a.z, b.z), min(a.w, b.w));
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 max(vec3x8 const & a, vec3x8 const & b)
+	{
+		return vec3x8(max(a.x, b.x), max(a.y, b.y), max(a.z, b.z));
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 max(vec4x8 const & a, vec4x8 const & b)
+	{
+		return vec4x8(max(a.x, b.x), max(a.y, b.y), max(a.z, b.z), max(a.w, b.w));
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 mix(vec3x8 const & x, vec3x8 const & y, floatx8 const & a)
+	{
+		return vec3x8(mix(x.x, y.x, a), mix(x.y, y.y, a), mix(x.z, y.z, a));
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 mix(vec4x8 const & x, vec4x8 const & y, floatx8 const & a)
+	{
+		return vec4x8(mix(x.x, y.x, a), mix(x.y, y.y, a), mix(x.z, y.z, a), mix(x.w, y.w, a));
+	}
+
+	//////////////////////////////////////
+	// mat4x8
+
+	GLM_FUNC_QUALIFIER mat4x8::mat4x8()
+	{
+		value[0].x = floatx8(1.0f);
+		value[1].y = floatx8(1.0f);
+		value[2].z = floatx8(1.0f);
+		value[3].w = floatx8(1.0f);
+	}
+
+	GLM_FUNC_QUALIFIER mat4x8::mat4x8(mat4 const & m)
+	{
+		for(length_t i = 0; i < 4; ++i)
+			value[i] = vec4x8(m[i]);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 & mat4x8::operator[](length_t i)
+	{
+		assert(i >= 0 && i < 4);
+		return value[i];
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 const & mat4x8::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < 4);
+		return value[i];
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 operator*(mat4x8 const & m, vec4x8 const & v)
+	{
+		return m[0] * v.x + m[1] * v.y + m[2] * v.z + m[3] * v.w;
+	}
+
+	GLM_FUNC_QUALIFIER mat4x8 operator*(mat4x8 const & a, mat4x8 const & b)
+	{
+		mat4x8 Result;
+		for(length_t i = 0; i < 4; ++i)
+			Result[i] = a * b[i];
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER mat4x8 transpose(mat4x8 const & m)
+	{
+		mat4x8 Result;
+		Result[0] = vec4x8(m[0].x, m[1].x, m[2].x, m[3].x);
+		Result[1] = vec4x8(m[0].y, m[1].y, m[2].y, m[3].y);
+		Result[2] = vec4x8(m[0].z, m[1].z, m[2].z, m[3].z);
+		Result[3] = vec4x8(m[0].w, m[1].w, m[2].w, m[3].w);
+		return Result;
+	}
+
+	//////////////////////////////////////
+	// Lanes, gather and scatter
+
+	GLM_FUNC_QUALIFIER vec3 lane(vec3x8 const & v, length_t i)
+	{
+		return vec3(v.x[i], v.y[i], v.z[i]);
+	}
+
+	GLM_FUNC_QUALIFIER vec4 lane(vec4x8 const & v, length_t i)
+	{
+		return vec4(v.x[i], v.y[i], v.z[i], v.w[i]);
+	}
+
+	GLM_FUNC_QUALIFIER mat4 lane(mat4x8 const & m, length_t i)
+	{
+		return mat4(lane(m[0], i), lane(m[1], i), lane(m[2], i), lane(m[3], i));
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 wideGather(vec3 const * in, std::size_t count)
+	{
+		vec3x8 Result;
+		if(count >= 8)
+			detail::wide_deinterleave(&in[0][0], Result.x, Result.y, Result.z);
+		else if(count > 0)
+		{
+			float Packed[24] = {0};
+			std::memcpy(Packed, in, count * sizeof(vec3));
+			detail::wide_deinterleave(Packed, Result.x, Result.y, Result.z);
+		}
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 wideGather(vec4 const * in, std::size_t count)
+	{
+		vec4x8 Result;
+		if(count >= 8)
+			detail::wide_deinterleave(&in[0][0], Result.x, Result.y, Result.z, Result.w);
+		else if(count > 0)
+		{
+			float Packed[32] = {0};
+			std::memcpy(Packed, in, count * sizeof(vec4));
+			detail::wide_deinterleave(Packed, Result.x, Result.y, Result.z, Result.w);
+		}
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER mat4x8 wideGather(mat4 const * in, std::size_t count)
+	{
+		// Lane i of every column comes from matrix i, gathered column by column
+		mat4 Packed[8];
+		for(std::size_t i = 0; i < 8; ++i)
+			Packed[i] = i < count ? in[i] : mat4(1.0f);
+		vec4 Column[8];
+		mat4x8 Result;
+		for(length_t c = 0; c < 4; ++c)
+		{
+			for(length_t i = 0; i < 8; ++i)
+				Column[i] = Packed[i][c];
+			Result[c] = wideGather(Column, 8);
+		}
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 wideGather(vec3 const * in, unsigned int const * indices, std::size_t count)
+	{
+		vec3 Packed[8];
+		for(std::size_t i = 0; i < 8; ++i)
+			Packed[i] = i < count ? in[indices[i]] : vec3(0.0f);
+		return wideGather(Packed, 8);
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 wideGather(vec4 const * in, unsigned int const * indices, std::size_t count)
+	{
+		vec4 Packed[8];
+		for(std::size_t i = 0; i < 8; ++i)
+			Packed[i] = i < count ? in[indices[i]] : vec4(0.0f);
+		return wideGather(Packed, 8);
+	}
+
+	GLM_FUNC_QUALIFIER vec3x8 wideGather(std::vector<vec3> const & in, std::size_t first)
+	{
+		return first < in.size() ? wideGather(&in[first], in.size() - first) : vec3x8();
+	}
+
+	GLM_FUNC_QUALIFIER vec4x8 wideGather(std::vector<vec4> const & in, std::size_t first)
+	{
+		return first < in.size() ? wideGather(&in[first], in.size() - first) : vec4x8();
+	}
+
+	GLM_FUNC_QUALIFIER void wideScatter(vec3x8 const & v, vec3 * out, std::size_t count)
+	{
+		if(count >= 8)
+			detail::wide_interleave(v.x, v.y, v.z, &out[0][0]);
+		else if(count > 0)
+		{
+			float Packed[24];
+			detail::wide_interleave(v.x, v.y, v.z, Packed);
+			std::memcpy(&out[0][0], Packed, count * sizeof(vec3));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void wideScatter(vec4x8 const & v, vec4 * out, std::size_t count)
+	{
+		if(count >= 8)
+			detail::wide_interleave(v.x, v.y, v.z, v.w, &out[0][0]);
+		else if(count > 0)
+		{
+			float Packed[32];
+			detail::wide_interleave(v.x, v.y, v.z, v.w, Packed);
+			std::memcpy(&out[0][0], Packed, count * sizeof(vec4));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void wideScatter(vec3x8 const & v, vec3 * out, unsigned int const * indices, std::size_t count)
+	{
+		vec3 Packed[8];
+		wideScatter(v, Packed, 8);
+		for(std::size_t i = 0, n = detail::wide_count(count); i < n; ++i)
+			out[indices[i]] = Packed[i];
+	}
+
+	GLM_FUNC_QUALIFIER void wideScatter(vec4x8 const & v, vec4 * out, unsigned int const * indices, std::size_t count)
+	{
+		vec4 Packed[8];
+		wideScatter(v, Packed, 8);
+		for(std::size_t i = 0, n = detail::wide_count(count); i < n; ++i)
+			out[indices[i]] = Packed[i];
+	}
+
+	GLM_FUNC_QUALIFIER void wideScatter(vec3x8 const & v, std::vector<vec3> & out, std::size_t first)
+	{
+		if(first < out.size())
+			wideScatter(v, &out[first], out.size() - first);
+	}
+
+	GLM_FUNC_QUALIFIER void wideScatter(vec4x8 const & v, std::vector<vec4> & out, std::size_t first)
+	{
+		if(first < out.size())
+			wideScatter(v, &out[first], out.size() - first);
+	}
+}//namespace glm